@@ -59,6 +59,13 @@ enum app_event_type_flags {
 	APP_EVENT_TYPE_FLAGS_COUNT,
 	/** marks beginning of user-specific flags.*/
 	APP_EVENT_TYPE_FLAGS_USER_DEFINED_START = APP_EVENT_TYPE_FLAGS_COUNT,
+	/** enables coalescing. A submitted event replaces a not yet dispatched
+	 *  event of the same type (and key, see @ref APP_EVENT_COALESCE_KEY_REGISTER).
+	 *  Requires @kconfig{CONFIG_APP_EVENT_MANAGER_COALESCING}.
+	 *  Flag set by user. The flag uses the most significant bit of the event type flags,
+	 *  so that the values of user-specific flags do not change.
+	 */
+	APP_EVENT_TYPE_FLAGS_COALESCE = 15,
 };
 
 /** @brief Get event type flag's value.
@@ -173,9 +180,33 @@ static inline bool app_event_get_type_flag(const struct event_type *et,
  * @param ev_info_struct   Data structure describing the event type.
  * @param app_event_type_flags Event type flags.
  *                         You should use APP_EVENT_FLAGS_CREATE to define them.
+ * @param ...              Optional dispatch lane of the event type. If not provided, lane 0
+ *                         is used. Lanes other than 0 require
+ *                         @kconfig{CONFIG_APP_EVENT_MANAGER_LANES} to be enabled.
+ *                         Listeners of events in different lanes run concurrently.
  */
-#define APP_EVENT_TYPE_DEFINE(ename, log_fn, ev_info_struct, app_event_type_flags) \
-	_APP_EVENT_TYPE_DEFINE(ename, log_fn, ev_info_struct, app_event_type_flags)
+#define APP_EVENT_TYPE_DEFINE(ename, log_fn, ev_info_struct, app_event_type_flags, ...) \
+	_APP_EVENT_TYPE_DEFINE(ename, log_fn, ev_info_struct, app_event_type_flags,	  \
+			       _APP_EVENT_LANE_GET(__VA_ARGS__))
+
+
+/** @brief Register coalescing key function for an event type.
+ *
+ * By default, a submitted event of type with the @ref APP_EVENT_TYPE_FLAGS_COALESCE flag
+ * replaces any not yet dispatched event of the same type. If a key function is registered,
+ * the event replaces only a not yet dispatched event of the same type with the same key.
+ * The key function should have a form `uint32_t key_fn(const struct app_event_header *aeh)`.
+ *
+ * @note
+ * The key function is called on event submission under the spinlock protecting the event queue,
+ * so it must be short and must not block. Key functions are resolved in
+ * @ref app_event_manager_init.
+ *
+ * @param ename   Name of the event.
+ * @param key_fn  Key function.
+ */
+#define APP_EVENT_COALESCE_KEY_REGISTER(ename, key_fn) \
+	_APP_EVENT_COALESCE_KEY_REGISTER(ename, key_fn)
 
 
 /** @brief Verify if an event ID is valid.
@@ -372,6 +403,20 @@ static inline size_t app_event_manager_event_size(const struct app_event_header
 	const struct {} __event_hook_postprocess_last_sub_redefined = {};  \
 	_APP_EVENT_HOOK_POSTPROCESS_REGISTER(hook_fn, _APP_EM_MARKER_FINAL_ELEMENT)
 
+/**
+ * @brief Register event hook on coalescing of an event.
+ *
+ * The event hook called when a submitted event replaces a not yet processed event of the same
+ * type (see @ref APP_EVENT_TYPE_FLAGS_COALESCE). The hook is called for the replaced event,
+ * in the context of the submitter, right before the replaced event is freed. The replaced event
+ * is not passed to the preprocess and postprocess hooks.
+ * The hook function should have a form `void hook(const struct app_event_header *aeh)`.
+ *
+ * @param hook_fn Hook function.
+ */
+#define APP_EVENT_HOOK_ON_COALESCE_REGISTER(hook_fn) \
+	_APP_EVENT_HOOK_ON_COALESCE_REGISTER(hook_fn, _APP_EM_SUBS_PRIO_ID(_APP_EM_SUBS_PRIO_NORMAL))
+
 
 /** @brief Initialize the Application Event Manager.
  *
@@ -402,6 +447,195 @@ void *app_event_manager_alloc(size_t size);
  **/
 void app_event_manager_free(void *addr);
 
+/** @brief Statistics of a single size class of the event memory pool. */
+struct app_event_manager_mem_pool_class_stats {
+	/** Size of a memory block in the size class (in bytes). */
+	size_t block_size;
+
+	/** Number of memory blocks in the size class. */
+	uint32_t block_cnt;
+
+	/** Number of memory blocks currently in use. */
+	uint32_t used;
+
+	/** Maximum number of memory blocks used at the same time. */
+	uint32_t max_used;
+};
+
+/** @brief Allocate event from the event memory pool.
+ *
+ * The event is allocated from the smallest size class with a free memory block that fits
+ * the requested size. If there is no such size class, the event is allocated from the
+ * system heap.
+ *
+ * @note
+ * For this function to be available the
+ * @kconfig{CONFIG_APP_EVENT_MANAGER_MEM_POOL} option needs to be enabled.
+ *
+ * @param size  Amount of memory requested (in bytes).
+ * @retval Address of the allocated memory if successful, otherwise NULL.
+ */
+void *app_event_manager_mem_pool_alloc(size_t size);
+
+/** @brief Free event allocated from the event memory pool.
+ *
+ * @note
+ * For this function to be available the
+ * @kconfig{CONFIG_APP_EVENT_MANAGER_MEM_POOL} option needs to be enabled.
+ *
+ * @param addr  Pointer returned by @ref app_event_manager_mem_pool_alloc.
+ */
+void app_event_manager_mem_pool_free(void *addr);
+
+/** @brief Get number of size classes of the event memory pool.
+ *
+ * @note
+ * For this function to be available the
+ * @kconfig{CONFIG_APP_EVENT_MANAGER_MEM_POOL} option needs to be enabled.
+ *
+ * @return Number of size classes.
+ */
+size_t app_event_manager_mem_pool_class_cnt(void);
+
+/** @brief Get statistics of a size class of the event memory pool.
+ *
+ * Size classes are sorted by the block size in ascending order.
+ *
+ * @note
+ * For this function to be available the
+ * @kconfig{CONFIG_APP_EVENT_MANAGER_MEM_POOL} option needs to be enabled.
+ *
+ * @param idx    Index of the size class.
+ * @param stats  Pointer to the structure to be filled with statistics.
+ *
+ * @retval 0 If the operation was successful.
+ * @retval -EINVAL If the size class index is invalid.
+ */
+int app_event_manager_mem_pool_class_stats_get(size_t idx,
+					       struct app_event_manager_mem_pool_class_stats *stats);
+
+/** @brief Get number of events allocated from the system heap by the event memory pool.
+ *
+ * @note
+ * For this function to be available the
+ * @kconfig{CONFIG_APP_EVENT_MANAGER_MEM_POOL} option needs to be enabled.
+ *
+ * @return Number of heap allocations made since boot.
+ */
+uint32_t app_event_manager_mem_pool_heap_fallback_cnt(void);
+
+/** @brief Statistics of an event dispatch lane. */
+struct app_event_manager_lane_stats {
+	/** Number of events dispatched in the lane. */
+	uint32_t dispatched_cnt;
+
+	/** Number of events waiting for dispatch in the lane. */
+	uint32_t depth;
+
+	/** Maximum number of events waiting for dispatch in the lane. */
+	uint32_t max_depth;
+
+	/** Sum of submit-to-dispatch wait times of the dispatched events (in cycles). */
+	uint64_t wait_cycles_total;
+
+	/** Maximum submit-to-dispatch wait time (in cycles). */
+	uint32_t wait_cycles_max;
+};
+
+/** @brief Get statistics of an event dispatch lane.
+ *
+ * @note
+ * For this function to be available the
+ * @kconfig{CONFIG_APP_EVENT_MANAGER_LANE_STATS} option needs to be enabled.
+ *
+ * @param lane   Dispatch lane.
+ * @param stats  Pointer to the structure to be filled with statistics.
+ *
+ * @retval 0 If the operation was successful.
+ * @retval -EINVAL If the dispatch lane is invalid.
+ */
+int app_event_manager_lane_stats_get(uint8_t lane, struct app_event_manager_lane_stats *stats);
+
+
+/** @brief Get number of coalesced events of a given type.
+ *
+ * @note
+ * For this function to be available the
+ * @kconfig{CONFIG_APP_EVENT_MANAGER_COALESCING} option needs to be enabled.
+ *
+ * @param et  Pointer to the event type.
+ *
+ * @return Number of events of the type that were replaced in the event queue by a newer event.
+ */
+uint32_t app_event_manager_coalesced_cnt_get(const struct event_type *et);
+
+
+/** @brief Processing statistics of an event type. */
+struct app_event_manager_event_stats {
+	/** Number of dispatched events. */
+	uint32_t dispatch_cnt;
+
+	/** Sum of submit-to-dispatch queueing delays (in cycles). */
+	uint64_t queue_cycles_total;
+
+	/** Maximum submit-to-dispatch queueing delay (in cycles). */
+	uint32_t queue_cycles_max;
+
+	/** Sum of time spent in all of the listeners (in cycles). */
+	uint64_t handler_cycles_total;
+};
+
+/** @brief Processing statistics of a listener subscribed to an event type. */
+struct app_event_manager_listener_stats {
+	/** Number of listener calls. */
+	uint32_t call_cnt;
+
+	/** Sum of time spent in the listener (in cycles). */
+	uint64_t cycles_total;
+
+	/** Maximum time spent in a single listener call (in cycles). */
+	uint32_t cycles_max;
+};
+
+/** @brief Get processing statistics of an event type.
+ *
+ * @note
+ * For this function to be available the
+ * @kconfig{CONFIG_APP_EVENT_MANAGER_STATS} option needs to be enabled.
+ *
+ * @param et     Pointer to the event type.
+ * @param stats  Pointer to the structure to be filled with statistics.
+ */
+void app_event_manager_event_stats_get(const struct event_type *et,
+				       struct app_event_manager_event_stats *stats);
+
+/** @brief Get processing statistics of a listener subscribed to an event type.
+ *
+ * @note
+ * For this function to be available the
+ * @kconfig{CONFIG_APP_EVENT_MANAGER_STATS} option needs to be enabled.
+ *
+ * @param et     Pointer to the event type.
+ * @param el     Pointer to the listener.
+ * @param stats  Pointer to the structure to be filled with statistics.
+ *
+ * @retval 0 If the operation was successful.
+ * @retval -ENOENT If the listener is not subscribed to the event type.
+ * @retval -ENOMEM If the statistics are not tracked for the subscription, because of the
+ *                 @kconfig{CONFIG_APP_EVENT_MANAGER_STATS_SUBSCRIPTION_MAX} limit.
+ */
+int app_event_manager_listener_stats_get(const struct event_type *et,
+					 const struct event_listener *el,
+					 struct app_event_manager_listener_stats *stats);
+
+/** @brief Reset event processing statistics.
+ *
+ * @note
+ * For this function to be available the
+ * @kconfig{CONFIG_APP_EVENT_MANAGER_STATS} option needs to be enabled.
+ */
+void app_event_manager_stats_reset(void);
+
 
 /** @brief Log event.
  *
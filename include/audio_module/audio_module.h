@@ -314,10 +314,12 @@ struct audio_module_handle {
 	/* Number of destination modules. */
 	uint8_t dest_count;
 
-	/* Semaphore to count messages between modules and on a module's TX FIFO. */
-	struct k_sem sem;
+	/* Reference count for each buffer in the data slab, indexed by the buffer's position in
+	 * the slab. A buffer is freed when all modules and the TX FIFO have released it.
+	 */
+	atomic_t data_ref[CONFIG_AUDIO_MODULE_DATA_BLOCKS_MAX];
 
-	/* Mutex to make the above destinations list thread safe. */
+	/* Mutex to serialize connecting and disconnecting of the above destinations list. */
 	struct k_mutex dest_mutex;
 
 	/* Module's thread configuration. */
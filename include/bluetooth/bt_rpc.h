@@ -58,6 +58,76 @@ int bt_rpc_gatt_subscribe_flag_clear(struct bt_gatt_subscribe_params *params, ui
  */
 int bt_rpc_gatt_subscribe_flag_get(struct bt_gatt_subscribe_params *params, uint32_t flags_bit);
 
+/** @brief Store the value of a GATT attribute on the host.
+ *
+ * Available when @kconfig{CONFIG_BT_RPC_GATT_ATTR_CACHE} is enabled.
+ * The host responds to reads of the attribute with the stored value, without
+ * calling the read callback of the attribute on the client, until
+ * @ref bt_rpc_gatt_attr_cache_invalidate is called. Use it for attributes
+ * whose value does not depend on the connection and changes rarely, such as
+ * device information or a HID report map. Call this function again to update
+ * the stored value.
+ *
+ * @param attr  Attribute of a registered service.
+ * @param value Attribute value.
+ * @param len   Length of the attribute value.
+ *
+ * @retval 0 If the operation was successful.
+ * @retval -EINVAL If the attribute does not belong to a registered service.
+ * @retval -ENOMEM If there is no space for the value on the host.
+ */
+int bt_rpc_gatt_attr_cache_set(const struct bt_gatt_attr *attr, const void *value, uint16_t len);
+
+/** @brief Remove the value of a GATT attribute stored on the host.
+ *
+ * Available when @kconfig{CONFIG_BT_RPC_GATT_ATTR_CACHE} is enabled.
+ * Subsequent reads of the attribute call its read callback on the client.
+ *
+ * @param attr Attribute of a registered service.
+ *
+ * @retval 0 If the operation was successful.
+ * @retval -EINVAL If the attribute does not belong to a registered service.
+ */
+int bt_rpc_gatt_attr_cache_invalidate(const struct bt_gatt_attr *attr);
+
+/** @brief Statistics of asynchronous GATT notifications. */
+struct bt_rpc_gatt_notify_stats {
+	/** Number of notifications passed to the host. */
+	uint32_t sent;
+
+	/** Number of notifications that the host failed to send. */
+	uint32_t failed;
+
+	/** Error code of the last failure, or 0 if there was none. */
+	int last_err;
+};
+
+/** @brief Callback type for reporting asynchronous GATT notification failures.
+ *
+ * @param conn   Connection object, or NULL if the notifications were sent to all
+ *               connected peers.
+ * @param err    Error code returned by the host.
+ * @param failed Number of notifications that were not sent.
+ */
+typedef void (*bt_rpc_gatt_notify_error_cb_t)(struct bt_conn *conn, int err, uint16_t failed);
+
+/** @brief Register a callback for asynchronous GATT notification failures.
+ *
+ * Available when @kconfig{CONFIG_BT_RPC_GATT_NOTIFY_ASYNC} is enabled.
+ * The callback is called from the nRF RPC thread.
+ *
+ * @param cb Callback, or NULL to unregister the callback.
+ */
+void bt_rpc_gatt_notify_error_cb_register(bt_rpc_gatt_notify_error_cb_t cb);
+
+/** @brief Get statistics of asynchronous GATT notifications.
+ *
+ * Available when @kconfig{CONFIG_BT_RPC_GATT_NOTIFY_ASYNC} is enabled.
+ *
+ * @param[out] stats Statistics.
+ */
+void bt_rpc_gatt_notify_stats_get(struct bt_rpc_gatt_notify_stats *stats);
+
 #ifdef __cplusplus
 }
 #endif
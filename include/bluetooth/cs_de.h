@@ -91,6 +91,64 @@ typedef struct {
 	uint8_t rtt_count;
 } cs_de_report_t;
 
+/**
+ * @brief IQ values of the tones measured on one antenna path, summed over a procedure
+ *
+ * The values are indexed by channel in the same way as in @ref cs_de_iq_tones_t.
+ * The sums are private to the library.
+ */
+typedef struct {
+	/** Sum of in-phase measurements of tones on this device */
+	int32_t i_local[75];
+	/** Sum of quadrature-phase measurements of tones on this device */
+	int32_t q_local[75];
+	/** Sum of in-phase measurements of tones from remote device */
+	int32_t i_remote[75];
+	/** Sum of quadrature-phase measurements of tones from remote device */
+	int32_t q_remote[75];
+	/** Number of summed measurements */
+	uint16_t count[75];
+} cs_de_iq_sums_t;
+
+/**
+ * @brief Working memory of the IFFT
+ *
+ * The memory is private to the library. Its view depends on the arithmetic
+ * selected with the CONFIG_BT_CS_DE_IFFT_Q31 Kconfig option.
+ */
+typedef union {
+	/** Floating-point view. */
+	float f32[2 * CONFIG_BT_CS_DE_NFFT_SIZE];
+	/** Fixed-point q31 view. */
+	int32_t q31[2 * CONFIG_BT_CS_DE_NFFT_SIZE];
+} cs_de_ifft_scratch_t;
+
+/**
+ * @brief Distance estimation context
+ *
+ * Holds all the state used to estimate the distance from the data of one procedure.
+ * Contexts do not share any memory, so each ranging session can use its own context
+ * at the same time as the other sessions.
+ *
+ * All members except for the report are private to the library.
+ */
+typedef struct {
+	/** Report of the procedure. Complete after @ref cs_de_ctx_calc returns. */
+	cs_de_report_t report;
+
+	/** Channel map of the CS configuration. */
+	uint8_t channel_map[10];
+
+	/** IQ values of the tones added since the last reset. */
+	cs_de_iq_sums_t iq_sums[CONFIG_BT_RAS_MAX_ANTENNA_PATHS];
+
+	/** Working memory of the IFFT. */
+	cs_de_ifft_scratch_t scratch;
+} cs_de_ctx_t;
+
+struct ras_ranging_header;
+struct bt_le_cs_subevent_step;
+
 /**
  * @brief Partially populate the report.
  * This populates the report but does not set the distance estimates and the quality.
@@ -102,9 +160,89 @@ typedef struct {
 void cs_de_populate_report(struct net_buf_simple *local_steps, struct net_buf_simple *peer_steps,
 			   struct bt_conn_le_cs_config *config, cs_de_report_t *p_report);
 
-/* Takes partially populated report and calculates distance estimates and quality. */
+/**
+ * @brief Calculate the distance estimates and quality of a partially populated report.
+ *
+ * @note This function and @ref cs_de_populate_report use static memory,
+ *       so each of them must not be used by more than one thread at a time.
+ *       Use a @ref cs_de_ctx_t for each ranging session instead.
+ *
+ * @param[in,out] p_report Report populated by @ref cs_de_populate_report.
+ *
+ * @return Quality of the distance estimates.
+ */
 cs_de_quality_t cs_de_calc(cs_de_report_t *p_report);
 
+/**
+ * @brief Initialize a distance estimation context.
+ *
+ * The context is reset, ready for the steps of the first procedure.
+ *
+ * @param[out] ctx Context to initialize.
+ * @param[in] config CS config of the local controller.
+ */
+void cs_de_ctx_init(cs_de_ctx_t *ctx, const struct bt_conn_le_cs_config *config);
+
+/**
+ * @brief Remove the data of the previous procedure from a context.
+ *
+ * @param[in,out] ctx Context to reset.
+ */
+void cs_de_ctx_reset(cs_de_ctx_t *ctx);
+
+/**
+ * @brief Add the number of antenna paths from the peer ranging header to a context.
+ *
+ * The function has the signature of the ranging header callback of
+ * @ref bt_ras_rreq_rd_subevent_data_parse. It must be called before the steps are added.
+ *
+ * @param[in] ranging_header Peer ranging header.
+ * @param[in,out] ctx Context of type @ref cs_de_ctx_t.
+ *
+ * @retval true Always, the parsing can continue.
+ */
+bool cs_de_ctx_ranging_header_cb(struct ras_ranging_header *ranging_header, void *ctx);
+
+/**
+ * @brief Add the tones and timings of a step to a context.
+ *
+ * The function has the signature of the step data callback of
+ * @ref bt_ras_rreq_rd_subevent_data_parse. The data is summed as it is added,
+ * so the steps can be added as the subevents arrive and nothing needs to be buffered.
+ *
+ * @param[in] local_step Local step data.
+ * @param[in] peer_step Peer step data.
+ * @param[in,out] ctx Context of type @ref cs_de_ctx_t.
+ *
+ * @retval true Always, the parsing can continue.
+ */
+bool cs_de_ctx_step_data_cb(struct bt_le_cs_subevent_step *local_step,
+			    struct bt_le_cs_subevent_step *peer_step, void *ctx);
+
+/**
+ * @brief Add the steps from the local step data and the peer ranging data to a context.
+ *
+ * The data is added to the data added since the last reset.
+ *
+ * @param[in,out] ctx Context to add the steps to.
+ * @param[in] local_steps Buffer to the local step data to parse.
+ * @param[in] peer_steps Buffer to the peer ranging data to parse.
+ */
+void cs_de_ctx_steps_add(cs_de_ctx_t *ctx, struct net_buf_simple *local_steps,
+			 struct net_buf_simple *peer_steps);
+
+/**
+ * @brief Calculate the distance estimates from the data added to a context.
+ *
+ * The result is stored in the report of the context. The added data is kept
+ * until the context is reset.
+ *
+ * @param[in,out] ctx Context with the data of a procedure.
+ *
+ * @return Quality of the distance estimates.
+ */
+cs_de_quality_t cs_de_ctx_calc(cs_de_ctx_t *ctx);
+
 /**
  * @}
  */
@@ -264,9 +264,11 @@ const struct bt_gatt_dm_attr *bt_gatt_dm_desc_next(
  * This function is asynchronous. Discovery results are passed through
  * the supplied callback.
  *
- * @note Only one discovery procedure can be started simultaneously. To start
- * another one, wait for the result of the previous procedure to finish
- * and call @ref bt_gatt_dm_data_release if it was successful.
+ * @note Only one discovery procedure can be started simultaneously for
+ * a connection. To start another one, wait for the result of the previous
+ * procedure to finish and call @ref bt_gatt_dm_data_release if it was
+ * successful. Procedures on up to @kconfig{CONFIG_BT_GATT_DM_MAX_INSTANCES}
+ * connections can run at the same time.
  *
  * @param[in]     conn Connection object.
  * @param[in]     svc_uuid UUID of target service
@@ -285,6 +287,8 @@ const struct bt_gatt_dm_attr *bt_gatt_dm_desc_next(
  *
  * @retval 0 If the operation was successful.
  *           Otherwise, a (negative) error code is returned.
+ * @retval -EALREADY If a discovery procedure is already running for
+ *                   the connection or all instances are in use.
  */
 int bt_gatt_dm_start(struct bt_conn *conn,
 		     const struct bt_uuid *svc_uuid,
@@ -296,12 +300,18 @@ int bt_gatt_dm_start(struct bt_conn *conn,
  * This function continues service discovery.
  * Call it after the previous data was released by @ref bt_gatt_dm_data_release.
  *
+ * @note An instance whose data was released can be used by
+ * @ref bt_gatt_dm_start for another connection if all other instances are
+ * in use. Continue the discovery before starting it on other connections.
+ *
  * @param[in,out] dm Discovery Manager instance.
  * @param[in]     context Context argument to
  *                be passed to callback functions.
  *
  * @retval 0 If the operation was successful.
  *         Otherwise, a (negative) error code is returned.
+ * @retval -EINVAL If the discovery has ended or the instance was taken
+ *                 by another connection.
  */
 int bt_gatt_dm_continue(struct bt_gatt_dm *dm, void *context);
 
@@ -562,6 +562,47 @@ int bt_scan_blocklist_device_add(const bt_addr_le_t *addr);
  */
 void bt_scan_blocklist_clear(void);
 
+/**@brief Duplicate report statistics.
+ */
+struct bt_scan_dedup_stats {
+	/** Number of reports passed to the filters and the application. */
+	uint32_t passed;
+
+	/** Number of reports suppressed because the advertising data
+	 *  did not change since it was last reported.
+	 */
+	uint32_t duplicates;
+
+	/** Number of reports suppressed because the device was reported
+	 *  less than the minimum report interval ago.
+	 */
+	uint32_t rate_limited;
+
+	/** Number of devices removed from the full cache to make room for
+	 *  a new device.
+	 */
+	uint32_t evictions;
+};
+
+/**@brief Clear the duplicate report cache.
+ *
+ * @details Use this function to forget all devices in the duplicate
+ *          report cache, so that the next report from every device is
+ *          passed to the application. The cache is also cleared when
+ *          scanning is started and when the filters are changed.
+ */
+void bt_scan_dedup_clear(void);
+
+/**@brief Get the duplicate report statistics.
+ *
+ * @param[out] stats Duplicate report statistics.
+ */
+void bt_scan_dedup_stats_get(struct bt_scan_dedup_stats *stats);
+
+/**@brief Reset the duplicate report statistics.
+ */
+void bt_scan_dedup_stats_reset(void);
+
 /**@brief Function to update the autoconnect flag after a filter match.
  *
  * @note The function should not be used when scanning is active.
@@ -31,14 +31,63 @@ struct data_fifo_msgq {
 	size_t size;
 };
 
+/** Per-instance statistics, see @ref data_fifo_stats_get. */
+struct data_fifo_stats {
+	/** Number of blocks handed out to the producer. */
+	uint32_t alloc_cnt;
+	/** Number of times no vacant block was available within the timeout. */
+	uint32_t alloc_fail_cnt;
+	/** Number of blocks submitted by the producer. */
+	uint32_t lock_cnt;
+	/** Number of filled blocks handed out to the consumer. */
+	uint32_t get_cnt;
+	/** Number of times no filled block was available within the timeout. */
+	uint32_t get_fail_cnt;
+	/** Highest number of filled blocks waiting for the consumer. */
+	uint32_t locked_max;
+};
+
+#if defined(CONFIG_DATA_FIFO_SPSC)
+/* Ring state of a single-producer/single-consumer data_fifo. The counters run from 0 to
+ * 2 * elements_max - 1, so a full ring can be told apart from an empty one. The producer owns
+ * alloc_idx and lock_idx, and the consumer owns get_idx and free_idx.
+ */
+struct data_fifo_spsc {
+	atomic_t alloc_idx;
+	atomic_t lock_idx;
+	atomic_t get_idx;
+	atomic_t free_idx;
+	/* Set by a side that waits for the other, so the semaphores are only given when needed */
+	atomic_t producer_waiting;
+	atomic_t consumer_waiting;
+	struct k_sem vacant_sem;
+	struct k_sem filled_sem;
+};
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
 struct data_fifo {
 	char *msgq_buffer;
 	char *slab_buffer;
 	struct k_mem_slab mem_slab;
 	struct k_msgq msgq;
+	struct k_spinlock lock;
 	uint32_t elements_max;
 	size_t block_size_max;
 	bool initialized;
+#if defined(CONFIG_DATA_FIFO_SPSC)
+	bool spsc;
+	struct data_fifo_spsc ring;
+#endif
+#if defined(CONFIG_DATA_FIFO_STATS)
+	struct {
+		atomic_t alloc_cnt;
+		atomic_t alloc_fail_cnt;
+		atomic_t lock_cnt;
+		atomic_t get_cnt;
+		atomic_t get_fail_cnt;
+		atomic_t locked_max;
+	} stats;
+#endif
 };
 
 #define DATA_FIFO_DEFINE(name, elements_max_in, block_size_max_in)                                 \
@@ -52,6 +101,38 @@ struct data_fifo {
 				 .elements_max = elements_max_in,                                  \
 				 .initialized = false}
 
+#if defined(CONFIG_DATA_FIFO_SPSC)
+/**
+ * @brief Define a single-producer/single-consumer data_fifo.
+ *
+ * The data_fifo is used with the same API as one defined with @ref DATA_FIFO_DEFINE, but is
+ * implemented as a ring of blocks with atomic indices instead of a memory slab and a message
+ * queue. Kernel objects are only used when a call waits for the other side.
+ *
+ * The following restrictions apply:
+ * - There is one producer and one consumer context, which may be an ISR.
+ * - Blocks are locked in the order they were obtained by
+ *   @ref data_fifo_pointer_first_vacant_get.
+ * - Blocks are freed in the order they were obtained by
+ *   @ref data_fifo_pointer_last_filled_get.
+ * - @ref data_fifo_empty and @ref data_fifo_uninit are not called while the data_fifo is in
+ *   use by the producer or consumer.
+ *
+ * @note Requires @kconfig{CONFIG_DATA_FIFO_SPSC}.
+ */
+#define DATA_FIFO_SPSC_DEFINE(name, elements_max_in, block_size_max_in)                            \
+	char __aligned(WB_UP(                                                                      \
+		1)) _msgq_buffer_##name[(elements_max_in) * sizeof(struct data_fifo_msgq)] = {0};  \
+	char __aligned(WB_UP(1)) _slab_buffer_##name[(elements_max_in) * (block_size_max_in)] = {  \
+		0};                                                                                \
+	struct data_fifo name = {.msgq_buffer = _msgq_buffer_##name,                               \
+				 .slab_buffer = _slab_buffer_##name,                               \
+				 .block_size_max = block_size_max_in,                              \
+				 .elements_max = elements_max_in,                                  \
+				 .initialized = false,                                             \
+				 .spsc = true}
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
 /**
  * @brief Get pointer to the first vacant block in slab.
  *
@@ -150,6 +231,25 @@ int data_fifo_num_used_get(struct data_fifo *data_fifo, uint32_t *alloced_num,
  */
 int data_fifo_empty(struct data_fifo *data_fifo);
 
+/**
+ * @brief Get the statistics of a data_fifo.
+ *
+ * @note Requires @kconfig{CONFIG_DATA_FIFO_STATS}.
+ *
+ * @param data_fifo Pointer to the data_fifo structure.
+ * @param stats Pointer to the structure the statistics are written to.
+ */
+void data_fifo_stats_get(struct data_fifo *data_fifo, struct data_fifo_stats *stats);
+
+/**
+ * @brief Reset the statistics of a data_fifo.
+ *
+ * @note Requires @kconfig{CONFIG_DATA_FIFO_STATS}.
+ *
+ * @param data_fifo Pointer to the data_fifo structure.
+ */
+void data_fifo_stats_reset(struct data_fifo *data_fifo);
+
 /**
  * @brief Deinitialize data_fifo.
  *
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef NRF_RPC_BUF_H_
+#define NRF_RPC_BUF_H_
+
+#include <zephyr/kernel.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrf_rpc_buf nRF RPC transport buffers
+ * @brief Allocator of the nRF RPC transport buffers.
+ *
+ * When @kconfig{CONFIG_NRF_RPC_BUF_POOL} is enabled, buffers are taken from
+ * memory slabs of a few size classes, and only buffers larger than the largest
+ * class are allocated from the system heap. Otherwise, all buffers are
+ * allocated from the system heap.
+ *
+ * @{
+ */
+
+/** @brief Number of buffer size classes. */
+#define NRF_RPC_BUF_CLASS_COUNT 3
+
+/** @brief Usage statistics of a buffer size class. */
+struct nrf_rpc_buf_class_stats {
+	/** Size of the buffers in the class. */
+	uint16_t size;
+
+	/** Number of buffers in the class. */
+	uint16_t count;
+
+	/** Number of buffers currently in use. */
+	uint16_t used;
+
+	/** Maximum number of buffers in use at the same time. */
+	uint16_t max_used;
+
+	/** Number of successful allocations. */
+	uint32_t allocs;
+};
+
+/** @brief Usage statistics of the nRF RPC transport buffers. */
+struct nrf_rpc_buf_stats {
+	/** Statistics of each size class, from the smallest to the largest. */
+	struct nrf_rpc_buf_class_stats classes[NRF_RPC_BUF_CLASS_COUNT];
+
+	/** Number of buffers allocated from the system heap. */
+	uint32_t heap_allocs;
+
+	/** Number of buffers currently allocated from the system heap. */
+	uint32_t heap_used;
+
+	/** Number of failed allocations. */
+	uint32_t failures;
+};
+
+#if defined(CONFIG_NRF_RPC_BUF_POOL) || defined(__DOXYGEN__)
+
+/**
+ * @brief Time that a transport waits for a buffer of an outgoing packet.
+ *
+ * Set with @kconfig{CONFIG_NRF_RPC_BUF_POOL_ALLOC_TIMEOUT}. Without the pool, buffers
+ * are allocated from the system heap without waiting.
+ */
+#define NRF_RPC_BUF_TX_ALLOC_TIMEOUT K_MSEC(CONFIG_NRF_RPC_BUF_POOL_ALLOC_TIMEOUT)
+
+/**
+ * @brief Allocate a transport buffer.
+ *
+ * The buffer is taken from the smallest size class that fits @p size and has
+ * a free buffer. If none does, the buffer is allocated from the system heap,
+ * provided that @kconfig{CONFIG_NRF_RPC_BUF_POOL_HEAP_FALLBACK} is enabled.
+ * If that fails too, the function waits for a buffer of the smallest size class
+ * that fits @p size to be freed.
+ *
+ * @param size Requested buffer size.
+ * @param timeout Time to wait for a buffer to be freed. Must be K_NO_WAIT in an ISR.
+ *
+ * @return Pointer to the buffer, or NULL if there is no memory available.
+ */
+void *nrf_rpc_buf_alloc(size_t size, k_timeout_t timeout);
+
+/**
+ * @brief Free a transport buffer.
+ *
+ * @param buf Buffer returned by @ref nrf_rpc_buf_alloc, or NULL.
+ */
+void nrf_rpc_buf_free(void *buf);
+
+/**
+ * @brief Get the usage statistics of the transport buffers.
+ *
+ * @param[out] stats Statistics.
+ */
+void nrf_rpc_buf_stats_get(struct nrf_rpc_buf_stats *stats);
+
+/**
+ * @brief Reset the counters of the usage statistics.
+ *
+ * The number of buffers in use is not changed, and the maximum number of buffers
+ * in use is set to it.
+ */
+void nrf_rpc_buf_stats_reset(void);
+
+#else
+
+#define NRF_RPC_BUF_TX_ALLOC_TIMEOUT K_NO_WAIT
+
+static inline void *nrf_rpc_buf_alloc(size_t size, k_timeout_t timeout)
+{
+	ARG_UNUSED(timeout);
+
+	return k_malloc(size);
+}
+
+static inline void nrf_rpc_buf_free(void *buf)
+{
+	k_free(buf);
+}
+
+#endif /* defined(CONFIG_NRF_RPC_BUF_POOL) || defined(__DOXYGEN__) */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_RPC_BUF_H_ */
@@ -18,6 +18,8 @@
 #include <zephyr/sys/util.h>
 #include <nrf_rpc_cbor.h>
 
+#include <string.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -65,6 +67,73 @@ static inline void *nrf_rpc_scratchpad_add(struct nrf_rpc_scratchpad *scratchpad
 	return net_buf_simple_add(&scratchpad->buf, NRF_RPC_SCRATCHPAD_ALIGN(size));
 }
 
+/** @brief Get the encoded size of a CBOR item head.
+ *
+ * The head holds the major type and the argument of an item, that is the value
+ * of an integer, or the length of a byte or text string. Evaluates to a constant
+ * when @p arg is a constant.
+ *
+ * @param[in] arg Argument of the item.
+ *
+ * @retval The number of bytes the head takes in the CBOR stream.
+ */
+#define NRF_RPC_CBOR_HEAD_SIZE(arg)                                                                \
+	((uint64_t)(arg) < 24 ? 1 :                                                                \
+	 (uint64_t)(arg) <= UINT8_MAX ? 2 :                                                        \
+	 (uint64_t)(arg) <= UINT16_MAX ? 3 :                                                       \
+	 (uint64_t)(arg) <= UINT32_MAX ? 5 : 9)
+
+/** @brief Get the encoded size of an unsigned integer value. */
+#define NRF_RPC_CBOR_UINT_SIZE(value) NRF_RPC_CBOR_HEAD_SIZE(value)
+
+/** @brief Get the encoded size of a signed integer value. */
+#define NRF_RPC_CBOR_INT_SIZE(value)                                                               \
+	((int64_t)(value) < 0 ? NRF_RPC_CBOR_HEAD_SIZE(-1 - (int64_t)(value))                      \
+			      : NRF_RPC_CBOR_HEAD_SIZE(value))
+
+/** @brief Get the maximum encoded size of any value of an integer type. */
+#define NRF_RPC_CBOR_INT_MAX_SIZE(type) (1 + sizeof(type))
+
+/** @brief Encoded size of a null, undefined or boolean value. */
+#define NRF_RPC_CBOR_SIMPLE_SIZE 1
+
+/** @brief Maximum encoded size of a callback. */
+#define NRF_RPC_CBOR_CALLBACK_MAX_SIZE NRF_RPC_CBOR_INT_MAX_SIZE(int32_t)
+
+/** @brief Get the encoded size of a non-null buffer or string of a given length. */
+#define NRF_RPC_CBOR_BUFFER_SIZE(size) (NRF_RPC_CBOR_HEAD_SIZE(size) + (size))
+
+/** @brief Get the encoded size of a buffer.
+ *
+ * Use it together with the other size helpers to compute the exact size of a packet
+ * before allocating it with NRF_RPC_CBOR_ALLOC.
+ *
+ * @param[in] data Buffer to encode, or NULL.
+ * @param[in] size Buffer size.
+ *
+ * @retval The number of bytes @ref nrf_rpc_encode_buffer writes.
+ */
+static inline size_t nrf_rpc_encode_buffer_size(const void *data, size_t size)
+{
+	return data ? NRF_RPC_CBOR_BUFFER_SIZE(size) : NRF_RPC_CBOR_SIMPLE_SIZE;
+}
+
+/** @brief Get the encoded size of a string.
+ *
+ * @param[in] value String to encode, or NULL.
+ * @param[in] len String length, or a negative value if the string is null-terminated.
+ *
+ * @retval The number of bytes @ref nrf_rpc_encode_str writes.
+ */
+static inline size_t nrf_rpc_encode_str_size(const char *value, int len)
+{
+	if (!value) {
+		return NRF_RPC_CBOR_SIMPLE_SIZE;
+	}
+
+	return NRF_RPC_CBOR_BUFFER_SIZE(len < 0 ? strlen(value) : (size_t)len);
+}
+
 /** @brief Encode a null value.
  *
  * @param[in,out] ctx Structure used to encode CBOR stream.
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef NRF_RPC_THREAD_POOL_H_
+#define NRF_RPC_THREAD_POOL_H_
+
+#include <nrf_rpc.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/iterable_sections.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrf_rpc_thread_pool nRF RPC thread pools
+ * @brief Threads that execute the commands and events received by nRF RPC groups.
+ *
+ * By default, all received commands and events are executed by a single pool of
+ * @kconfig{CONFIG_NRF_RPC_THREAD_POOL_SIZE} threads. A group can be given its own pool
+ * using @ref NRF_RPC_THREAD_POOL_DEFINE, so that long-running commands of other groups
+ * do not delay its commands and events.
+ *
+ * @{
+ */
+
+/** @brief Usage statistics of a thread pool. */
+struct nrf_rpc_thread_pool_stats {
+	/** Number of commands and events passed to the pool. */
+	uint32_t packets;
+
+	/** Average time between receiving a packet and a pool thread starting to execute it. */
+	uint32_t delay_avg_us;
+
+	/** Maximum time between receiving a packet and a pool thread starting to execute it. */
+	uint32_t delay_max_us;
+
+	/** Maximum number of pool threads busy at the same time. */
+	uint8_t busy_max;
+};
+
+/** @cond INTERNAL_HIDDEN */
+
+/* The queue of each pool fits as many packets as there are nRF RPC contexts, which bounds the
+ * number of commands that a peer with the same configuration can have in progress. A packet that
+ * does not fit is dropped, because the receiving thread must never wait for a pool thread.
+ */
+#define NRF_RPC_THREAD_POOL_QUEUE_LEN CONFIG_NRF_RPC_CMD_CTX_POOL_SIZE
+
+struct nrf_rpc_thread_pool_msg {
+	const uint8_t *data;
+	size_t len;
+	uint32_t timestamp;
+};
+
+struct nrf_rpc_thread_pool_data {
+	struct k_msgq msgq;
+	struct k_spinlock lock;
+	uint8_t busy;
+	uint8_t busy_max;
+	uint32_t packets;
+	uint64_t delay_sum;
+	uint32_t delay_max;
+};
+
+struct nrf_rpc_thread_pool {
+	const struct nrf_rpc_group *group;
+	struct nrf_rpc_thread_pool_data *data;
+	struct k_thread *threads;
+	k_thread_stack_t *stacks;
+	size_t stack_len;
+	size_t stack_size;
+	char *msgq_buf;
+	uint8_t msgq_len;
+	uint8_t threads_num;
+};
+
+/** @endcond */
+
+/**
+ * @brief Define a thread pool of an nRF RPC group.
+ *
+ * Commands and events received by the group are executed by the threads of this pool
+ * instead of the default pool. Each thread holds an nRF RPC context while it executes a
+ * command, so @kconfig{CONFIG_NRF_RPC_CMD_CTX_POOL_SIZE} must account for the threads of
+ * all pools.
+ *
+ * @param _name       Name of the pool.
+ * @param _group      Name of the group, as passed to NRF_RPC_GROUP_DEFINE.
+ * @param _threads    Number of threads in the pool.
+ * @param _stack_size Stack size of each thread.
+ */
+#define NRF_RPC_THREAD_POOL_DEFINE(_name, _group, _threads, _stack_size)                           \
+	BUILD_ASSERT((_threads) > 0 && (_threads) <= UINT8_MAX, "Invalid number of threads");     \
+	static K_THREAD_STACK_ARRAY_DEFINE(_name##_stacks, _threads, _stack_size);                 \
+	static struct k_thread _name##_threads[_threads];                                          \
+	static char __aligned(4)                                                                   \
+		_name##_msgq_buf[NRF_RPC_THREAD_POOL_QUEUE_LEN *                                   \
+				 sizeof(struct nrf_rpc_thread_pool_msg)];                          \
+	static struct nrf_rpc_thread_pool_data _name##_data;                                       \
+	const STRUCT_SECTION_ITERABLE(nrf_rpc_thread_pool, _name) = {                              \
+		.group = &_group,                                                                  \
+		.data = &_name##_data,                                                             \
+		.threads = _name##_threads,                                                        \
+		.stacks = (k_thread_stack_t *)_name##_stacks,                                      \
+		.stack_len = K_THREAD_STACK_LEN(_stack_size),                                      \
+		.stack_size = K_THREAD_STACK_SIZEOF(_name##_stacks[0]),                            \
+		.msgq_buf = _name##_msgq_buf,                                                      \
+		.msgq_len = NRF_RPC_THREAD_POOL_QUEUE_LEN,                                         \
+		.threads_num = (_threads),                                                         \
+	}
+
+#if defined(CONFIG_NRF_RPC_THREAD_POOL_STATS) || defined(__DOXYGEN__)
+
+/**
+ * @brief Get the usage statistics of the thread pool of a group.
+ *
+ * @param group nRF RPC group, or NULL for the default pool.
+ * @param[out] stats Statistics of the pool that executes the commands and events of the group.
+ */
+void nrf_rpc_thread_pool_stats_get(const struct nrf_rpc_group *group,
+				   struct nrf_rpc_thread_pool_stats *stats);
+
+/**
+ * @brief Reset the usage statistics of all thread pools.
+ */
+void nrf_rpc_thread_pool_stats_reset(void);
+
+#endif /* defined(CONFIG_NRF_RPC_THREAD_POOL_STATS) || defined(__DOXYGEN__) */
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_RPC_THREAD_POOL_H_ */
@@ -52,6 +52,7 @@ extern void nrf_rpc_uart_initialized_hook(const struct device *uart_dev);
 	extern const struct nrf_rpc_tr NRF_RPC_UART_TRANSPORT(node_id);
 
 DT_FOREACH_STATUS_OKAY(nordic_nrf_uarte, _NRF_RPC_UART_TRANSPORT_DECLARE);
+DT_FOREACH_STATUS_OKAY(zephyr_uart_emul, _NRF_RPC_UART_TRANSPORT_DECLARE);
 
 #ifdef __cplusplus
 }
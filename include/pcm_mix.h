@@ -52,6 +52,30 @@ enum pcm_mix_mode {
 int pcm_mix(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
 	    enum pcm_mix_mode mix_mode);
 
+/**
+ * @brief Mixes two buffers of PCM data with the given bit depth.
+ *
+ * @note Same as @ref pcm_mix, but for other sample formats. The supported formats are
+ * 16-bit samples, 24-bit samples carried in 32 bits, and 32-bit samples. The result is
+ * clipped to the range of the bit depth. 24-bit samples must be sign-extended to 32 bits.
+ *
+ * @param pcm_a             [in/out] Pointer to the PCM data buffer A.
+ * @param size_a            [in]     Size of the PCM data buffer A (in bytes).
+ * @param pcm_b             [in]     Pointer to the PCM data buffer B.
+ * @param size_b            [in]     Size of the PCM data buffer B (in bytes).
+ * @param mix_mode          [in]     Mixing mode according to pcm_mix_mode.
+ * @param pcm_bit_depth     [in]     Bit depth of the PCM samples (16, 24, or 32).
+ * @param carrier_bit_depth [in]     Number of bits used to carry a sample (16 or 32).
+ *
+ * @retval 0            Success. Result stored in pcm_a.
+ * @retval -EINVAL      pcm_a is NULL, size_a = 0 or unsupported bit depth.
+ * @retval -EPERM       Either size_b < size_a (for stereo to stereo, mono to mono)
+ *			or size_a/2 < size_b (for mono to stereo mix).
+ * @retval -ESRCH       Invalid mixing mode.
+ */
+int pcm_mix_ext(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
+		enum pcm_mix_mode mix_mode, uint8_t pcm_bit_depth, uint8_t carrier_bit_depth);
+
 /**
  * @}
  */
@@ -172,6 +172,204 @@ int sample_rate_converter_process(struct sample_rate_converter_ctx *ctx,
 				  size_t output_size, size_t *output_written,
 				  uint32_t output_sample_rate);
 
+/**
+ * Maximum number of samples per channel kept between process calls by the multichannel sample
+ * rate converter. This is the filter history, plus the delay the single-channel converter adds
+ * through input buffering.
+ */
+#define SAMPLE_RATE_CONVERTER_MC_HISTORY_SIZE                                                      \
+	(CONFIG_SAMPLE_RATE_CONVERTER_MAX_FILTER_SIZE - 1 +                                        \
+	 SAMPLE_RATE_CONVERTER_INPUT_BUFFER_NUMBER_OVERFLOW_SAMPLES)
+
+/** Context for the multichannel sample rate conversion */
+struct sample_rate_converter_mc_ctx {
+	/* Input and output sample rate to be used for the conversion. */
+	uint32_t sample_rate_input;
+	uint32_t sample_rate_output;
+
+	/* The ratio for the current conversion. When the conversion is upsampling the ratio is
+	 * positive and negative when downsampling.
+	 */
+	int conversion_ratio;
+
+	/* Filter type to be used for the conversion. */
+	enum sample_rate_converter_filter filter_type;
+
+	/* Number of interleaved channels in the stream. */
+	uint8_t channels;
+
+	/* Filter coefficients, shared by all channels. */
+	void const *filter_coeffs;
+	size_t filter_size;
+
+	/* Number of history samples per channel and the delay of the stream in input samples. */
+	size_t history_size;
+	size_t delay;
+
+	/* Per-channel stream history, oldest sample first. */
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+	q15_t history_15[CONFIG_SAMPLE_RATE_CONVERTER_CHANNELS_MAX]
+			[SAMPLE_RATE_CONVERTER_MC_HISTORY_SIZE];
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+	q31_t history_31[CONFIG_SAMPLE_RATE_CONVERTER_CHANNELS_MAX]
+			[SAMPLE_RATE_CONVERTER_MC_HISTORY_SIZE];
+#endif
+};
+
+/**
+ * @brief	Open the multichannel sample rate converter for a new context.
+ *
+ * @details	Sets the entire context to 0 and sets the number of channels. This should be done
+ *		before a context is used with a new stream, and does not need to be called if the
+ *		sample rates or filter change during the stream.
+ *
+ * @param[out]	ctx		Pointer to the multichannel sample rate conversion context.
+ * @param[in]	channels	Number of interleaved channels in the stream.
+ *
+ * @retval	0	On success.
+ * @retval	-EINVAL	NULL pointer given for context or invalid number of channels.
+ */
+int sample_rate_converter_mc_open(struct sample_rate_converter_mc_ctx *ctx, uint8_t channels);
+
+/**
+ * @brief	Process interleaved input frames and produce interleaved output frames with new
+ *		sample rate.
+ *
+ * @details	Works as @ref sample_rate_converter_process, but on all channels of an interleaved
+ *		stream in a single call. The samples are filtered directly from the input to the
+ *		output buffer, and the output of every channel is bit-exact to the output of a
+ *		single-channel context processing the same channel.
+ *
+ * @param[in,out]	ctx			Pointer to the multichannel conversion context.
+ * @param[in]		filter			Filter type to be used for the conversion.
+ * @param[in]		input			Pointer to interleaved frames to process.
+ * @param[in]		input_size		Size of the input in bytes.
+ * @param[in]		input_sample_rate	Sample rate of the input frames.
+ * @param[out]		output			Array that interleaved output will be written.
+ * @param[in]		output_size		Size of the output array in bytes.
+ * @param[out]		output_written		Number of bytes written to output.
+ * @param[in]		output_sample_rate	Sample rate of output.
+ *
+ * @retval	0	On success.
+ * @retval	-EINVAL	Invalid parameters for sample rate conversion.
+ */
+int sample_rate_converter_mc_process(struct sample_rate_converter_mc_ctx *ctx,
+				     enum sample_rate_converter_filter filter,
+				     void const *const input, size_t input_size,
+				     uint32_t input_sample_rate, void *const output,
+				     size_t output_size, size_t *output_written,
+				     uint32_t output_sample_rate);
+
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_FRACTIONAL
+/** Number of samples kept between process calls by the fractional sample rate converter. */
+#define SAMPLE_RATE_CONVERTER_FRAC_HISTORY_SIZE (CONFIG_SAMPLE_RATE_CONVERTER_FRACTIONAL_TAPS - 1)
+
+/** Maximum ratio adjustment of the fractional sample rate converter, in parts per billion. */
+#define SAMPLE_RATE_CONVERTER_FRAC_ADJUST_PPB_MAX 100000000
+
+/** Context for the fractional sample rate conversion */
+struct sample_rate_converter_frac_ctx {
+	/* Input and output sample rate to be used for the conversion. */
+	uint32_t sample_rate_input;
+	uint32_t sample_rate_output;
+
+	/* Nominal and current distance between output samples, in input samples (Q32.32). */
+	uint64_t step_nominal;
+	uint64_t step;
+
+	/* Position of the next output sample relative to the oldest sample in the work buffer
+	 * (Q32.32).
+	 */
+	uint64_t position;
+
+	/* Polyphase filter coefficients, stored per phase in reversed order, and the work buffer
+	 * holding the stream history followed by the samples being processed.
+	 */
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+	q15_t coeffs_15[CONFIG_SAMPLE_RATE_CONVERTER_FRACTIONAL_PHASES]
+		       [CONFIG_SAMPLE_RATE_CONVERTER_FRACTIONAL_TAPS];
+	q15_t work_buf_15[SAMPLE_RATE_CONVERTER_FRAC_HISTORY_SIZE +
+			  CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX];
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+	q31_t coeffs_31[CONFIG_SAMPLE_RATE_CONVERTER_FRACTIONAL_PHASES]
+		       [CONFIG_SAMPLE_RATE_CONVERTER_FRACTIONAL_TAPS];
+	q31_t work_buf_31[SAMPLE_RATE_CONVERTER_FRAC_HISTORY_SIZE +
+			  CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX];
+#endif
+};
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_FRACTIONAL */
+
+/**
+ * @brief	Open the fractional sample rate converter for a new stream.
+ *
+ * @details	Calculates the polyphase filter for the given sample rates and resets the stream
+ *		history. Any ratio between the input and output sample rate is supported, with the
+ *		filter cut-off set below the Nyquist frequency of the lower sample rate.
+ *
+ * @note	Requires @kconfig{CONFIG_SAMPLE_RATE_CONVERTER_FRACTIONAL}.
+ *
+ * @param[out]	ctx			Pointer to the fractional sample rate conversion context.
+ * @param[in]	sample_rate_input	Sample rate of the input samples.
+ * @param[in]	sample_rate_output	Sample rate of the output samples.
+ *
+ * @retval	0	On success.
+ * @retval	-EINVAL	NULL pointer given for context or invalid sample rates.
+ */
+int sample_rate_converter_frac_open(struct sample_rate_converter_frac_ctx *ctx,
+				    uint32_t sample_rate_input, uint32_t sample_rate_output);
+
+/**
+ * @brief	Process input samples and produce output samples with new sample rate.
+ *
+ * @details	As the ratio between the sample rates is not an integer, the number of output
+ *		samples differs between calls. Use @ref sample_rate_converter_frac_output_size to
+ *		get the number of bytes the call will produce.
+ *
+ * @param[in,out]	ctx		Pointer to the fractional sample rate conversion context.
+ * @param[in]		input		Pointer to samples to process.
+ * @param[in]		input_size	Size of the input in bytes.
+ * @param[out]		output		Array that output will be written.
+ * @param[in]		output_size	Size of the output array in bytes.
+ * @param[out]		output_written	Number of bytes written to output.
+ *
+ * @retval	0	On success.
+ * @retval	-EINVAL	Invalid parameters or the output array is too small.
+ */
+int sample_rate_converter_frac_process(struct sample_rate_converter_frac_ctx *ctx,
+				       void const *const input, size_t input_size,
+				       void *const output, size_t output_size,
+				       size_t *output_written);
+
+/**
+ * @brief	Get the number of bytes the next process call will produce.
+ *
+ * @param[in]	ctx		Pointer to the fractional sample rate conversion context.
+ * @param[in]	input_size	Size of the input in bytes.
+ *
+ * @return	Number of output bytes.
+ */
+size_t sample_rate_converter_frac_output_size(struct sample_rate_converter_frac_ctx const *ctx,
+					      size_t input_size);
+
+/**
+ * @brief	Adjust the conversion ratio of a running stream.
+ *
+ * @details	Used for asynchronous sample rate conversion, where the ratio is continuously
+ *		corrected by a control loop to compensate for drift between the input and output
+ *		clocks. A positive adjustment makes the converter consume the input faster, that
+ *		is, produce fewer output samples for the same input. The adjustment is relative to
+ *		the nominal ratio given in @ref sample_rate_converter_frac_open and takes effect
+ *		from the next output sample.
+ *
+ * @param[in,out]	ctx		Pointer to the fractional sample rate conversion context.
+ * @param[in]		adjust_ppb	Ratio adjustment in parts per billion.
+ *
+ * @retval	0	On success.
+ * @retval	-EINVAL	NULL pointer given for context or adjustment out of range.
+ */
+int sample_rate_converter_frac_adjust(struct sample_rate_converter_frac_ctx *ctx,
+				      int32_t adjust_ppb);
+
 /**
  * @}
  */
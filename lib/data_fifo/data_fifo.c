@@ -8,10 +8,52 @@
 
 #include <zephyr/kernel.h>
 
+#if defined(CONFIG_DATA_FIFO_SPSC)
+#include "data_fifo_spsc.h"
+#endif
+
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(data_fifo, CONFIG_DATA_FIFO_LOG_LEVEL);
 
-static struct k_spinlock lock;
+static inline bool is_spsc(struct data_fifo *data_fifo)
+{
+#if defined(CONFIG_DATA_FIFO_SPSC)
+	return data_fifo->spsc;
+#else
+	return false;
+#endif
+}
+
+#if defined(CONFIG_DATA_FIFO_STATS)
+#define STATS_INC(data_fifo, counter) atomic_inc(&(data_fifo)->stats.counter)
+
+static void stats_locked_update(struct data_fifo *data_fifo)
+{
+	uint32_t alloced_num;
+	uint32_t locked_num;
+	atomic_val_t locked_max;
+
+#if defined(CONFIG_DATA_FIFO_SPSC)
+	if (is_spsc(data_fifo)) {
+		data_fifo_spsc_num_used_get(data_fifo, &alloced_num, &locked_num);
+	} else {
+		locked_num = k_msgq_num_used_get(&data_fifo->msgq);
+	}
+#else
+	ARG_UNUSED(alloced_num);
+	locked_num = k_msgq_num_used_get(&data_fifo->msgq);
+#endif
+
+	do {
+		locked_max = atomic_get(&data_fifo->stats.locked_max);
+		if (locked_num <= locked_max) {
+			break;
+		}
+	} while (!atomic_cas(&data_fifo->stats.locked_max, locked_max, locked_num));
+}
+#else
+#define STATS_INC(data_fifo, counter)
+#endif /* CONFIG_DATA_FIFO_STATS */
 
 /** @brief Checks that the elements in the msgq and slab are legal.
  * I.e. the number of msgq elements cannot be more than mem blocks used.
@@ -20,12 +62,12 @@ static int msgq_slab_legal_used_elements(struct data_fifo *data_fifo, uint32_t *
 					 uint32_t *slab_blocks_num_used_in)
 {
 	/* Lock so msgq and slab reads are in sync */
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	k_spinlock_key_t key = k_spin_lock(&data_fifo->lock);
 
 	uint32_t msgq_num_used = k_msgq_num_used_get(&data_fifo->msgq);
 	uint32_t slab_blocks_num_used = k_mem_slab_num_used_get(&data_fifo->mem_slab);
 
-	k_spin_unlock(&lock, key);
+	k_spin_unlock(&data_fifo->lock, key);
 
 	if (slab_blocks_num_used < msgq_num_used) {
 		LOG_ERR("Num used mgsq %d cannot be larger than used blocks %d", msgq_num_used,
@@ -48,7 +90,22 @@ int data_fifo_pointer_first_vacant_get(struct data_fifo *data_fifo, void **data,
 	__ASSERT_NO_MSG(data_fifo->initialized);
 	int ret;
 
+#if defined(CONFIG_DATA_FIFO_SPSC)
+	if (is_spsc(data_fifo)) {
+		ret = data_fifo_spsc_pointer_first_vacant_get(data_fifo, data, timeout);
+	} else {
+		ret = k_mem_slab_alloc(&data_fifo->mem_slab, data, timeout);
+	}
+#else
 	ret = k_mem_slab_alloc(&data_fifo->mem_slab, data, timeout);
+#endif
+
+	if (ret) {
+		STATS_INC(data_fifo, alloc_fail_cnt);
+	} else {
+		STATS_INC(data_fifo, alloc_cnt);
+	}
+
 	return ret;
 }
 
@@ -66,6 +123,21 @@ int data_fifo_block_lock(struct data_fifo *data_fifo, void **data, size_t size)
 		return -EINVAL;
 	}
 
+#if defined(CONFIG_DATA_FIFO_SPSC)
+	if (is_spsc(data_fifo)) {
+		ret = data_fifo_spsc_block_lock(data_fifo, data, size);
+		if (ret) {
+			return ret;
+		}
+
+		STATS_INC(data_fifo, lock_cnt);
+#if defined(CONFIG_DATA_FIFO_STATS)
+		stats_locked_update(data_fifo);
+#endif
+		return 0;
+	}
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
 	struct data_fifo_msgq msgq_tmp;
 
 	msgq_tmp.block_ptr = *data;
@@ -81,6 +153,11 @@ int data_fifo_block_lock(struct data_fifo *data_fifo, void **data, size_t size)
 		return -ESPIPE;
 	}
 
+	STATS_INC(data_fifo, lock_cnt);
+#if defined(CONFIG_DATA_FIFO_STATS)
+	stats_locked_update(data_fifo);
+#endif
+
 	return 0;
 }
 
@@ -91,13 +168,29 @@ int data_fifo_pointer_last_filled_get(struct data_fifo *data_fifo, void **data,
 	__ASSERT_NO_MSG(data_fifo->initialized);
 	int ret;
 
+#if defined(CONFIG_DATA_FIFO_SPSC)
+	if (is_spsc(data_fifo)) {
+		ret = data_fifo_spsc_pointer_last_filled_get(data_fifo, data, size, timeout);
+		if (ret) {
+			STATS_INC(data_fifo, get_fail_cnt);
+		} else {
+			STATS_INC(data_fifo, get_cnt);
+		}
+
+		return ret;
+	}
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
 	struct data_fifo_msgq msgq_tmp;
 
 	ret = k_msgq_get(&data_fifo->msgq, &msgq_tmp, timeout);
 	if (ret) {
+		STATS_INC(data_fifo, get_fail_cnt);
 		return ret;
 	}
 
+	STATS_INC(data_fifo, get_cnt);
+
 	*data = msgq_tmp.block_ptr;
 	*size = msgq_tmp.size;
 	return 0;
@@ -108,6 +201,13 @@ void data_fifo_block_free(struct data_fifo *data_fifo, void *data)
 	__ASSERT_NO_MSG(data_fifo != NULL);
 	__ASSERT_NO_MSG(data_fifo->initialized);
 
+#if defined(CONFIG_DATA_FIFO_SPSC)
+	if (is_spsc(data_fifo)) {
+		data_fifo_spsc_block_free(data_fifo, data);
+		return;
+	}
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
 	k_mem_slab_free(&data_fifo->mem_slab, data);
 }
 
@@ -120,6 +220,13 @@ int data_fifo_num_used_get(struct data_fifo *data_fifo, uint32_t *alloced_num, u
 	uint32_t msgq_num_used = UINT32_MAX;
 	uint32_t slab_blocks_num_used = UINT32_MAX;
 
+#if defined(CONFIG_DATA_FIFO_SPSC)
+	if (is_spsc(data_fifo)) {
+		data_fifo_spsc_num_used_get(data_fifo, alloced_num, locked_num);
+		return 0;
+	}
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
 	ret = msgq_slab_legal_used_elements(data_fifo, &msgq_num_used, &slab_blocks_num_used);
 	if (ret) {
 		return ret;
@@ -131,6 +238,33 @@ int data_fifo_num_used_get(struct data_fifo *data_fifo, uint32_t *alloced_num, u
 	return ret;
 }
 
+#if defined(CONFIG_DATA_FIFO_STATS)
+void data_fifo_stats_get(struct data_fifo *data_fifo, struct data_fifo_stats *stats)
+{
+	__ASSERT_NO_MSG(data_fifo != NULL);
+	__ASSERT_NO_MSG(stats != NULL);
+
+	stats->alloc_cnt = atomic_get(&data_fifo->stats.alloc_cnt);
+	stats->alloc_fail_cnt = atomic_get(&data_fifo->stats.alloc_fail_cnt);
+	stats->lock_cnt = atomic_get(&data_fifo->stats.lock_cnt);
+	stats->get_cnt = atomic_get(&data_fifo->stats.get_cnt);
+	stats->get_fail_cnt = atomic_get(&data_fifo->stats.get_fail_cnt);
+	stats->locked_max = atomic_get(&data_fifo->stats.locked_max);
+}
+
+void data_fifo_stats_reset(struct data_fifo *data_fifo)
+{
+	__ASSERT_NO_MSG(data_fifo != NULL);
+
+	atomic_clear(&data_fifo->stats.alloc_cnt);
+	atomic_clear(&data_fifo->stats.alloc_fail_cnt);
+	atomic_clear(&data_fifo->stats.lock_cnt);
+	atomic_clear(&data_fifo->stats.get_cnt);
+	atomic_clear(&data_fifo->stats.get_fail_cnt);
+	atomic_clear(&data_fifo->stats.locked_max);
+}
+#endif /* CONFIG_DATA_FIFO_STATS */
+
 int data_fifo_empty(struct data_fifo *data_fifo)
 {
 	uint32_t fifo_alloced_num, fifo_locked_num;
@@ -138,6 +272,13 @@ int data_fifo_empty(struct data_fifo *data_fifo)
 	void *old_data;
 	size_t size;
 
+#if defined(CONFIG_DATA_FIFO_SPSC)
+	if (is_spsc(data_fifo)) {
+		data_fifo_spsc_reset(data_fifo);
+		return 0;
+	}
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
 	ret = data_fifo_num_used_get(data_fifo, &fifo_alloced_num, &fifo_locked_num);
 	if (ret) {
 		LOG_ERR("Failed to get num used in FIFO");
@@ -192,6 +333,18 @@ int data_fifo_init(struct data_fifo *data_fifo)
 	__ASSERT_NO_MSG((data_fifo->block_size_max % WB_UP(1)) == 0);
 	int ret;
 
+#if defined(CONFIG_DATA_FIFO_STATS)
+	data_fifo_stats_reset(data_fifo);
+#endif
+
+#if defined(CONFIG_DATA_FIFO_SPSC)
+	if (is_spsc(data_fifo)) {
+		data_fifo_spsc_init(data_fifo);
+		data_fifo->initialized = true;
+		return 0;
+	}
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
 	k_msgq_init(&data_fifo->msgq, data_fifo->msgq_buffer, sizeof(struct data_fifo_msgq),
 		    data_fifo->elements_max);
 
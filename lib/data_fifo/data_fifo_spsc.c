@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "data_fifo_spsc.h"
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(data_fifo, CONFIG_DATA_FIFO_LOG_LEVEL);
+
+/* Number of positions in the ring before the counters wrap */
+static inline uint32_t idx_range(struct data_fifo *data_fifo)
+{
+	return data_fifo->elements_max * 2;
+}
+
+static inline uint32_t idx_next(struct data_fifo *data_fifo, uint32_t idx)
+{
+	idx++;
+
+	return (idx == idx_range(data_fifo)) ? 0 : idx;
+}
+
+/* Number of positions from idx_behind to idx_ahead */
+static inline uint32_t idx_dist(struct data_fifo *data_fifo, uint32_t idx_ahead,
+				uint32_t idx_behind)
+{
+	return (idx_ahead + idx_range(data_fifo) - idx_behind) % idx_range(data_fifo);
+}
+
+static inline void *slot_block_get(struct data_fifo *data_fifo, uint32_t idx)
+{
+	return data_fifo->slab_buffer + (idx % data_fifo->elements_max) * data_fifo->block_size_max;
+}
+
+/* The message buffer holds the size of every locked block */
+static inline struct data_fifo_msgq *slot_msg_get(struct data_fifo *data_fifo, uint32_t idx)
+{
+	return &((struct data_fifo_msgq *)data_fifo->msgq_buffer)[idx % data_fifo->elements_max];
+}
+
+static bool vacant_available(struct data_fifo *data_fifo)
+{
+	struct data_fifo_spsc *ring = &data_fifo->ring;
+
+	return idx_dist(data_fifo, atomic_get(&ring->alloc_idx), atomic_get(&ring->free_idx)) <
+	       data_fifo->elements_max;
+}
+
+static bool filled_available(struct data_fifo *data_fifo)
+{
+	struct data_fifo_spsc *ring = &data_fifo->ring;
+
+	return atomic_get(&ring->get_idx) != atomic_get(&ring->lock_idx);
+}
+
+/**
+ * @brief Wait until the other side has made progress.
+ *
+ * @details The waiting flag is set before the condition is checked again, so progress made by the
+ *	    other side is either seen here, or the other side sees the flag and gives the
+ *	    semaphore. The semaphore may have been given while nobody was waiting, so the caller
+ *	    must check the condition again after this returns.
+ */
+static int ring_wait(struct data_fifo *data_fifo, atomic_t *waiting, struct k_sem *sem,
+		     bool (*ready)(struct data_fifo *data_fifo), k_timepoint_t end)
+{
+	atomic_set(waiting, 1);
+
+	if (ready(data_fifo)) {
+		atomic_set(waiting, 0);
+		return 0;
+	}
+
+	if (k_sem_take(sem, sys_timepoint_timeout(end))) {
+		atomic_set(waiting, 0);
+		return -EAGAIN;
+	}
+
+	return 0;
+}
+
+static void ring_notify(atomic_t *waiting, struct k_sem *sem)
+{
+	if (atomic_cas(waiting, 1, 0)) {
+		k_sem_give(sem);
+	}
+}
+
+void data_fifo_spsc_init(struct data_fifo *data_fifo)
+{
+	struct data_fifo_spsc *ring = &data_fifo->ring;
+
+	k_sem_init(&ring->vacant_sem, 0, 1);
+	k_sem_init(&ring->filled_sem, 0, 1);
+	data_fifo_spsc_reset(data_fifo);
+}
+
+void data_fifo_spsc_reset(struct data_fifo *data_fifo)
+{
+	struct data_fifo_spsc *ring = &data_fifo->ring;
+
+	atomic_clear(&ring->alloc_idx);
+	atomic_clear(&ring->lock_idx);
+	atomic_clear(&ring->get_idx);
+	atomic_clear(&ring->free_idx);
+	atomic_clear(&ring->producer_waiting);
+	atomic_clear(&ring->consumer_waiting);
+	k_sem_reset(&ring->vacant_sem);
+	k_sem_reset(&ring->filled_sem);
+}
+
+int data_fifo_spsc_pointer_first_vacant_get(struct data_fifo *data_fifo, void **data,
+					    k_timeout_t timeout)
+{
+	struct data_fifo_spsc *ring = &data_fifo->ring;
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	int ret;
+
+	while (!vacant_available(data_fifo)) {
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			/* Same as k_mem_slab_alloc */
+			return -ENOMEM;
+		}
+
+		ret = ring_wait(data_fifo, &ring->producer_waiting, &ring->vacant_sem,
+				vacant_available, end);
+		if (ret) {
+			return ret;
+		}
+	}
+
+	uint32_t alloc_idx = atomic_get(&ring->alloc_idx);
+
+	*data = slot_block_get(data_fifo, alloc_idx);
+	atomic_set(&ring->alloc_idx, idx_next(data_fifo, alloc_idx));
+
+	return 0;
+}
+
+int data_fifo_spsc_block_lock(struct data_fifo *data_fifo, void **data, size_t size)
+{
+	struct data_fifo_spsc *ring = &data_fifo->ring;
+	uint32_t lock_idx = atomic_get(&ring->lock_idx);
+
+	if ((lock_idx == atomic_get(&ring->alloc_idx)) ||
+	    (*data != slot_block_get(data_fifo, lock_idx))) {
+		LOG_ERR("Block %p not locked in the order it was obtained", *data);
+		return -EINVAL;
+	}
+
+	struct data_fifo_msgq *msg = slot_msg_get(data_fifo, lock_idx);
+
+	msg->block_ptr = *data;
+	msg->size = size;
+
+	/* Publish the block after its size has been written */
+	atomic_set(&ring->lock_idx, idx_next(data_fifo, lock_idx));
+	ring_notify(&ring->consumer_waiting, &ring->filled_sem);
+
+	return 0;
+}
+
+int data_fifo_spsc_pointer_last_filled_get(struct data_fifo *data_fifo, void **data, size_t *size,
+					   k_timeout_t timeout)
+{
+	struct data_fifo_spsc *ring = &data_fifo->ring;
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	int ret;
+
+	while (!filled_available(data_fifo)) {
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			/* Same as k_msgq_get */
+			return -ENOMSG;
+		}
+
+		ret = ring_wait(data_fifo, &ring->consumer_waiting, &ring->filled_sem,
+				filled_available, end);
+		if (ret) {
+			return ret;
+		}
+	}
+
+	uint32_t get_idx = atomic_get(&ring->get_idx);
+	struct data_fifo_msgq *msg = slot_msg_get(data_fifo, get_idx);
+
+	*data = msg->block_ptr;
+	*size = msg->size;
+	atomic_set(&ring->get_idx, idx_next(data_fifo, get_idx));
+
+	return 0;
+}
+
+void data_fifo_spsc_block_free(struct data_fifo *data_fifo, void *data)
+{
+	struct data_fifo_spsc *ring = &data_fifo->ring;
+	uint32_t free_idx = atomic_get(&ring->free_idx);
+
+	if ((free_idx == atomic_get(&ring->get_idx)) ||
+	    (data != slot_block_get(data_fifo, free_idx))) {
+		LOG_ERR("Block %p not freed in the order it was obtained", data);
+		__ASSERT_NO_MSG(false);
+		return;
+	}
+
+	atomic_set(&ring->free_idx, idx_next(data_fifo, free_idx));
+	ring_notify(&ring->producer_waiting, &ring->vacant_sem);
+}
+
+void data_fifo_spsc_num_used_get(struct data_fifo *data_fifo, uint32_t *alloced_num,
+				 uint32_t *locked_num)
+{
+	struct data_fifo_spsc *ring = &data_fifo->ring;
+
+	/* Read the consumer indices first, so a concurrent update can not make the number of
+	 * locked blocks larger than the number of allocated blocks.
+	 */
+	uint32_t free_idx = atomic_get(&ring->free_idx);
+	uint32_t get_idx = atomic_get(&ring->get_idx);
+	uint32_t lock_idx = atomic_get(&ring->lock_idx);
+	uint32_t alloc_idx = atomic_get(&ring->alloc_idx);
+
+	*alloced_num = idx_dist(data_fifo, alloc_idx, free_idx);
+	*locked_num = idx_dist(data_fifo, lock_idx, get_idx);
+}
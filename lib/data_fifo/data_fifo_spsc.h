@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _DATA_FIFO_SPSC_H_
+#define _DATA_FIFO_SPSC_H_
+
+#include <data_fifo.h>
+
+/* Single-producer/single-consumer implementation of the data_fifo API. Parameters are validated
+ * by the API functions in data_fifo.c before these are called.
+ */
+
+void data_fifo_spsc_init(struct data_fifo *data_fifo);
+
+void data_fifo_spsc_reset(struct data_fifo *data_fifo);
+
+int data_fifo_spsc_pointer_first_vacant_get(struct data_fifo *data_fifo, void **data,
+					    k_timeout_t timeout);
+
+int data_fifo_spsc_block_lock(struct data_fifo *data_fifo, void **data, size_t size);
+
+int data_fifo_spsc_pointer_last_filled_get(struct data_fifo *data_fifo, void **data, size_t *size,
+					   k_timeout_t timeout);
+
+void data_fifo_spsc_block_free(struct data_fifo *data_fifo, void *data);
+
+void data_fifo_spsc_num_used_get(struct data_fifo *data_fifo, uint32_t *alloced_num,
+				 uint32_t *locked_num);
+
+#endif /* _DATA_FIFO_SPSC_H_ */
@@ -7,93 +7,192 @@
 #include <pcm_mix.h>
 
 #include <zephyr/kernel.h>
+#include <zephyr/toolchain.h>
+#include <zephyr/sys/util.h>
+
+#if defined(CONFIG_PCM_MIX_SIMD)
+#include <cmsis_core.h>
+#endif
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(pcm_mix, CONFIG_PCM_MIX_LOG_LEVEL);
 
-/* Clip signal if amplitude is outside legal range */
-static void hard_limiter(int32_t *const pcm)
+#define PCM_24_BIT_MAX ((1 << 23) - 1)
+#define PCM_24_BIT_MIN (-(1 << 23))
+
+/* Add two samples, and clip the result if amplitude is outside legal range */
+static inline int16_t sat_add_16(int16_t a, int16_t b)
 {
-	if (*pcm < INT16_MIN) {
-		LOG_DBG("Clip");
-		*pcm = INT16_MIN;
-	} else if (*pcm > INT16_MAX) {
-		LOG_DBG("Clip");
-		*pcm = INT16_MAX;
-	}
+	return CLAMP((int32_t)a + b, INT16_MIN, INT16_MAX);
 }
 
-/* Mix stereo-stereo or mono-mono. I.e. buffers are of equal size */
-static void pcm_mix_identical(void *const pcm_a, size_t size_a, void const *const pcm_b,
-			      size_t size_b)
+static inline int32_t sat_add_24(int32_t a, int32_t b)
 {
-	int32_t res;
+#if defined(CONFIG_PCM_MIX_SIMD)
+	return __SSAT(a + b, 24);
+#else
+	return CLAMP(a + b, PCM_24_BIT_MIN, PCM_24_BIT_MAX);
+#endif
+}
 
-	for (uint32_t i = 0; i < size_b / 2; i++) {
-		res = ((int16_t *)pcm_a)[i] + ((int16_t *)pcm_b)[i];
+static inline int32_t sat_add_32(int32_t a, int32_t b)
+{
+#if defined(CONFIG_PCM_MIX_SIMD)
+	return __QADD(a, b);
+#else
+	return CLAMP((int64_t)a + b, INT32_MIN, INT32_MAX);
+#endif
+}
 
-		hard_limiter(&res);
+static inline int32_t sat_add_carrier_32(int32_t a, int32_t b, uint8_t pcm_bit_depth)
+{
+	return (pcm_bit_depth == 24) ? sat_add_24(a, b) : sat_add_32(a, b);
+}
 
-		((int16_t *)pcm_a)[i] = (int16_t)res;
-	}
+#if defined(CONFIG_PCM_MIX_SIMD)
+/* The 16-bit mixers work on two samples at a time. Buffers are only guaranteed to be aligned to
+ * the sample size, so words are accessed unaligned. This is supported by all cores with the DSP
+ * extension.
+ */
+static inline uint32_t word_get(void const *ptr)
+{
+	return UNALIGNED_GET((uint32_t const *)ptr);
 }
 
-/* Mix mono into both channels of a stereo buffer */
-static void pcm_mix_b_mono_into_a_stereo_lr(void *const pcm_a, size_t size_a,
-					    void const *const pcm_b, size_t size_b)
+static inline void word_put(void *ptr, uint32_t val)
 {
-	int32_t res;
+	UNALIGNED_PUT(val, (uint32_t *)ptr);
+}
 
-	/* Use size_b as this is the length of the mono sample.
-	 * This must be *2 to traverse the stereo sample and /2 since
-	 * the sample is two bytes in size.
-	 */
-	for (uint32_t i = 0; i < size_b; i++) {
-		res = ((int16_t *)pcm_a)[i] + ((int16_t *)pcm_b)[i / 2];
+/* Mix stereo-stereo or mono-mono. I.e. buffers are of equal size */
+static void pcm_mix_identical_16(int16_t *pcm_a, int16_t const *pcm_b, size_t samples_b)
+{
+	size_t i;
 
-		hard_limiter(&res);
+	for (i = 0; i + 1 < samples_b; i += 2) {
+		word_put(&pcm_a[i], __QADD16(word_get(&pcm_a[i]), word_get(&pcm_b[i])));
+	}
 
-		((int16_t *)pcm_a)[i] = (int16_t)res;
+	if (i < samples_b) {
+		pcm_a[i] = sat_add_16(pcm_a[i], pcm_b[i]);
 	}
 }
 
-/* Mix mono into left channel of a stereo buffer */
-static void pcm_mix_b_mono_into_a_stereo_l(void *const pcm_a, size_t size_a,
-					   void const *const pcm_b, size_t size_b)
+/* Mix mono into one or both channels of a stereo buffer. Every word of the stereo buffer holds
+ * one frame, with the left sample in the lower half-word.
+ */
+static void pcm_mix_b_mono_into_a_stereo_16(int16_t *pcm_a, int16_t const *pcm_b, size_t samples_b,
+					    enum pcm_mix_mode mix_mode)
 {
-	int32_t res;
+	size_t i;
+
+	for (i = 0; i + 1 < samples_b; i += 2) {
+		uint32_t b = word_get(&pcm_b[i]);
+		uint32_t b_first;
+		uint32_t b_second;
+
+		switch (mix_mode) {
+		case B_MONO_INTO_A_STEREO_LR:
+			b_first = __PKHBT(b, b, 16);
+			b_second = __PKHTB(b, b, 16);
+			break;
+		case B_MONO_INTO_A_STEREO_L:
+			b_first = b & 0x0000FFFF;
+			b_second = b >> 16;
+			break;
+		default:
+			b_first = b << 16;
+			b_second = b & 0xFFFF0000;
+			break;
+		}
 
-	for (uint32_t i = 0; i < size_b / 2; i++) {
-		res = ((int16_t *)pcm_a)[i * 2] + ((int16_t *)pcm_b)[i];
+		word_put(&pcm_a[i * 2], __QADD16(word_get(&pcm_a[i * 2]), b_first));
+		word_put(&pcm_a[i * 2 + 2], __QADD16(word_get(&pcm_a[i * 2 + 2]), b_second));
+	}
 
-		hard_limiter(&res);
+	if (i < samples_b) {
+		if (mix_mode != B_MONO_INTO_A_STEREO_R) {
+			pcm_a[i * 2] = sat_add_16(pcm_a[i * 2], pcm_b[i]);
+		}
 
-		((int16_t *)pcm_a)[i * 2] = (int16_t)res;
+		if (mix_mode != B_MONO_INTO_A_STEREO_L) {
+			pcm_a[i * 2 + 1] = sat_add_16(pcm_a[i * 2 + 1], pcm_b[i]);
+		}
 	}
 }
-
-/* Mix mono into right channel of a stereo buffer */
-static void pcm_mix_b_mono_into_a_stereo_r(void *const pcm_a, size_t size_a,
-					   void const *const pcm_b, size_t size_b)
+#else
+/* Mix stereo-stereo or mono-mono. I.e. buffers are of equal size */
+static void pcm_mix_identical_16(int16_t *pcm_a, int16_t const *pcm_b, size_t samples_b)
 {
-	int32_t res;
+	for (size_t i = 0; i < samples_b; i++) {
+		pcm_a[i] = sat_add_16(pcm_a[i], pcm_b[i]);
+	}
+}
 
-	for (uint32_t i = 0; i < size_b / 2; i++) {
-		res = ((int16_t *)pcm_a)[i * 2 + 1] + ((int16_t *)pcm_b)[i];
+/* Mix mono into one or both channels of a stereo buffer */
+static void pcm_mix_b_mono_into_a_stereo_16(int16_t *pcm_a, int16_t const *pcm_b, size_t samples_b,
+					    enum pcm_mix_mode mix_mode)
+{
+	for (size_t i = 0; i < samples_b; i++) {
+		if (mix_mode != B_MONO_INTO_A_STEREO_R) {
+			pcm_a[i * 2] = sat_add_16(pcm_a[i * 2], pcm_b[i]);
+		}
 
-		hard_limiter(&res);
+		if (mix_mode != B_MONO_INTO_A_STEREO_L) {
+			pcm_a[i * 2 + 1] = sat_add_16(pcm_a[i * 2 + 1], pcm_b[i]);
+		}
+	}
+}
+#endif /* CONFIG_PCM_MIX_SIMD */
 
-		((int16_t *)pcm_a)[i * 2 + 1] = (int16_t)res;
+/* Mix samples carried in 32 bits. Inlined for every bit depth, so the saturation is resolved at
+ * compile time.
+ */
+static ALWAYS_INLINE void pcm_mix_32(int32_t *pcm_a, int32_t const *pcm_b, size_t samples_b,
+				     enum pcm_mix_mode mix_mode, uint8_t pcm_bit_depth)
+{
+	switch (mix_mode) {
+	case B_STEREO_INTO_A_STEREO:
+	case B_MONO_INTO_A_MONO:
+		for (size_t i = 0; i < samples_b; i++) {
+			pcm_a[i] = sat_add_carrier_32(pcm_a[i], pcm_b[i], pcm_bit_depth);
+		}
+		break;
+	case B_MONO_INTO_A_STEREO_LR:
+		for (size_t i = 0; i < samples_b; i++) {
+			pcm_a[i * 2] = sat_add_carrier_32(pcm_a[i * 2], pcm_b[i], pcm_bit_depth);
+			pcm_a[i * 2 + 1] =
+				sat_add_carrier_32(pcm_a[i * 2 + 1], pcm_b[i], pcm_bit_depth);
+		}
+		break;
+	case B_MONO_INTO_A_STEREO_L:
+		for (size_t i = 0; i < samples_b; i++) {
+			pcm_a[i * 2] = sat_add_carrier_32(pcm_a[i * 2], pcm_b[i], pcm_bit_depth);
+		}
+		break;
+	case B_MONO_INTO_A_STEREO_R:
+		for (size_t i = 0; i < samples_b; i++) {
+			pcm_a[i * 2 + 1] =
+				sat_add_carrier_32(pcm_a[i * 2 + 1], pcm_b[i], pcm_bit_depth);
+		}
+		break;
 	}
 }
 
-int pcm_mix(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
-	    enum pcm_mix_mode mix_mode)
+int pcm_mix_ext(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
+		enum pcm_mix_mode mix_mode, uint8_t pcm_bit_depth, uint8_t carrier_bit_depth)
 {
 	if (pcm_a == NULL || size_a == 0) {
 		return -EINVAL;
 	}
 
+	if (!((pcm_bit_depth == 16 && carrier_bit_depth == 16) ||
+	      (pcm_bit_depth == 24 && carrier_bit_depth == 32) ||
+	      (pcm_bit_depth == 32 && carrier_bit_depth == 32))) {
+		LOG_ERR("Invalid bit depth: %d in %d", pcm_bit_depth, carrier_bit_depth);
+		return -EINVAL;
+	}
+
 	if (pcm_b == NULL || size_b == 0) {
 		/* Nothing to mix, returning */
 		return 0;
@@ -106,24 +205,14 @@ int pcm_mix(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t si
 		if (size_b > size_a) {
 			return -EPERM;
 		}
-		pcm_mix_identical(pcm_a, size_a, pcm_b, size_b);
 		break;
 	case B_MONO_INTO_A_STEREO_LR:
-		if (size_b > (size_a / 2)) {
-			return -EPERM;
-		}
-		pcm_mix_b_mono_into_a_stereo_lr(pcm_a, size_a, pcm_b, size_b);
-		break;
+		/* Fall through */
 	case B_MONO_INTO_A_STEREO_L:
-		pcm_mix_b_mono_into_a_stereo_l(pcm_a, size_a, pcm_b, size_b);
-		if (size_b > (size_a / 2)) {
-			LOG_ERR("size a %d size b %d", size_a, size_b);
-			return -EPERM;
-		}
-		break;
+		/* Fall through */
 	case B_MONO_INTO_A_STEREO_R:
-		pcm_mix_b_mono_into_a_stereo_r(pcm_a, size_a, pcm_b, size_b);
 		if (size_b > (size_a / 2)) {
+			LOG_ERR("size a %d size b %d", size_a, size_b);
 			return -EPERM;
 		}
 		break;
@@ -131,5 +220,25 @@ int pcm_mix(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t si
 		return -ESRCH;
 	};
 
+	size_t samples_b = size_b / (carrier_bit_depth / 8);
+
+	if (carrier_bit_depth == 16) {
+		if (mix_mode == B_STEREO_INTO_A_STEREO || mix_mode == B_MONO_INTO_A_MONO) {
+			pcm_mix_identical_16(pcm_a, pcm_b, samples_b);
+		} else {
+			pcm_mix_b_mono_into_a_stereo_16(pcm_a, pcm_b, samples_b, mix_mode);
+		}
+	} else if (pcm_bit_depth == 24) {
+		pcm_mix_32(pcm_a, pcm_b, samples_b, mix_mode, 24);
+	} else {
+		pcm_mix_32(pcm_a, pcm_b, samples_b, mix_mode, 32);
+	}
+
 	return 0;
 }
+
+int pcm_mix(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
+	    enum pcm_mix_mode mix_mode)
+{
+	return pcm_mix_ext(pcm_a, size_a, pcm_b, size_b, mix_mode, 16, 16);
+}
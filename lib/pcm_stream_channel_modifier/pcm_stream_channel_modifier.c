@@ -7,6 +7,7 @@
 #include "pcm_stream_channel_modifier.h"
 
 #include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
 #include <errno.h>
 
 #include <zephyr/logging/log.h>
@@ -49,6 +50,54 @@ static bool is_valid_size(size_t size, uint8_t bytes_per_sample, uint8_t no_chan
 	return true;
 }
 
+/**
+ * @brief      Determines whether a buffer is aligned to the given size.
+ *
+ * @details    The 16- and 32-bit paths move whole samples, or pairs of 16-bit samples, per
+ *             iteration. They are only used when the buffers are aligned for these accesses.
+ *             Otherwise, samples are copied byte by byte.
+ *
+ * @param[in]  ptr    Pointer to the buffer.
+ * @param[in]  align  Required alignment in bytes.
+ *
+ * @return     True if the buffer is aligned, False otherwise.
+ */
+static inline bool is_aligned(void const *ptr, size_t align)
+{
+	return ((uintptr_t)ptr % align) == 0;
+}
+
+/**
+ * @brief      Packs two 16-bit samples into a word, with the first sample at the lowest
+ *             address.
+ */
+static inline uint32_t pair_pack(uint16_t first, uint16_t second)
+{
+#ifdef CONFIG_BIG_ENDIAN
+	return ((uint32_t)first << 16) | second;
+#else
+	return ((uint32_t)second << 16) | first;
+#endif
+}
+
+static inline uint16_t pair_first(uint32_t pair)
+{
+#ifdef CONFIG_BIG_ENDIAN
+	return pair >> 16;
+#else
+	return pair & 0xFFFF;
+#endif
+}
+
+static inline uint16_t pair_second(uint32_t pair)
+{
+#ifdef CONFIG_BIG_ENDIAN
+	return pair & 0xFFFF;
+#else
+	return pair >> 16;
+#endif
+}
+
 int pscm_zero_pad(void const *const input, size_t input_size, enum audio_channel channel,
 		  uint8_t pcm_bit_depth, void *output, size_t *output_size)
 {
@@ -58,29 +107,59 @@ int pscm_zero_pad(void const *const input, size_t input_size, enum audio_channel
 		return -EINVAL;
 	}
 
-	char *pointer_input = (char *)input;
-	char *pointer_output = (char *)output;
+	if (channel != AUDIO_CH_L && channel != AUDIO_CH_R) {
+		LOG_ERR("Invalid channel selection");
+		return -EINVAL;
+	}
 
-	for (uint32_t i = 0; i < input_size / bytes_per_sample; i++) {
-		if (channel == AUDIO_CH_L) {
-			for (uint8_t j = 0; j < bytes_per_sample; j++) {
-				*pointer_output++ = *pointer_input++;
-			}
+	size_t samples = input_size / bytes_per_sample;
 
-			for (uint8_t j = 0; j < bytes_per_sample; j++) {
-				*pointer_output++ = 0;
+	if (bytes_per_sample == 2 && is_aligned(input, 2) && is_aligned(output, 4)) {
+		uint16_t const *pointer_input = input;
+		uint32_t *pointer_output = output;
+
+		for (size_t i = 0; i < samples; i++) {
+			if (channel == AUDIO_CH_L) {
+				pointer_output[i] = pair_pack(pointer_input[i], 0);
+			} else {
+				pointer_output[i] = pair_pack(0, pointer_input[i]);
 			}
-		} else if (channel == AUDIO_CH_R) {
-			for (uint8_t j = 0; j < bytes_per_sample; j++) {
-				*pointer_output++ = 0;
+		}
+	} else if (bytes_per_sample == 4 && is_aligned(input, 4) && is_aligned(output, 4)) {
+		uint32_t const *pointer_input = input;
+		uint32_t *pointer_output = output;
+
+		for (size_t i = 0; i < samples; i++) {
+			if (channel == AUDIO_CH_L) {
+				pointer_output[i * 2] = pointer_input[i];
+				pointer_output[i * 2 + 1] = 0;
+			} else {
+				pointer_output[i * 2] = 0;
+				pointer_output[i * 2 + 1] = pointer_input[i];
 			}
-
-			for (uint8_t j = 0; j < bytes_per_sample; j++) {
-				*pointer_output++ = *pointer_input++;
+		}
+	} else {
+		char *pointer_input = (char *)input;
+		char *pointer_output = (char *)output;
+
+		for (size_t i = 0; i < samples; i++) {
+			if (channel == AUDIO_CH_L) {
+				for (uint8_t j = 0; j < bytes_per_sample; j++) {
+					*pointer_output++ = *pointer_input++;
+				}
+
+				for (uint8_t j = 0; j < bytes_per_sample; j++) {
+					*pointer_output++ = 0;
+				}
+			} else {
+				for (uint8_t j = 0; j < bytes_per_sample; j++) {
+					*pointer_output++ = 0;
+				}
+
+				for (uint8_t j = 0; j < bytes_per_sample; j++) {
+					*pointer_output++ = *pointer_input++;
+				}
 			}
-		} else {
-			LOG_ERR("Invalid channel selection");
-			return -EINVAL;
 		}
 	}
 
@@ -97,18 +176,37 @@ int pscm_copy_pad(void const *const input, size_t input_size, uint8_t pcm_bit_de
 		return -EINVAL;
 	}
 
-	char *pointer_input = (char *)input;
-	char *pointer_output = (char *)output;
+	size_t samples = input_size / bytes_per_sample;
 
-	for (uint32_t i = 0; i < input_size / bytes_per_sample; i++) {
-		for (uint8_t j = 0; j < bytes_per_sample; j++) {
-			*pointer_output++ = *pointer_input++;
+	if (bytes_per_sample == 2 && is_aligned(input, 2) && is_aligned(output, 4)) {
+		uint16_t const *pointer_input = input;
+		uint32_t *pointer_output = output;
+
+		for (size_t i = 0; i < samples; i++) {
+			pointer_output[i] = pair_pack(pointer_input[i], pointer_input[i]);
 		}
-		/* Move back to start of sample to copy into next channel */
-		pointer_input -= bytes_per_sample;
+	} else if (bytes_per_sample == 4 && is_aligned(input, 4) && is_aligned(output, 4)) {
+		uint32_t const *pointer_input = input;
+		uint32_t *pointer_output = output;
 
-		for (uint8_t j = 0; j < bytes_per_sample; j++) {
-			*pointer_output++ = *pointer_input++;
+		for (size_t i = 0; i < samples; i++) {
+			pointer_output[i * 2] = pointer_input[i];
+			pointer_output[i * 2 + 1] = pointer_input[i];
+		}
+	} else {
+		char *pointer_input = (char *)input;
+		char *pointer_output = (char *)output;
+
+		for (size_t i = 0; i < samples; i++) {
+			for (uint8_t j = 0; j < bytes_per_sample; j++) {
+				*pointer_output++ = *pointer_input++;
+			}
+			/* Move back to start of sample to copy into next channel */
+			pointer_input -= bytes_per_sample;
+
+			for (uint8_t j = 0; j < bytes_per_sample; j++) {
+				*pointer_output++ = *pointer_input++;
+			}
 		}
 	}
 
@@ -125,16 +223,40 @@ int pscm_combine(void const *const input_left, void const *const input_right, si
 		return -EINVAL;
 	}
 
-	char *pointer_input_left = (char *)input_left;
-	char *pointer_input_right = (char *)input_right;
-	char *pointer_output = (char *)output;
+	size_t samples = input_size / bytes_per_sample;
+
+	if (bytes_per_sample == 2 && is_aligned(input_left, 2) && is_aligned(input_right, 2) &&
+	    is_aligned(output, 4)) {
+		uint16_t const *pointer_input_left = input_left;
+		uint16_t const *pointer_input_right = input_right;
+		uint32_t *pointer_output = output;
 
-	for (uint32_t i = 0; i < input_size / bytes_per_sample; i++) {
-		for (uint8_t j = 0; j < bytes_per_sample; j++) {
-			*pointer_output++ = *pointer_input_left++;
+		for (size_t i = 0; i < samples; i++) {
+			pointer_output[i] =
+				pair_pack(pointer_input_left[i], pointer_input_right[i]);
 		}
-		for (uint8_t j = 0; j < bytes_per_sample; j++) {
-			*pointer_output++ = *pointer_input_right++;
+	} else if (bytes_per_sample == 4 && is_aligned(input_left, 4) &&
+		   is_aligned(input_right, 4) && is_aligned(output, 4)) {
+		uint32_t const *pointer_input_left = input_left;
+		uint32_t const *pointer_input_right = input_right;
+		uint32_t *pointer_output = output;
+
+		for (size_t i = 0; i < samples; i++) {
+			pointer_output[i * 2] = pointer_input_left[i];
+			pointer_output[i * 2 + 1] = pointer_input_right[i];
+		}
+	} else {
+		char *pointer_input_left = (char *)input_left;
+		char *pointer_input_right = (char *)input_right;
+		char *pointer_output = (char *)output;
+
+		for (size_t i = 0; i < samples; i++) {
+			for (uint8_t j = 0; j < bytes_per_sample; j++) {
+				*pointer_output++ = *pointer_input_left++;
+			}
+			for (uint8_t j = 0; j < bytes_per_sample; j++) {
+				*pointer_output++ = *pointer_input_right++;
+			}
 		}
 	}
 
@@ -151,25 +273,49 @@ int pscm_one_channel_split(void const *const input, size_t input_size, enum audi
 		return -EINVAL;
 	}
 
-	char *pointer_input = (char *)input;
-	char *pointer_output = (char *)output;
+	if (channel != AUDIO_CH_L && channel != AUDIO_CH_R) {
+		LOG_ERR("Invalid channel selection");
+		return -EINVAL;
+	}
 
-	for (uint32_t i = 0; i < input_size / bytes_per_sample; i += 2) {
-		if (channel == AUDIO_CH_L) {
-			for (uint8_t j = 0; j < bytes_per_sample; j++) {
-				*pointer_output++ = *pointer_input++;
-			}
-			pointer_input += bytes_per_sample;
+	size_t frames = input_size / (bytes_per_sample * 2);
 
-		} else if (channel == AUDIO_CH_R) {
-			pointer_input += bytes_per_sample;
+	if (bytes_per_sample == 2 && is_aligned(input, 4) && is_aligned(output, 2)) {
+		uint32_t const *pointer_input = input;
+		uint16_t *pointer_output = output;
 
-			for (uint8_t j = 0; j < bytes_per_sample; j++) {
-				*pointer_output++ = *pointer_input++;
+		for (size_t i = 0; i < frames; i++) {
+			if (channel == AUDIO_CH_L) {
+				pointer_output[i] = pair_first(pointer_input[i]);
+			} else {
+				pointer_output[i] = pair_second(pointer_input[i]);
+			}
+		}
+	} else if (bytes_per_sample == 4 && is_aligned(input, 4) && is_aligned(output, 4)) {
+		uint32_t const *pointer_input = input;
+		uint32_t *pointer_output = output;
+		size_t offset = (channel == AUDIO_CH_L) ? 0 : 1;
+
+		for (size_t i = 0; i < frames; i++) {
+			pointer_output[i] = pointer_input[i * 2 + offset];
+		}
+	} else {
+		char *pointer_input = (char *)input;
+		char *pointer_output = (char *)output;
+
+		for (size_t i = 0; i < frames; i++) {
+			if (channel == AUDIO_CH_L) {
+				for (uint8_t j = 0; j < bytes_per_sample; j++) {
+					*pointer_output++ = *pointer_input++;
+				}
+				pointer_input += bytes_per_sample;
+			} else {
+				pointer_input += bytes_per_sample;
+
+				for (uint8_t j = 0; j < bytes_per_sample; j++) {
+					*pointer_output++ = *pointer_input++;
+				}
 			}
-		} else {
-			LOG_ERR("Invalid channel selection");
-			return -EINVAL;
 		}
 	}
 
@@ -186,16 +332,42 @@ int pscm_two_channel_split(void const *const input, size_t input_size, uint8_t p
 		return -EINVAL;
 	}
 
-	char *pointer_input = (char *)input;
-	char *pointer_output_left = (char *)output_left;
-	char *pointer_output_right = (char *)output_right;
+	size_t frames = input_size / (bytes_per_sample * 2);
 
-	for (uint32_t i = 0; i < input_size / bytes_per_sample; i += 2) {
-		for (uint8_t j = 0; j < bytes_per_sample; j++) {
-			*pointer_output_left++ = *pointer_input++;
+	if (bytes_per_sample == 2 && is_aligned(input, 4) && is_aligned(output_left, 2) &&
+	    is_aligned(output_right, 2)) {
+		uint32_t const *pointer_input = input;
+		uint16_t *pointer_output_left = output_left;
+		uint16_t *pointer_output_right = output_right;
+
+		for (size_t i = 0; i < frames; i++) {
+			uint32_t pair = pointer_input[i];
+
+			pointer_output_left[i] = pair_first(pair);
+			pointer_output_right[i] = pair_second(pair);
+		}
+	} else if (bytes_per_sample == 4 && is_aligned(input, 4) && is_aligned(output_left, 4) &&
+		   is_aligned(output_right, 4)) {
+		uint32_t const *pointer_input = input;
+		uint32_t *pointer_output_left = output_left;
+		uint32_t *pointer_output_right = output_right;
+
+		for (size_t i = 0; i < frames; i++) {
+			pointer_output_left[i] = pointer_input[i * 2];
+			pointer_output_right[i] = pointer_input[i * 2 + 1];
 		}
-		for (uint8_t j = 0; j < bytes_per_sample; j++) {
-			*pointer_output_right++ = *pointer_input++;
+	} else {
+		char *pointer_input = (char *)input;
+		char *pointer_output_left = (char *)output_left;
+		char *pointer_output_right = (char *)output_right;
+
+		for (size_t i = 0; i < frames; i++) {
+			for (uint8_t j = 0; j < bytes_per_sample; j++) {
+				*pointer_output_left++ = *pointer_input++;
+			}
+			for (uint8_t j = 0; j < bytes_per_sample; j++) {
+				*pointer_output_right++ = *pointer_input++;
+			}
 		}
 	}
 
@@ -226,6 +398,31 @@ int pscm_interleave(void const *const input, size_t input_size, uint8_t channel,
 	}
 
 	bytes_per_sample = pcm_bit_depth / 8;
+
+	if (bytes_per_sample == 2 && is_aligned(input, 2) && is_aligned(output, 2)) {
+		uint16_t const *pointer_input_16 = input;
+		uint16_t *pointer_output_16 = (uint16_t *)output + channel;
+
+		for (size_t i = 0; i < input_size / 2; i++) {
+			*pointer_output_16 = pointer_input_16[i];
+			pointer_output_16 += output_channels;
+		}
+
+		return 0;
+	}
+
+	if (bytes_per_sample == 4 && is_aligned(input, 4) && is_aligned(output, 4)) {
+		uint32_t const *pointer_input_32 = input;
+		uint32_t *pointer_output_32 = (uint32_t *)output + channel;
+
+		for (size_t i = 0; i < input_size / 4; i++) {
+			*pointer_output_32 = pointer_input_32[i];
+			pointer_output_32 += output_channels;
+		}
+
+		return 0;
+	}
+
 	step = bytes_per_sample * (output_channels - 1);
 	pointer_input = (uint8_t *)input;
 	pointer_output = (uint8_t *)output + (bytes_per_sample * channel);
@@ -262,6 +459,34 @@ int pscm_deinterleave(void const *const input, size_t input_size, uint8_t input_
 
 	bytes_per_sample = pcm_bit_depth / 8;
 	step = bytes_per_sample * (input_channels - 1);
+
+	/* Number of frames, including a trailing partial frame as the byte-wise copy does */
+	size_t frames = DIV_ROUND_UP(input_size, step + bytes_per_sample);
+
+	if (bytes_per_sample == 2 && is_aligned(input, 2) && is_aligned(output, 2)) {
+		uint16_t const *pointer_input_16 = (uint16_t const *)input + channel;
+		uint16_t *pointer_output_16 = output;
+
+		for (size_t i = 0; i < frames; i++) {
+			pointer_output_16[i] = *pointer_input_16;
+			pointer_input_16 += input_channels;
+		}
+
+		return 0;
+	}
+
+	if (bytes_per_sample == 4 && is_aligned(input, 4) && is_aligned(output, 4)) {
+		uint32_t const *pointer_input_32 = (uint32_t const *)input + channel;
+		uint32_t *pointer_output_32 = output;
+
+		for (size_t i = 0; i < frames; i++) {
+			pointer_output_32[i] = *pointer_input_32;
+			pointer_input_32 += input_channels;
+		}
+
+		return 0;
+	}
+
 	pointer_input = (uint8_t *)input + (bytes_per_sample * channel);
 	pointer_output = (uint8_t *)output;
 
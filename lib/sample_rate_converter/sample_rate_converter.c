@@ -10,6 +10,7 @@
 #include <errno.h>
 #include <stdbool.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(sample_rate_converter, CONFIG_SAMPLE_RATE_CONVERTER_LOG_LEVEL);
@@ -393,3 +394,290 @@ int sample_rate_converter_process(struct sample_rate_converter_ctx *ctx,
 
 	return 0;
 }
+
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+typedef q15_t mc_sample_t;
+#define MC_HISTORY(ctx, channel) ((ctx)->history_15[channel])
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+typedef q31_t mc_sample_t;
+#define MC_HISTORY(ctx, channel) ((ctx)->history_31[channel])
+#endif
+
+/**
+ * @brief Scale the filter accumulator to an output sample.
+ *
+ * @details Uses the same scaling and saturation as the CMSIS DSP interpolator and decimator, so
+ *	    the output is bit-exact to the single-channel converter.
+ */
+static inline mc_sample_t mc_sample_get(q63_t acc)
+{
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+	return CLAMP(acc >> 15, INT16_MIN, INT16_MAX);
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+	return (q31_t)(acc >> 31);
+#endif
+}
+
+/**
+ * @brief Calculate the dot product between a filter phase and a window of one channel.
+ *
+ * @details The window starts at sample @p start of the channel in the current input, where a
+ *	    negative index refers to the history kept from the previous call.
+ *
+ * @param[in]	history		History of the channel.
+ * @param[in]	history_size	Number of samples in the history.
+ * @param[in]	input		First input sample of the channel.
+ * @param[in]	stride		Distance between two samples of the channel in the input.
+ * @param[in]	start		Index of the first sample of the window.
+ * @param[in]	coeffs		First filter coefficient.
+ * @param[in]	coeff_stride	Distance between two coefficients of the filter phase.
+ * @param[in]	taps		Number of filter taps.
+ *
+ * @return Accumulated result in 64 bits.
+ */
+static inline q63_t mc_dot_prod(mc_sample_t const *history, size_t history_size,
+				mc_sample_t const *input, size_t stride, int start,
+				mc_sample_t const *coeffs, size_t coeff_stride, size_t taps)
+{
+	q63_t acc = 0;
+	size_t tap = 0;
+
+	for (; (tap < taps) && ((start + (int)tap) < 0); tap++) {
+		acc += (q63_t)history[history_size + start + tap] * coeffs[tap * coeff_stride];
+	}
+
+	if (tap < taps) {
+		mc_sample_t const *sample = &input[(start + tap) * stride];
+
+		for (; tap < taps; tap++) {
+			acc += (q63_t)*sample * coeffs[tap * coeff_stride];
+			sample += stride;
+		}
+	}
+
+	return acc;
+}
+
+static void mc_history_update(mc_sample_t *history, size_t history_size, mc_sample_t const *input,
+			      size_t stride, size_t frames)
+{
+	size_t samples_to_copy = MIN(frames, history_size);
+
+	if (frames < history_size) {
+		memmove(history, &history[frames], (history_size - frames) * sizeof(mc_sample_t));
+	} else {
+		input += (frames - history_size) * stride;
+	}
+
+	history += history_size - samples_to_copy;
+
+	for (size_t i = 0; i < samples_to_copy; i++) {
+		history[i] = input[i * stride];
+	}
+}
+
+/**
+ * @brief Reconfigures the multichannel sample rate converter context.
+ *
+ * @details Validates and sets all sample rate conversion parameters for the context, and clears
+ *	    the history of all channels. When the single-channel converter pads the input buffer
+ *	    for the conversion, the same delay is added to the history.
+ *
+ * @param[in,out]	ctx			Pointer to the multichannel conversion context.
+ * @param[in]		sample_rate_input	Sample rate of the input frames.
+ * @param[in]		sample_rate_output	Sample rate of the output frames.
+ * @param[in]		filter			Filter type to use in the conversion.
+ *
+ * @retval 0 On success.
+ * @retval -EINVAL Invalid parameters used to initialize the conversion.
+ */
+static int sample_rate_converter_mc_reconfigure(struct sample_rate_converter_mc_ctx *ctx,
+						uint32_t sample_rate_input,
+						uint32_t sample_rate_output,
+						enum sample_rate_converter_filter filter)
+{
+	int ret;
+	int conversion_ratio;
+
+	__ASSERT(ctx != NULL, "Context cannot be NULL");
+
+	ret = validate_sample_rates(sample_rate_input, sample_rate_output);
+	if (ret) {
+		LOG_ERR("Invalid sample rate given (%d)", ret);
+		return ret;
+	}
+
+	conversion_ratio = calculate_conversion_ratio(sample_rate_input, sample_rate_output);
+
+	ret = sample_rate_converter_filter_get(filter, conversion_ratio, &ctx->filter_coeffs,
+					       &ctx->filter_size);
+	if (ret) {
+		LOG_ERR("Failed to get filter (%d)", ret);
+		return ret;
+	}
+
+	if (ctx->filter_size > CONFIG_SAMPLE_RATE_CONVERTER_MAX_FILTER_SIZE) {
+		LOG_ERR("Filter is larger than max size");
+		return -EINVAL;
+	}
+
+	if ((ctx->filter_size % abs(conversion_ratio)) != 0) {
+		LOG_ERR("Filter size is not a multiple of conversion ratio");
+		return -EINVAL;
+	}
+
+	if (conversion_ratio > 0) {
+		ctx->delay = (conversion_ratio == 3)
+				     ? SAMPLE_RATE_CONVERTER_INPUT_BUFFER_NUMBER_OVERFLOW_SAMPLES
+				     : 0;
+		ctx->history_size = (ctx->filter_size / conversion_ratio) - 1 + ctx->delay;
+	} else {
+		ctx->delay = 0;
+		ctx->history_size = ctx->filter_size - 1;
+	}
+
+	ctx->sample_rate_input = sample_rate_input;
+	ctx->sample_rate_output = sample_rate_output;
+	ctx->conversion_ratio = conversion_ratio;
+	ctx->filter_type = filter;
+
+	for (uint8_t channel = 0; channel < ctx->channels; channel++) {
+		memset(MC_HISTORY(ctx, channel), 0, sizeof(MC_HISTORY(ctx, channel)));
+	}
+
+	LOG_DBG("Multichannel sample rate converter initialized. Input sample rate: %d, Output "
+		"sample rate: %d, conversion ratio: %d, filter type: %d, channels: %d",
+		ctx->sample_rate_input, ctx->sample_rate_output, ctx->conversion_ratio,
+		ctx->filter_type, ctx->channels);
+	return 0;
+}
+
+int sample_rate_converter_mc_open(struct sample_rate_converter_mc_ctx *ctx, uint8_t channels)
+{
+	if (ctx == NULL) {
+		LOG_ERR("Context cannot be NULL");
+		return -EINVAL;
+	}
+
+	if ((channels == 0) || (channels > CONFIG_SAMPLE_RATE_CONVERTER_CHANNELS_MAX)) {
+		LOG_ERR("Invalid number of channels: %d", channels);
+		return -EINVAL;
+	}
+
+	memset(ctx, 0, sizeof(struct sample_rate_converter_mc_ctx));
+	ctx->channels = channels;
+
+	return 0;
+}
+
+int sample_rate_converter_mc_process(struct sample_rate_converter_mc_ctx *ctx,
+				     enum sample_rate_converter_filter filter,
+				     void const *const input, size_t input_size,
+				     uint32_t sample_rate_input, void *const output,
+				     size_t output_size, size_t *output_written,
+				     uint32_t sample_rate_output)
+{
+	int ret;
+
+	if ((ctx == NULL) || (input == NULL) || (output == NULL) || (output_written == NULL)) {
+		LOG_ERR("Null pointer received");
+		return -EINVAL;
+	}
+
+	if (ctx->channels == 0) {
+		LOG_ERR("Context not opened");
+		return -EINVAL;
+	}
+
+	size_t bytes_per_frame = sizeof(mc_sample_t) * ctx->channels;
+
+	if (input_size % bytes_per_frame != 0) {
+		LOG_ERR("Size of input is not a frame multiple");
+		return -EINVAL;
+	}
+
+	size_t frames_in = input_size / bytes_per_frame;
+
+	if (frames_in > CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX) {
+		LOG_ERR("Too many frames given as input");
+		return -EINVAL;
+	}
+
+	if ((ctx->sample_rate_input != sample_rate_input) ||
+	    (ctx->sample_rate_output != sample_rate_output) || (ctx->filter_type != filter)) {
+		LOG_DBG("State has changed, re-initializing filter");
+		ret = sample_rate_converter_mc_reconfigure(ctx, sample_rate_input,
+							   sample_rate_output, filter);
+		if (ret) {
+			LOG_ERR("Failed to initialize converter (%d)", ret);
+			return ret;
+		}
+	}
+
+	if ((ctx->conversion_ratio < 0) && ((frames_in % abs(ctx->conversion_ratio)) != 0)) {
+		LOG_ERR("Number of frames in must be a multiple of the conversion ratio (%d) when "
+			"downsampling",
+			ctx->conversion_ratio);
+		return -EINVAL;
+	}
+
+	if (ctx->conversion_ratio > 0) {
+		*output_written = input_size * ctx->conversion_ratio;
+	} else {
+		*output_written = input_size / abs(ctx->conversion_ratio);
+	}
+
+	if (*output_written > output_size) {
+		LOG_ERR("Conversion process will produce more bytes than the output buffer can "
+			"hold");
+		return -EINVAL;
+	}
+
+	mc_sample_t const *in = input;
+	mc_sample_t *out = output;
+	mc_sample_t const *coeffs = ctx->filter_coeffs;
+	size_t channels = ctx->channels;
+
+	if (ctx->conversion_ratio > 0) {
+		size_t ratio = ctx->conversion_ratio;
+		size_t phase_len = ctx->filter_size / ratio;
+
+		for (size_t frame = 0; frame < frames_in; frame++) {
+			int start = (int)frame - (int)ctx->delay - (int)(phase_len - 1);
+
+			/* Phases are ordered as in the CMSIS DSP interpolator. */
+			for (size_t phase = 0; phase < ratio; phase++) {
+				for (size_t channel = 0; channel < channels; channel++) {
+					q63_t acc = mc_dot_prod(MC_HISTORY(ctx, channel),
+								ctx->history_size, &in[channel],
+								channels, start,
+								&coeffs[ratio - 1 - phase], ratio,
+								phase_len);
+
+					*out++ = mc_sample_get(acc);
+				}
+			}
+		}
+	} else {
+		size_t ratio = abs(ctx->conversion_ratio);
+
+		for (size_t frame = ratio; frame <= frames_in; frame += ratio) {
+			int start = (int)frame - (int)ctx->filter_size;
+
+			for (size_t channel = 0; channel < channels; channel++) {
+				q63_t acc = mc_dot_prod(MC_HISTORY(ctx, channel),
+							ctx->history_size, &in[channel], channels,
+							start, coeffs, 1, ctx->filter_size);
+
+				*out++ = mc_sample_get(acc);
+			}
+		}
+	}
+
+	for (size_t channel = 0; channel < channels; channel++) {
+		mc_history_update(MC_HISTORY(ctx, channel), ctx->history_size, &in[channel],
+				  channels, frames_in);
+	}
+
+	return 0;
+}
@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "sample_rate_converter.h"
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/sys/util.h>
+#include <dsp/basic_math_functions.h>
+#include <dsp/fast_math_functions.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(sample_rate_converter_frac, CONFIG_SAMPLE_RATE_CONVERTER_LOG_LEVEL);
+
+#define PHASES	     CONFIG_SAMPLE_RATE_CONVERTER_FRACTIONAL_PHASES
+#define TAPS	     CONFIG_SAMPLE_RATE_CONVERTER_FRACTIONAL_TAPS
+#define HISTORY_SIZE SAMPLE_RATE_CONVERTER_FRAC_HISTORY_SIZE
+
+/* Filter cut-off relative to the Nyquist frequency of the lower sample rate. */
+#define CUTOFF_FACTOR 0.9f
+
+/* Largest supported ratio between the input and output sample rates. */
+#define RATIO_MAX 8
+
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+#define BYTES_PER_SAMPLE sizeof(q15_t)
+#define COEFF_SCALE	 32768.0f
+#define COEFF_MAX	 INT16_MAX
+#define COEFF_MIN	 INT16_MIN
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+#define BYTES_PER_SAMPLE sizeof(q31_t)
+#define COEFF_SCALE	 2147483648.0f
+#define COEFF_MAX	 INT32_MAX
+#define COEFF_MIN	 INT32_MIN
+#endif
+
+/**
+ * @brief Calculate a coefficient of the windowed-sinc prototype low-pass filter.
+ *
+ * @details The prototype filter runs at the input sample rate multiplied by the number of
+ *	    phases and has a Blackman window.
+ *
+ * @param[in]	i	Index of the coefficient.
+ * @param[in]	cutoff	Cut-off frequency relative to the prototype sample rate.
+ *
+ * @return Coefficient value.
+ */
+static float prototype_coeff(size_t i, float cutoff)
+{
+	const size_t len = PHASES * TAPS;
+	float x = (float)i - (float)(len - 1) / 2.0f;
+	float sinc;
+
+	if (x == 0.0f) {
+		sinc = 2.0f * cutoff;
+	} else {
+		sinc = arm_sin_f32(2.0f * PI * cutoff * x) / (PI * x);
+	}
+
+	float window = 0.42f - 0.5f * arm_cos_f32(2.0f * PI * i / (len - 1)) +
+		       0.08f * arm_cos_f32(4.0f * PI * i / (len - 1));
+
+	return sinc * window;
+}
+
+static void filter_generate(struct sample_rate_converter_frac_ctx *ctx)
+{
+	const size_t len = PHASES * TAPS;
+	float cutoff = CUTOFF_FACTOR * 0.5f *
+		       MIN(ctx->sample_rate_input, ctx->sample_rate_output) /
+		       ctx->sample_rate_input / PHASES;
+	float sum = 0.0f;
+
+	for (size_t i = 0; i < len; i++) {
+		sum += prototype_coeff(i, cutoff);
+	}
+
+	/* Every phase must have unity gain, so the whole filter has a gain of the number
+	 * of phases.
+	 */
+	float scale = PHASES / sum;
+
+	for (size_t phase = 0; phase < PHASES; phase++) {
+		for (size_t tap = 0; tap < TAPS; tap++) {
+			/* Coefficients are reversed, so the dot product can run over the
+			 * samples in the order they are stored.
+			 */
+			float coeff = prototype_coeff((TAPS - 1 - tap) * PHASES + phase, cutoff) *
+				      scale * COEFF_SCALE;
+			int64_t fixed = (int64_t)(coeff + ((coeff >= 0.0f) ? 0.5f : -0.5f));
+
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+			ctx->coeffs_15[phase][tap] = CLAMP(fixed, COEFF_MIN, COEFF_MAX);
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+			ctx->coeffs_31[phase][tap] = CLAMP(fixed, COEFF_MIN, COEFF_MAX);
+#endif
+		}
+	}
+}
+
+int sample_rate_converter_frac_open(struct sample_rate_converter_frac_ctx *ctx,
+				    uint32_t sample_rate_input, uint32_t sample_rate_output)
+{
+	if (ctx == NULL) {
+		LOG_ERR("Context cannot be NULL");
+		return -EINVAL;
+	}
+
+	if ((sample_rate_input == 0) || (sample_rate_output == 0) ||
+	    (sample_rate_input > (sample_rate_output * RATIO_MAX)) ||
+	    (sample_rate_output > (sample_rate_input * RATIO_MAX))) {
+		LOG_ERR("Invalid sample rates: %d -> %d", sample_rate_input, sample_rate_output);
+		return -EINVAL;
+	}
+
+	memset(ctx, 0, sizeof(struct sample_rate_converter_frac_ctx));
+
+	ctx->sample_rate_input = sample_rate_input;
+	ctx->sample_rate_output = sample_rate_output;
+	ctx->step_nominal = ((uint64_t)sample_rate_input << 32) / sample_rate_output;
+	ctx->step = ctx->step_nominal;
+
+	filter_generate(ctx);
+
+	LOG_DBG("Fractional sample rate converter initialized. Input sample rate: %d, Output "
+		"sample rate: %d",
+		sample_rate_input, sample_rate_output);
+
+	return 0;
+}
+
+size_t sample_rate_converter_frac_output_size(struct sample_rate_converter_frac_ctx const *ctx,
+					      size_t input_size)
+{
+	uint64_t limit = (uint64_t)(input_size / BYTES_PER_SAMPLE) << 32;
+
+	if ((ctx == NULL) || (ctx->step == 0) || (ctx->position >= limit)) {
+		return 0;
+	}
+
+	return ((limit - ctx->position + ctx->step - 1) / ctx->step) * BYTES_PER_SAMPLE;
+}
+
+int sample_rate_converter_frac_adjust(struct sample_rate_converter_frac_ctx *ctx,
+				      int32_t adjust_ppb)
+{
+	if (ctx == NULL) {
+		LOG_ERR("Context cannot be NULL");
+		return -EINVAL;
+	}
+
+	if ((adjust_ppb > SAMPLE_RATE_CONVERTER_FRAC_ADJUST_PPB_MAX) ||
+	    (adjust_ppb < -SAMPLE_RATE_CONVERTER_FRAC_ADJUST_PPB_MAX)) {
+		LOG_ERR("Ratio adjustment out of range: %d", adjust_ppb);
+		return -EINVAL;
+	}
+
+	ctx->step = ctx->step_nominal +
+		    ((int64_t)ctx->step_nominal * adjust_ppb) / 1000000000;
+
+	return 0;
+}
+
+int sample_rate_converter_frac_process(struct sample_rate_converter_frac_ctx *ctx,
+				       void const *const input, size_t input_size,
+				       void *const output, size_t output_size,
+				       size_t *output_written)
+{
+	if ((ctx == NULL) || (input == NULL) || (output == NULL) || (output_written == NULL)) {
+		LOG_ERR("Null pointer received");
+		return -EINVAL;
+	}
+
+	if (ctx->step == 0) {
+		LOG_ERR("Context not opened");
+		return -EINVAL;
+	}
+
+	if (input_size % BYTES_PER_SAMPLE != 0) {
+		LOG_ERR("Size of input is not a byte multiple");
+		return -EINVAL;
+	}
+
+	size_t samples_in = input_size / BYTES_PER_SAMPLE;
+
+	if (samples_in > CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX) {
+		LOG_ERR("Too many samples given as input");
+		return -EINVAL;
+	}
+
+	*output_written = sample_rate_converter_frac_output_size(ctx, input_size);
+	if (*output_written > output_size) {
+		LOG_ERR("Conversion process will produce more bytes than the output buffer can "
+			"hold");
+		return -EINVAL;
+	}
+
+	uint64_t limit = (uint64_t)samples_in << 32;
+	size_t out_idx = 0;
+
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+	q15_t *out = output;
+
+	memcpy(&ctx->work_buf_15[HISTORY_SIZE], input, input_size);
+
+	while (ctx->position < limit) {
+		size_t idx = ctx->position >> 32;
+		size_t phase = ((ctx->position & UINT32_MAX) * PHASES) >> 32;
+		q63_t acc;
+
+		/* The result is in 34.30 format. */
+		arm_dot_prod_q15(&ctx->work_buf_15[idx], ctx->coeffs_15[phase], TAPS, &acc);
+		out[out_idx++] = CLAMP(acc >> 15, INT16_MIN, INT16_MAX);
+		ctx->position += ctx->step;
+	}
+
+	memmove(ctx->work_buf_15, &ctx->work_buf_15[samples_in], HISTORY_SIZE * sizeof(q15_t));
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+	q31_t *out = output;
+
+	memcpy(&ctx->work_buf_31[HISTORY_SIZE], input, input_size);
+
+	while (ctx->position < limit) {
+		size_t idx = ctx->position >> 32;
+		size_t phase = ((ctx->position & UINT32_MAX) * PHASES) >> 32;
+		q63_t acc;
+
+		/* The result is in 16.48 format. */
+		arm_dot_prod_q31(&ctx->work_buf_31[idx], ctx->coeffs_31[phase], TAPS, &acc);
+		out[out_idx++] = CLAMP(acc >> 17, INT32_MIN, INT32_MAX);
+		ctx->position += ctx->step;
+	}
+
+	memmove(ctx->work_buf_31, &ctx->work_buf_31[samples_in], HISTORY_SIZE * sizeof(q31_t));
+#endif
+
+	ctx->position -= limit;
+
+	__ASSERT_NO_MSG(out_idx * BYTES_PER_SAMPLE == *output_written);
+
+	return 0;
+}
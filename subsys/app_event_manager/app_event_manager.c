@@ -6,6 +6,7 @@
 
 #include <stdio.h>
 #include <zephyr/kernel.h>
+#include <zephyr/init.h>
 #include <zephyr/spinlock.h>
 #include <zephyr/sys/slist.h>
 #include <app_event_manager.h>
@@ -15,14 +16,157 @@
 LOG_MODULE_REGISTER(app_event_manager, CONFIG_APP_EVENT_MANAGER_LOG_LEVEL);
 
 
+#define LANE_CNT _APP_EM_LANE_CNT
+
 static void event_processor_fn(struct k_work *work);
 
 struct app_event_manager_event_display_bm _app_event_manager_event_display_bm;
 
-static K_WORK_DEFINE(event_processor, event_processor_fn);
-static sys_slist_t eventq = SYS_SLIST_STATIC_INIT(&eventq);
+struct event_lane {
+	struct k_work work;
+	sys_slist_t eventq;
+	struct k_work_q *work_q;
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LANE_STATS)
+	struct app_event_manager_lane_stats stats;
+#endif
+};
+
+#define EVENT_LANE_INIT(i, _)						\
+	{								\
+		.work = Z_WORK_INITIALIZER(event_processor_fn),		\
+		.eventq = SYS_SLIST_STATIC_INIT(&lanes[i].eventq),	\
+	}
+
+static struct event_lane lanes[LANE_CNT] = {
+	LISTIFY(LANE_CNT, EVENT_LANE_INIT, (,))
+};
 static struct k_spinlock lock;
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LANES)
+static struct k_work_q lane_work_q[LANE_CNT - 1];
+static K_THREAD_STACK_ARRAY_DEFINE(lane_stack, LANE_CNT - 1,
+				   CONFIG_APP_EVENT_MANAGER_LANE_STACK_SIZE);
+
+/* Lane 0 is processed by the system workqueue, every next lane by a thread of higher priority. */
+#define LANE_THREAD_PRIO(i) \
+	(CONFIG_SYSTEM_WORKQUEUE_PRIORITY - (i) * CONFIG_APP_EVENT_MANAGER_LANE_PRIORITY_STEP)
+
+BUILD_ASSERT(LANE_THREAD_PRIO(LANE_CNT - 1) >=
+		     K_HIGHEST_THREAD_PRIO + CONFIG_NUM_METAIRQ_PRIORITIES,
+	     "Lane thread priorities exceed the highest cooperative priority");
+#endif
+
+static struct event_lane *event_lane_get(const struct event_type *et)
+{
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LANES)
+	__ASSERT_NO_MSG(et->lane < LANE_CNT);
+	return &lanes[et->lane];
+#else
+	return &lanes[0];
+#endif
+}
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_COALESCING)
+static uint32_t coalesced_cnt[CONFIG_APP_EVENT_MANAGER_MAX_EVENT_CNT];
+static const struct event_coalesce_key *coalesce_keys[CONFIG_APP_EVENT_MANAGER_MAX_EVENT_CNT];
+
+static void coalesce_keys_init(void)
+{
+	STRUCT_SECTION_FOREACH(event_coalesce_key, ck) {
+		size_t idx = ck->type - _event_type_list_start;
+
+		__ASSERT(!coalesce_keys[idx] || (coalesce_keys[idx] == ck),
+			 "Multiple key functions for %s", ck->type->name);
+		coalesce_keys[idx] = ck;
+	}
+}
+
+/* Replace not yet dispatched event of the same type and key with the new one.
+ * Must be called under spinlock. Returns the replaced event or NULL.
+ */
+static struct app_event_header *event_coalesce(struct event_lane *lane,
+					       struct app_event_header *aeh)
+{
+	const struct event_type *et = aeh->type_id;
+	const struct event_coalesce_key *ck = coalesce_keys[et - _event_type_list_start];
+	uint32_t key = ck ? ck->key(aeh) : 0;
+	sys_snode_t *prev = NULL;
+	sys_snode_t *node;
+
+	SYS_SLIST_FOR_EACH_NODE(&lane->eventq, node) {
+		struct app_event_header *queued = CONTAINER_OF(node, struct app_event_header,
+							       node);
+
+		if ((queued->type_id == et) && (!ck || (ck->key(queued) == key))) {
+			/* Keep position of the replaced event in the queue. */
+			sys_slist_insert(&lane->eventq, node, &aeh->node);
+			sys_slist_remove(&lane->eventq, prev, node);
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SUBMIT_TIMESTAMP)
+			aeh->submit_time = queued->submit_time;
+#endif
+			coalesced_cnt[et - _event_type_list_start]++;
+
+			return queued;
+		}
+
+		prev = node;
+	}
+
+	return NULL;
+}
+
+uint32_t app_event_manager_coalesced_cnt_get(const struct event_type *et)
+{
+	APP_EVENT_ASSERT_ID(et);
+
+	return coalesced_cnt[et - _event_type_list_start];
+}
+
+/* The replaced event is never processed. Let the coalesce hooks complete what the submit hooks
+ * recorded for it before the event is freed.
+ */
+static void event_coalesced_drop(struct app_event_header *aeh)
+{
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_COALESCE_HOOKS)) {
+		STRUCT_SECTION_FOREACH(event_coalesce_hook, h) {
+			h->hook(aeh);
+		}
+	}
+
+	app_event_manager_free(aeh);
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_COALESCING */
+
+static void lane_stats_submit(struct event_lane *lane)
+{
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LANE_STATS)
+	/* Called under spinlock. */
+	lane->stats.depth++;
+	if (lane->stats.depth > lane->stats.max_depth) {
+		lane->stats.max_depth = lane->stats.depth;
+	}
+#endif
+}
+
+static void lane_stats_dispatch(struct event_lane *lane, const struct app_event_header *aeh)
+{
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LANE_STATS)
+	uint32_t wait = k_cycle_get_32() - aeh->submit_time;
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	__ASSERT_NO_MSG(lane->stats.depth > 0);
+	lane->stats.depth--;
+	lane->stats.dispatched_cnt++;
+	lane->stats.wait_cycles_total += wait;
+	if (wait > lane->stats.wait_cycles_max) {
+		lane->stats.wait_cycles_max = wait;
+	}
+
+	k_spin_unlock(&lock, key);
+#endif
+}
+
 static bool log_is_event_displayed(const struct event_type *et)
 {
 	size_t idx = et - _event_type_list_start;
@@ -116,7 +260,13 @@ static void log_event_init(void)
 
 void * __weak app_event_manager_alloc(size_t size)
 {
-	void *event = k_malloc(size);
+	void *event;
+
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_MEM_POOL)) {
+		event = app_event_manager_mem_pool_alloc(size);
+	} else {
+		event = k_malloc(size);
+	}
 
 	if (unlikely(!event)) {
 		LOG_ERR("Application Event Manager OOM error\n");
@@ -134,22 +284,27 @@ void * __weak app_event_manager_alloc(size_t size)
 
 void __weak app_event_manager_free(void *addr)
 {
-	k_free(addr);
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_MEM_POOL)) {
+		app_event_manager_mem_pool_free(addr);
+	} else {
+		k_free(addr);
+	}
 }
 
 static void event_processor_fn(struct k_work *work)
 {
+	struct event_lane *lane = CONTAINER_OF(work, struct event_lane, work);
 	sys_slist_t events = SYS_SLIST_STATIC_INIT(&events);
 
 	/* Make current event list local. */
 	k_spinlock_key_t key = k_spin_lock(&lock);
 
-	if (sys_slist_is_empty(&eventq)) {
+	if (sys_slist_is_empty(&lane->eventq)) {
 		k_spin_unlock(&lock, key);
 		return;
 	}
 
-	sys_slist_merge_slist(&events, &eventq);
+	sys_slist_merge_slist(&events, &lane->eventq);
 
 	k_spin_unlock(&lock, key);
 
@@ -164,6 +319,8 @@ static void event_processor_fn(struct k_work *work)
 
 		const struct event_type *et = aeh->type_id;
 
+		lane_stats_dispatch(lane, aeh);
+
 		if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PREPROCESS_HOOKS)) {
 			STRUCT_SECTION_FOREACH(event_preprocess_hook, h) {
 				h->hook(aeh);
@@ -187,7 +344,15 @@ static void event_processor_fn(struct k_work *work)
 
 			log_event_progress(et, el);
 
-			consumed = el->notification(aeh);
+			if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_STATS)) {
+				uint32_t start = k_cycle_get_32();
+
+				consumed = el->notification(aeh);
+				_app_event_manager_stats_listener_record(et, es,
+									 k_cycle_get_32() - start);
+			} else {
+				consumed = el->notification(aeh);
+			}
 
 			if (consumed) {
 				log_event_consumed(et);
@@ -209,6 +374,14 @@ void _event_submit(struct app_event_header *aeh)
 	__ASSERT_NO_MSG(aeh);
 	APP_EVENT_ASSERT_ID(aeh->type_id);
 
+	struct event_lane *lane = event_lane_get(aeh->type_id);
+	struct app_event_header *replaced = NULL;
+	struct k_work_q *work_q;
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SUBMIT_TIMESTAMP)
+	aeh->submit_time = k_cycle_get_32();
+#endif
+
 	k_spinlock_key_t key = k_spin_lock(&lock);
 
 	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SUBMIT_HOOKS)) {
@@ -216,11 +389,77 @@ void _event_submit(struct app_event_header *aeh)
 			h->hook(aeh);
 		}
 	}
-	sys_slist_append(&eventq, &aeh->node);
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_COALESCING)
+	if (app_event_get_type_flag(aeh->type_id, APP_EVENT_TYPE_FLAGS_COALESCE)) {
+		replaced = event_coalesce(lane, aeh);
+	}
+#endif
+
+	if (!replaced) {
+		lane_stats_submit(lane);
+		sys_slist_append(&lane->eventq, &aeh->node);
+	}
+	work_q = lane->work_q;
+	k_spin_unlock(&lock, key);
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_COALESCING)
+	if (replaced) {
+		/* Processing of the lane is already pending. */
+		event_coalesced_drop(replaced);
+		return;
+	}
+#endif
+
+	if (work_q) {
+		k_work_submit_to_queue(work_q, &lane->work);
+	} else {
+		k_work_submit(&lane->work);
+	}
+}
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LANE_STATS)
+int app_event_manager_lane_stats_get(uint8_t lane, struct app_event_manager_lane_stats *stats)
+{
+	if (lane >= LANE_CNT) {
+		return -EINVAL;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	*stats = lanes[lane].stats;
 	k_spin_unlock(&lock, key);
 
-	k_work_submit(&event_processor);
+	return 0;
 }
+#endif /* CONFIG_APP_EVENT_MANAGER_LANE_STATS */
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LANES)
+static int lanes_init(void)
+{
+	for (size_t i = 1; i < LANE_CNT; i++) {
+		struct k_work_q *work_q = &lane_work_q[i - 1];
+		const struct k_work_queue_config cfg = {
+			.name = "app_event_lane",
+		};
+
+		k_work_queue_start(work_q, lane_stack[i - 1], K_THREAD_STACK_SIZEOF(lane_stack[i - 1]),
+				   LANE_THREAD_PRIO(i), &cfg);
+
+		k_spinlock_key_t key = k_spin_lock(&lock);
+
+		lanes[i].work_q = work_q;
+		k_spin_unlock(&lock, key);
+
+		/* Process events submitted before the work queue was started. */
+		k_work_submit_to_queue(work_q, &lanes[i].work);
+	}
+
+	return 0;
+}
+
+SYS_INIT(lanes_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+#endif /* CONFIG_APP_EVENT_MANAGER_LANES */
 
 int app_event_manager_init(void)
 {
@@ -231,6 +470,10 @@ int app_event_manager_init(void)
 
 	log_event_init();
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_COALESCING)
+	coalesce_keys_init();
+#endif
+
 	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_POSTINIT_HOOK)) {
 		STRUCT_SECTION_FOREACH(app_event_manager_postinit_hook, h) {
 			ret = h->hook();
@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/util.h>
+#include <app_event_manager.h>
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_DECLARE(app_event_manager, CONFIG_APP_EVENT_MANAGER_LOG_LEVEL);
+
+/* Memory slab requires block size to be a multiple of the pointer size. */
+#define MEM_CLASS_ALIGN		sizeof(void *)
+#define MEM_CLASS_CNT_MAX	CONFIG_APP_EVENT_MANAGER_MEM_POOL_CLASS_MAX
+
+/* Every event type with dynamic data adds size classes for 1/4, 1/2 and
+ * the full configured dynamic data size.
+ */
+#define DYNDATA_BUCKET_CNT	3
+#define CANDIDATE_CNT_MAX	(CONFIG_APP_EVENT_MANAGER_MAX_EVENT_CNT * (1 + DYNDATA_BUCKET_CNT))
+
+struct mem_class {
+	struct k_mem_slab slab;
+	const uint8_t *buf_start;
+	const uint8_t *buf_end;
+	size_t block_size;
+	uint32_t block_cnt;
+	uint32_t max_used;
+};
+
+static uint8_t pool_buf[CONFIG_APP_EVENT_MANAGER_MEM_POOL_SIZE] __aligned(MEM_CLASS_ALIGN);
+static struct mem_class mem_classes[MEM_CLASS_CNT_MAX];
+static size_t mem_class_cnt;
+static atomic_t heap_fallback_cnt;
+static struct k_spinlock lock;
+
+static void candidate_add(size_t *sizes, size_t *cnt, size_t size)
+{
+	size = ROUND_UP(size, MEM_CLASS_ALIGN);
+
+	/* Keep the array sorted and free of duplicates. */
+	size_t pos = 0;
+
+	while ((pos < *cnt) && (sizes[pos] < size)) {
+		pos++;
+	}
+
+	if ((pos < *cnt) && (sizes[pos] == size)) {
+		return;
+	}
+
+	__ASSERT_NO_MSG(*cnt < CANDIDATE_CNT_MAX);
+
+	memmove(&sizes[pos + 1], &sizes[pos], (*cnt - pos) * sizeof(sizes[0]));
+	sizes[pos] = size;
+	(*cnt)++;
+}
+
+static void candidates_reduce(size_t *sizes, size_t *cnt)
+{
+	/* Merge the class that wastes the least memory when served by the next
+	 * bigger class until the limit is met. The biggest class is always kept.
+	 */
+	while (*cnt > MEM_CLASS_CNT_MAX) {
+		size_t best = 0;
+
+		for (size_t i = 1; i < *cnt - 1; i++) {
+			if ((sizes[i + 1] - sizes[i]) < (sizes[best + 1] - sizes[best])) {
+				best = i;
+			}
+		}
+
+		memmove(&sizes[best], &sizes[best + 1], (*cnt - best - 1) * sizeof(sizes[0]));
+		(*cnt)--;
+	}
+}
+
+static int mem_pool_init(void)
+{
+	size_t sizes[CANDIDATE_CNT_MAX];
+	size_t cnt = 0;
+
+	STRUCT_SECTION_FOREACH(event_type, et) {
+		size_t struct_size = et->struct_size;
+
+		candidate_add(sizes, &cnt, struct_size);
+
+		if (app_event_get_type_flag(et, APP_EVENT_TYPE_FLAGS_HAS_DYNDATA)) {
+			for (size_t i = 0; i < DYNDATA_BUCKET_CNT; i++) {
+				candidate_add(sizes, &cnt, struct_size +
+					      (CONFIG_APP_EVENT_MANAGER_MEM_POOL_DYNDATA_SIZE >> i));
+			}
+		}
+	}
+
+	candidates_reduce(sizes, &cnt);
+
+	uint8_t *buf = pool_buf;
+	size_t buf_left = sizeof(pool_buf);
+
+	for (size_t i = 0; i < cnt; i++) {
+		struct mem_class *mc = &mem_classes[mem_class_cnt];
+		uint32_t block_cnt = MIN(CONFIG_APP_EVENT_MANAGER_MEM_POOL_BLOCK_CNT,
+					 buf_left / sizes[i]);
+
+		if (block_cnt == 0) {
+			LOG_WRN("No space in pool for events of size %zu", sizes[i]);
+			break;
+		}
+
+		int err = k_mem_slab_init(&mc->slab, buf, sizes[i], block_cnt);
+
+		if (err) {
+			LOG_ERR("Cannot initialize memory slab (err: %d)", err);
+			return err;
+		}
+
+		mc->buf_start = buf;
+		mc->buf_end = buf + sizes[i] * block_cnt;
+		mc->block_size = sizes[i];
+		mc->block_cnt = block_cnt;
+		mc->max_used = 0;
+
+		buf += sizes[i] * block_cnt;
+		buf_left -= sizes[i] * block_cnt;
+		mem_class_cnt++;
+	}
+
+	return 0;
+}
+
+static void mem_class_usage_update(struct mem_class *mc)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	uint32_t used = k_mem_slab_num_used_get(&mc->slab);
+
+	if (used > mc->max_used) {
+		mc->max_used = used;
+	}
+
+	k_spin_unlock(&lock, key);
+}
+
+void *app_event_manager_mem_pool_alloc(size_t size)
+{
+	/* Size classes are sorted. If the best fitting class is exhausted,
+	 * a bigger one is used.
+	 */
+	for (size_t i = 0; i < mem_class_cnt; i++) {
+		struct mem_class *mc = &mem_classes[i];
+		void *block;
+
+		if (mc->block_size < size) {
+			continue;
+		}
+
+		if (!k_mem_slab_alloc(&mc->slab, &block, K_NO_WAIT)) {
+			mem_class_usage_update(mc);
+			return block;
+		}
+	}
+
+	atomic_inc(&heap_fallback_cnt);
+
+	return k_malloc(size);
+}
+
+void app_event_manager_mem_pool_free(void *addr)
+{
+	const uint8_t *ptr = addr;
+
+	if ((ptr >= pool_buf) && (ptr < (pool_buf + sizeof(pool_buf)))) {
+		for (size_t i = 0; i < mem_class_cnt; i++) {
+			struct mem_class *mc = &mem_classes[i];
+
+			if ((ptr >= mc->buf_start) && (ptr < mc->buf_end)) {
+				k_mem_slab_free(&mc->slab, addr);
+				return;
+			}
+		}
+
+		__ASSERT(false, "Invalid pointer freed");
+		return;
+	}
+
+	k_free(addr);
+}
+
+size_t app_event_manager_mem_pool_class_cnt(void)
+{
+	return mem_class_cnt;
+}
+
+int app_event_manager_mem_pool_class_stats_get(size_t idx,
+					       struct app_event_manager_mem_pool_class_stats *stats)
+{
+	if (idx >= mem_class_cnt) {
+		return -EINVAL;
+	}
+
+	struct mem_class *mc = &mem_classes[idx];
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	stats->block_size = mc->block_size;
+	stats->block_cnt = mc->block_cnt;
+	stats->used = k_mem_slab_num_used_get(&mc->slab);
+	stats->max_used = mc->max_used;
+
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+uint32_t app_event_manager_mem_pool_heap_fallback_cnt(void)
+{
+	return atomic_get(&heap_fallback_cnt);
+}
+
+SYS_INIT(mem_pool_init, PRE_KERNEL_1, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
@@ -219,6 +219,18 @@ extern "C" {
 #define _APP_EVENT_TYPE_DEFINE_SIZES(ename)
 #endif
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LANES)
+#define _APP_EM_LANE_CNT CONFIG_APP_EVENT_MANAGER_LANE_CNT
+#define _APP_EVENT_TYPE_DEFINE_LANE(lane_id)	\
+	.lane = (lane_id),
+#else
+#define _APP_EM_LANE_CNT 1
+#define _APP_EVENT_TYPE_DEFINE_LANE(lane_id)
+#endif
+
+/* Dispatch lane is an optional argument of event type definition. */
+#define _APP_EVENT_LANE_GET(...) COND_CODE_1(IS_EMPTY(__VA_ARGS__), (0), (__VA_ARGS__))
+
 /** @brief Event header.
  *
  * When defining an event structure, the application event header
@@ -230,6 +242,11 @@ struct app_event_header {
 
 	/** Pointer to the event type object. */
 	const struct event_type *type_id;
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SUBMIT_TIMESTAMP)
+	/** Submission time in hardware cycles. */
+	uint32_t submit_time;
+#endif
 };
 
 /** Function to log data from this event. */
@@ -286,12 +303,17 @@ struct event_type {
 	const void *trace_data;
 
 	/** Array of flags dedicated to event type. */
-	const uint8_t flags;
+	const uint16_t flags;
 
 #if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PROVIDE_EVENT_SIZE)
 	/** The size of the event structure */
 	uint16_t struct_size;
 #endif
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LANES)
+	/** Dispatch lane of the event type. */
+	uint8_t lane;
+#endif
 };
 
 
@@ -299,10 +321,11 @@ extern struct event_type _event_type_list_start[];
 extern struct event_type _event_type_list_end[];
 
 
-#define _APP_EVENT_TYPE_DEFINE(ename, log_fn, trace_data_pointer, et_flags)		\
+#define _APP_EVENT_TYPE_DEFINE(ename, log_fn, trace_data_pointer, et_flags, lane_id)	\
 	BUILD_ASSERT(((et_flags) & ((BIT_MASK(APP_EVENT_TYPE_FLAGS_USER_SETTABLE_START-	\
 		APP_EVENT_TYPE_FLAGS_SYSTEM_START))<<					\
 		APP_EVENT_TYPE_FLAGS_SYSTEM_START)) == 0);				\
+	BUILD_ASSERT((lane_id) < _APP_EM_LANE_CNT, "Invalid event dispatch lane");	\
 	_APP_EVENT_SUBSCRIBERS_ARRAY_TAGS(ename);					\
 	STRUCT_SECTION_ITERABLE(event_type, _CONCAT(__event_type_, ename)) = {		\
 		.name            = STRINGIFY(ename),					\
@@ -315,6 +338,7 @@ extern struct event_type _event_type_list_end[];
 				((et_flags) | BIT(APP_EVENT_TYPE_FLAGS_HAS_DYNDATA)) :	\
 				((et_flags) & (~BIT(APP_EVENT_TYPE_FLAGS_HAS_DYNDATA)))),\
 		_APP_EVENT_TYPE_DEFINE_SIZES(ename) /* No comma here intentionally */	\
+		_APP_EVENT_TYPE_DEFINE_LANE(lane_id) /* No comma here intentionally */	\
 	}
 
 /**
@@ -354,6 +378,11 @@ extern struct app_event_manager_event_display_bm _app_event_manager_event_displa
 		     "Enable APP_EVENT_MANAGER_POSTPROCESS_HOOKS before usage"); \
 	_APP_EVENT_HOOK_REGISTER(event_postprocess_hook, hook_fn, prio)
 
+#define _APP_EVENT_HOOK_ON_COALESCE_REGISTER(hook_fn, prio)                     \
+	BUILD_ASSERT(IS_ENABLED(CONFIG_APP_EVENT_MANAGER_COALESCE_HOOKS),     \
+		     "Enable APP_EVENT_MANAGER_COALESCE_HOOKS before usage"); \
+	_APP_EVENT_HOOK_REGISTER(event_coalesce_hook, hook_fn, prio)
+
 /**
  * @brief Joining together event type flags.
  */
@@ -411,6 +440,25 @@ struct event_submit_hook {
 	void (*hook)(const struct app_event_header *aeh);
 };
 
+/** @brief Structure used to register coalescing key function of an event type
+ */
+struct event_coalesce_key {
+	/** @brief Event type */
+	const struct event_type *type;
+
+	/** @brief Key function */
+	uint32_t (*key)(const struct app_event_header *aeh);
+};
+
+#define _APP_EVENT_COALESCE_KEY_REGISTER(ename, key_fn)				\
+	BUILD_ASSERT(IS_ENABLED(CONFIG_APP_EVENT_MANAGER_COALESCING),		\
+		     "Enable APP_EVENT_MANAGER_COALESCING before usage");	\
+	STRUCT_SECTION_ITERABLE(event_coalesce_key,				\
+				_CONCAT(__event_coalesce_key_, ename)) = {	\
+		.type = _EVENT_ID(ename),					\
+		.key = (key_fn),						\
+	}
+
 /** @brief Structure used to register event preprocess hook
  */
 struct event_preprocess_hook {
@@ -425,6 +473,13 @@ struct event_postprocess_hook {
 	void (*hook)(const struct app_event_header *aeh);
 };
 
+/** @brief Structure used to register event coalesce hook
+ */
+struct event_coalesce_hook {
+	/** @brief Hook function */
+	void (*hook)(const struct app_event_header *aeh);
+};
+
 
 
 /** @brief Submit an event to the Application Event Manager.
@@ -433,6 +488,16 @@ struct event_postprocess_hook {
  */
 void _event_submit(struct app_event_header *aeh);
 
+/** @brief Record listener call in the event processing statistics.
+ *
+ * @param et      Pointer to the event type.
+ * @param es      Pointer to the event subscriber.
+ * @param cycles  Number of cycles spent in the listener.
+ */
+void _app_event_manager_stats_listener_record(const struct event_type *et,
+					      const struct event_subscriber *es,
+					      uint32_t cycles);
+
 #ifdef __cplusplus
 }
 #endif
@@ -5,6 +5,7 @@
  */
 
 #include <stdlib.h>
+#include <inttypes.h>
 #include <zephyr/shell/shell.h>
 #include <app_event_manager.h>
 
@@ -81,6 +82,140 @@ static int show_subscribers(const struct shell *shell, size_t argc,
 	return 0;
 }
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_MEM_POOL)
+static int show_mem_pool(const struct shell *shell, size_t argc,
+			 char **argv)
+{
+	shell_fprintf(shell, SHELL_NORMAL, "Event memory pool:\n");
+
+	for (size_t i = 0; i < app_event_manager_mem_pool_class_cnt(); i++) {
+		struct app_event_manager_mem_pool_class_stats stats;
+		int err = app_event_manager_mem_pool_class_stats_get(i, &stats);
+
+		__ASSERT_NO_MSG(!err);
+		ARG_UNUSED(err);
+
+		shell_fprintf(shell, SHELL_NORMAL,
+			      "|	[%zu B] used: %" PRIu32 "/%" PRIu32 " max: %" PRIu32 "\n",
+			      stats.block_size, stats.used, stats.block_cnt, stats.max_used);
+	}
+
+	shell_fprintf(shell, SHELL_NORMAL, "|	heap fallbacks: %" PRIu32 "\n",
+		      app_event_manager_mem_pool_heap_fallback_cnt());
+
+	return 0;
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_MEM_POOL */
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LANE_STATS)
+static int show_lanes(const struct shell *shell, size_t argc,
+		      char **argv)
+{
+	shell_fprintf(shell, SHELL_NORMAL, "Dispatch lanes:\n");
+
+	for (uint8_t lane = 0; lane < CONFIG_APP_EVENT_MANAGER_LANE_CNT; lane++) {
+		struct app_event_manager_lane_stats stats;
+		int err = app_event_manager_lane_stats_get(lane, &stats);
+
+		__ASSERT_NO_MSG(!err);
+		ARG_UNUSED(err);
+
+		uint64_t wait_avg_us = (stats.dispatched_cnt > 0) ?
+			(k_cyc_to_us_floor64(stats.wait_cycles_total) / stats.dispatched_cnt) : 0;
+
+		shell_fprintf(shell, SHELL_NORMAL,
+			      "|\t[%" PRIu8 "] dispatched: %" PRIu32 " depth: %" PRIu32
+			      " max depth: %" PRIu32 " wait avg: %" PRIu64 " us max: %" PRIu32
+			      " us\n",
+			      lane, stats.dispatched_cnt, stats.depth, stats.max_depth,
+			      wait_avg_us, k_cyc_to_us_floor32(stats.wait_cycles_max));
+	}
+
+	return 0;
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_LANE_STATS */
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_COALESCING)
+static int show_coalesced(const struct shell *shell, size_t argc,
+			  char **argv)
+{
+	shell_fprintf(shell, SHELL_NORMAL, "Coalesced events:\n");
+
+	STRUCT_SECTION_FOREACH(event_type, et) {
+		if (!app_event_get_type_flag(et, APP_EVENT_TYPE_FLAGS_COALESCE)) {
+			continue;
+		}
+
+		shell_fprintf(shell, SHELL_NORMAL, "|\t[E:%s] %" PRIu32 "\n",
+			      et->name, app_event_manager_coalesced_cnt_get(et));
+	}
+
+	return 0;
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_COALESCING */
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_STATS)
+static uint32_t avg_us(uint64_t cycles_total, uint32_t cnt)
+{
+	return (cnt > 0) ? (k_cyc_to_us_floor64(cycles_total) / cnt) : 0;
+}
+
+static int show_stats(const struct shell *shell, size_t argc,
+		      char **argv)
+{
+	shell_fprintf(shell, SHELL_NORMAL, "Event processing statistics:\n");
+
+	STRUCT_SECTION_FOREACH(event_type, et) {
+		struct app_event_manager_event_stats es_stats;
+
+		app_event_manager_event_stats_get(et, &es_stats);
+		if (es_stats.dispatch_cnt == 0) {
+			continue;
+		}
+
+		shell_fprintf(shell, SHELL_NORMAL,
+			      "[E:%s] dispatched: %" PRIu32 " queue avg: %" PRIu32 " us max: %"
+			      PRIu32 " us handlers avg: %" PRIu32 " us\n",
+			      et->name, es_stats.dispatch_cnt,
+			      avg_us(es_stats.queue_cycles_total, es_stats.dispatch_cnt),
+			      k_cyc_to_us_floor32(es_stats.queue_cycles_max),
+			      avg_us(es_stats.handler_cycles_total, es_stats.dispatch_cnt));
+
+		for (const struct event_subscriber *es = et->subs_start;
+		     es != et->subs_stop;
+		     es++) {
+			struct app_event_manager_listener_stats el_stats;
+			int err = app_event_manager_listener_stats_get(et, es->listener,
+								       &el_stats);
+
+			if (err) {
+				shell_fprintf(shell, SHELL_NORMAL, "|\t[L:%s] not tracked\n",
+					      es->listener->name);
+				continue;
+			}
+
+			shell_fprintf(shell, SHELL_NORMAL,
+				      "|\t[L:%s] calls: %" PRIu32 " avg: %" PRIu32 " us max: %"
+				      PRIu32 " us\n",
+				      es->listener->name, el_stats.call_cnt,
+				      avg_us(el_stats.cycles_total, el_stats.call_cnt),
+				      k_cyc_to_us_floor32(el_stats.cycles_max));
+		}
+	}
+
+	return 0;
+}
+
+static int reset_stats(const struct shell *shell, size_t argc,
+		       char **argv)
+{
+	app_event_manager_stats_reset();
+	shell_fprintf(shell, SHELL_NORMAL, "Event processing statistics reset\n");
+
+	return 0;
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_STATS */
+
 static void set_event_displaying(const struct shell *shell, size_t argc,
 				 char **argv, bool enable)
 {
@@ -155,6 +290,16 @@ SHELL_STATIC_SUBCMD_SET_CREATE(sub_app_event_manager,
 	SHELL_CMD_ARG(show_subscribers, NULL, "Show subscribers",
 		      show_subscribers, 0, 0),
 	SHELL_CMD_ARG(show_events, NULL, "Show events", show_events, 0, 0),
+	SHELL_COND_CMD_ARG(CONFIG_APP_EVENT_MANAGER_MEM_POOL, show_mem_pool, NULL,
+			   "Show event memory pool usage", show_mem_pool, 0, 0),
+	SHELL_COND_CMD_ARG(CONFIG_APP_EVENT_MANAGER_LANE_STATS, show_lanes, NULL,
+			   "Show dispatch lane statistics", show_lanes, 0, 0),
+	SHELL_COND_CMD_ARG(CONFIG_APP_EVENT_MANAGER_COALESCING, show_coalesced, NULL,
+			   "Show number of coalesced events", show_coalesced, 0, 0),
+	SHELL_COND_CMD_ARG(CONFIG_APP_EVENT_MANAGER_STATS, show_stats, NULL,
+			   "Show event processing statistics", show_stats, 0, 0),
+	SHELL_COND_CMD_ARG(CONFIG_APP_EVENT_MANAGER_STATS, reset_stats, NULL,
+			   "Reset event processing statistics", reset_stats, 0, 0),
 	SHELL_CMD_ARG(disable, NULL, "Disable displaying event with given ID",
 		      disable_event_displaying, 0,
 		      sizeof(_app_event_manager_event_display_bm) * 8 - 1),
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/spinlock.h>
+#include <app_event_manager.h>
+
+extern const struct event_subscriber __start_event_subscribers_all[];
+extern const struct event_subscriber __stop_event_subscribers_all[];
+
+#define SUBSCRIPTION_CNT_MAX CONFIG_APP_EVENT_MANAGER_STATS_SUBSCRIPTION_MAX
+
+static struct app_event_manager_event_stats event_stats[CONFIG_APP_EVENT_MANAGER_MAX_EVENT_CNT];
+static struct app_event_manager_listener_stats listener_stats[SUBSCRIPTION_CNT_MAX];
+static struct k_spinlock lock;
+
+
+static size_t subscription_idx(const struct event_subscriber *es)
+{
+	/* Subscriber array boundary tags are zero-length, so the subscribers of all
+	 * event types form a single array.
+	 */
+	__ASSERT_NO_MSG((es >= __start_event_subscribers_all) &&
+			(es < __stop_event_subscribers_all));
+
+	return es - __start_event_subscribers_all;
+}
+
+static size_t event_type_idx(const struct event_type *et)
+{
+	APP_EVENT_ASSERT_ID(et);
+
+	return et - _event_type_list_start;
+}
+
+static void event_stats_preprocess(const struct app_event_header *aeh)
+{
+	struct app_event_manager_event_stats *stats = &event_stats[event_type_idx(aeh->type_id)];
+	uint32_t delay = k_cycle_get_32() - aeh->submit_time;
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	stats->dispatch_cnt++;
+	stats->queue_cycles_total += delay;
+	if (delay > stats->queue_cycles_max) {
+		stats->queue_cycles_max = delay;
+	}
+
+	k_spin_unlock(&lock, key);
+}
+
+APP_EVENT_HOOK_PREPROCESS_REGISTER(event_stats_preprocess);
+
+void _app_event_manager_stats_listener_record(const struct event_type *et,
+					      const struct event_subscriber *es,
+					      uint32_t cycles)
+{
+	size_t idx = subscription_idx(es);
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	event_stats[event_type_idx(et)].handler_cycles_total += cycles;
+
+	if (idx < ARRAY_SIZE(listener_stats)) {
+		struct app_event_manager_listener_stats *stats = &listener_stats[idx];
+
+		stats->call_cnt++;
+		stats->cycles_total += cycles;
+		if (cycles > stats->cycles_max) {
+			stats->cycles_max = cycles;
+		}
+	}
+
+	k_spin_unlock(&lock, key);
+}
+
+void app_event_manager_event_stats_get(const struct event_type *et,
+				       struct app_event_manager_event_stats *stats)
+{
+	size_t idx = event_type_idx(et);
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	*stats = event_stats[idx];
+	k_spin_unlock(&lock, key);
+}
+
+int app_event_manager_listener_stats_get(const struct event_type *et,
+					 const struct event_listener *el,
+					 struct app_event_manager_listener_stats *stats)
+{
+	APP_EVENT_ASSERT_ID(et);
+
+	for (const struct event_subscriber *es = et->subs_start; es != et->subs_stop; es++) {
+		if (es->listener != el) {
+			continue;
+		}
+
+		size_t idx = subscription_idx(es);
+
+		if (idx >= ARRAY_SIZE(listener_stats)) {
+			return -ENOMEM;
+		}
+
+		k_spinlock_key_t key = k_spin_lock(&lock);
+
+		*stats = listener_stats[idx];
+		k_spin_unlock(&lock, key);
+
+		return 0;
+	}
+
+	return -ENOENT;
+}
+
+void app_event_manager_stats_reset(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	memset(event_stats, 0, sizeof(event_stats));
+	memset(listener_stats, 0, sizeof(listener_stats));
+	k_spin_unlock(&lock, key);
+}
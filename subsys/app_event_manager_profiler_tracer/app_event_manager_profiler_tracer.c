@@ -58,6 +58,17 @@ static void app_event_manager_trace_event_postprocess(const struct app_event_hea
 APP_EVENT_HOOK_PREPROCESS_REGISTER_FIRST(app_event_manager_trace_event_preprocess);
 APP_EVENT_HOOK_POSTPROCESS_REGISTER_LAST(app_event_manager_trace_event_postprocess);
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_COALESCE_HOOKS)
+static void app_event_manager_trace_event_coalesce(const struct app_event_header *aeh)
+{
+	/* Coalesced event is not processed. Close its processing right away. */
+	app_event_manager_trace_event_execution(aeh, true);
+	app_event_manager_trace_event_execution(aeh, false);
+}
+
+APP_EVENT_HOOK_ON_COALESCE_REGISTER(app_event_manager_trace_event_coalesce);
+#endif /* CONFIG_APP_EVENT_MANAGER_COALESCE_HOOKS */
+
 /** @brief Trace event submission.
  *
  * @param aeh Pointer to the application event header of the event that is
@@ -130,36 +130,87 @@ static bool validate_parameters(struct audio_module_parameters const *const para
 		return false;
 	}
 
+	if (parameters->thread.data_slab != NULL &&
+	    parameters->thread.data_slab->info.num_blocks > CONFIG_AUDIO_MODULE_DATA_BLOCKS_MAX) {
+		LOG_ERR("Data slab has %d blocks, maximum is %d",
+			parameters->thread.data_slab->info.num_blocks,
+			CONFIG_AUDIO_MODULE_DATA_BLOCKS_MAX);
+		return false;
+	}
+
 	return true;
 }
 
 /**
- * @brief General callback for releasing the data when inter-module data
- *        passing.
+ * @brief Helper function to get the reference count of an audio data buffer.
  *
- * @param handle      [in/out]  The handle of the sending modules instance.
+ * @param handle  [in]  The handle of the module that owns the data slab.
+ * @param data    [in]  Pointer to a buffer from the module's data slab.
+ *
+ * @return Pointer to the reference count, NULL if the buffer is not a block of the data slab.
+ */
+static atomic_t *data_ref_get(struct audio_module_handle *handle, void const *const data)
+{
+	struct k_mem_slab *slab = handle->thread.data_slab;
+	size_t offset;
+	size_t idx;
+
+	if (slab == NULL || (char const *)data < slab->buffer) {
+		return NULL;
+	}
+
+	offset = (char const *)data - slab->buffer;
+	if (offset % slab->info.block_size) {
+		return NULL;
+	}
+
+	idx = offset / slab->info.block_size;
+	if (idx >= slab->info.num_blocks || idx >= CONFIG_AUDIO_MODULE_DATA_BLOCKS_MAX) {
+		return NULL;
+	}
+
+	return &handle->data_ref[idx];
+}
+
+/**
+ * @brief Helper function to release one reference to an audio data buffer and free the buffer
+ *        when the last reference is released.
+ *
+ * @param handle      [in/out]  The handle of the module that owns the data slab.
  * @param audio_data  [in]      Pointer to the audio data to release.
  */
-static void audio_data_release_cb(struct audio_module_handle_private *handle,
-				  struct audio_data const *const audio_data)
+static void data_ref_release(struct audio_module_handle *handle,
+			     struct audio_data const *const audio_data)
 {
-	int ret;
-	struct audio_module_handle *hdl = (struct audio_module_handle *)handle;
+	atomic_t *ref = data_ref_get(handle, audio_data->data);
 
-	ret = k_sem_take(&hdl->sem, K_NO_WAIT);
-	if (ret) {
-		LOG_ERR("Failed to take semaphore for data release callback function");
+	if (ref == NULL) {
+		LOG_ERR("Audio data %p is not a block of the data slab of module %s",
+			audio_data->data, handle->name);
 		return;
 	}
 
-	if (k_sem_count_get(&hdl->sem) == 0) {
-		LOG_DBG("Audio data has been consumed in module %s", hdl->name);
+	if (atomic_dec(ref) == 1) {
+		LOG_DBG("Audio data has been consumed in module %s", handle->name);
 
 		/* Audio data has been consumed by all modules so now can free the data memory. */
-		k_mem_slab_free(hdl->thread.data_slab, (void *)audio_data->data);
+		k_mem_slab_free(handle->thread.data_slab, (void *)audio_data->data);
 	}
 }
 
+/**
+ * @brief General callback for releasing the data when inter-module data
+ *        passing.
+ *
+ * @param handle      [in/out]  The handle of the sending modules instance.
+ * @param audio_data  [in]      Pointer to the audio data to release.
+ */
+static void audio_data_release_cb(struct audio_module_handle_private *handle,
+				  struct audio_data const *const audio_data)
+{
+	data_ref_release((struct audio_module_handle *)handle, audio_data);
+}
+
 /**
  * @brief Send an audio data item to a module, all data is consumed by the module.
  *
@@ -248,11 +299,6 @@ static int tx_fifo_put(struct audio_module_handle *handle,
 
 		data_fifo_block_free(handle->thread.msg_tx, (void *)data_msg_tx);
 
-		ret = k_sem_take(&handle->sem, K_NO_WAIT);
-		if (ret) {
-			LOG_ERR("Failed to take semaphore for TX FIFO put");
-		}
-
 		return ret;
 	}
 
@@ -273,6 +319,8 @@ static int send_to_connected_modules(struct audio_module_handle *handle,
 				     struct audio_data const *const audio_data)
 {
 	int ret;
+	int err = 0;
+	atomic_t *ref;
 	struct audio_module_handle *handle_to;
 
 	if (handle->dest_count == 0) {
@@ -284,63 +332,74 @@ static int send_to_connected_modules(struct audio_module_handle *handle,
 		return 0;
 	}
 
-	/* We need to ensure that all receiving modules have got the audio data.
-	 * This is so the first receiver cannot free the audio data before all receivers
-	 * have all gotten the audio data.
-	 */
-	ret = k_mutex_lock(&handle->dest_mutex, LOCK_TIMEOUT_US);
-	if (ret) {
-		LOG_ERR("Failed to take MUTEX lock in time");
-		return ret;
+	ref = data_ref_get(handle, audio_data->data);
+	if (ref == NULL) {
+		/* The audio data cannot be returned to the data slab, so it would leak. */
+		__ASSERT(false, "Audio data %p is not a block of the data slab of module %s",
+			 audio_data->data, handle->name);
+		LOG_ERR("Audio data %p is not a block of the data slab of module %s",
+			audio_data->data, handle->name);
+		return -EINVAL;
 	}
 
-	/* Here the semaphore is used as a count of the number of audio data items out in the
-	 * connected modules.
+	__ASSERT(atomic_get(ref) == 0, "Audio data %p in module %s is already in use",
+		 audio_data->data, handle->name);
+
+	/* The sending module holds a reference while the audio data is passed on, so a receiver
+	 * that consumes it straight away cannot free it before all receivers have it. Each
+	 * receiver takes its own reference before the audio data is queued to it.
 	 */
-	ret = k_sem_init(&handle->sem, handle->dest_count, handle->dest_count);
+	atomic_set(ref, 1);
+
+	/* The destinations list is modified by connect and disconnect under the mutex. */
+	ret = k_mutex_lock(&handle->dest_mutex, LOCK_TIMEOUT_US);
 	if (ret) {
-		LOG_ERR("Failed to initiate semaphore");
-		return ret;
-	}
+		LOG_ERR("Failed to take MUTEX lock in time");
+		err = ret;
+	} else {
+		/* Send to all internally connected modules. */
+		SYS_SLIST_FOR_EACH_CONTAINER(&handle->handle_dest_list, handle_to, node) {
+			atomic_inc(ref);
 
-	/* Send to all internally connected modules. */
-	SYS_SLIST_FOR_EACH_CONTAINER(&handle->handle_dest_list, handle_to, node) {
-		ret = data_tx(handle, handle_to, audio_data, &audio_data_release_cb);
-		if (ret) {
-			LOG_ERR("Failed to send audio data to module %s from %s, ret %d",
-				handle_to->name, handle->name, ret);
+			ret = data_tx(handle, handle_to, audio_data, &audio_data_release_cb);
+			if (ret) {
+				atomic_dec(ref);
 
-			return ret;
+				LOG_ERR("Failed to send audio data to module %s from %s, ret %d",
+					handle_to->name, handle->name, ret);
+				err = ret;
+			}
 		}
-	}
 
-	ret = k_mutex_unlock(&handle->dest_mutex);
-	if (ret) {
-		LOG_ERR("Failed to release MUTEX");
-		return ret;
+		ret = k_mutex_unlock(&handle->dest_mutex);
+		if (ret) {
+			LOG_ERR("Failed to release MUTEX");
+			err = ret;
+		}
 	}
 
 	/* Send to this module's TX FIFO for extraction by an external
 	 * process with audio_module_rx().
 	 */
 	if (handle->use_tx_queue && handle->thread.msg_tx) {
+		atomic_inc(ref);
+
 		ret = tx_fifo_put(handle, audio_data);
 		if (ret) {
+			atomic_dec(ref);
+
 			LOG_ERR("Failed to send audio data on module %s TX message queue",
 				handle->name);
-
-			ret = k_sem_take(&handle->sem, K_NO_WAIT);
-			if (ret) {
-				LOG_ERR("Failed to take semaphore");
-			}
-
-			return ret;
+			err = ret;
+		} else {
+			LOG_DBG("Sent audio data to TX message queue for module %s", handle->name);
 		}
-
-		LOG_DBG("Sent audio data to TX message queue for module %s", handle->name);
 	}
 
-	return 0;
+	/* Release the sending module's reference. */
+	data_ref_release(handle, audio_data);
+
+	return err;
 }
 
 /**
@@ -695,7 +754,7 @@ int audio_module_close(struct audio_module_handle *handle)
 
 	/*
 	 * TODO: How to return all the data to the slab items?
-	 *       Test the semaphore and wait for it to be zero.
+	 *       Test the reference counts and wait for them to be zero.
 	 */
 
 	k_thread_abort(handle->thread_id);
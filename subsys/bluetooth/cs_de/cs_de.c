@@ -11,6 +11,7 @@
 
 #include <zephyr/bluetooth/hci_types.h>
 #include <zephyr/logging/log.h>
+#include <dsp/complex_math_functions.h>
 #include <dsp/transform_functions.h>
 #include <dsp/fast_math_functions.h>
 #include <dsp/statistics_functions.h>
@@ -34,10 +35,23 @@ LOG_MODULE_REGISTER(cs_de, CONFIG_BT_CS_DE_LOG_LEVEL);
 #define DMEYR		    (1)
 #define NORMAL_PEAK_TO_NULL ((CONFIG_BT_CS_DE_NFFT_SIZE + NUM_CHANNELS - 1) / (NUM_CHANNELS))
 
-static float m_iq_scratch_mem[2 * CONFIG_BT_CS_DE_NFFT_SIZE];
-static uint16_t m_n_iqs[CONFIG_BT_RAS_MAX_ANTENNA_PATHS][NUM_CHANNELS];
-static cs_de_tone_quality_t m_tone_quality_indicators[CONFIG_BT_RAS_MAX_ANTENNA_PATHS]
-						     [NUM_CHANNELS];
+#if defined(CONFIG_BT_CS_DE_IFFT_Q31)
+typedef q31_t ifft_mag_t;
+#else
+typedef float ifft_mag_t;
+#endif
+
+/* Destination of the step data. */
+struct accumulator {
+	cs_de_report_t *report;
+	cs_de_iq_sums_t *iq_sums;
+};
+
+BUILD_ASSERT(sizeof(float) == sizeof(q31_t));
+
+/* Memory of cs_de_populate_report() and cs_de_calc(), which do not take a context. */
+static cs_de_ifft_scratch_t m_iq_scratch_mem;
+static cs_de_iq_sums_t m_iq_sums[CONFIG_BT_RAS_MAX_ANTENNA_PATHS];
 
 static void calculate_vec_cmac_f(float *iq_result, const float *i_1, const float *q_1,
 				 const float *i_2, const float *q_2)
@@ -83,8 +97,19 @@ static void calculate_dist_d_spaced_kay_f(float *dist, float *iq, uint32_t D)
 	}
 }
 
-static float calculate_ifft_peak_index_to_distance(int32_t peak_index,
-						   const float ifft_mag[CONFIG_BT_CS_DE_NFFT_SIZE])
+/* Returns true if a * a_mul > b * b_mul, for magnitudes of either arithmetic. */
+static inline bool ifft_mag_scaled_gt(ifft_mag_t a, uint32_t a_mul, ifft_mag_t b, uint32_t b_mul)
+{
+#if defined(CONFIG_BT_CS_DE_IFFT_Q31)
+	return (int64_t)a * a_mul > (int64_t)b * b_mul;
+#else
+	return a * a_mul > b * b_mul;
+#endif
+}
+
+static float
+calculate_ifft_peak_index_to_distance(int32_t peak_index,
+				      const ifft_mag_t ifft_mag[CONFIG_BT_CS_DE_NFFT_SIZE])
 {
 	/* Peak interpolation */
 	float prompt = ifft_mag[peak_index];
@@ -112,7 +137,7 @@ static float calculate_ifft_peak_index_to_distance(int32_t peak_index,
 }
 
 static int32_t calculate_ifft_find_left_null(int32_t peak_index,
-					     float ifft_mag[CONFIG_BT_CS_DE_NFFT_SIZE])
+					     const ifft_mag_t ifft_mag[CONFIG_BT_CS_DE_NFFT_SIZE])
 {
 	int32_t left_null_index = peak_index;
 	bool found_left_null = false;
@@ -121,9 +146,10 @@ static int32_t calculate_ifft_find_left_null(int32_t peak_index,
 		int32_t next_left_null_index =
 			left_null_index == 0 ? CONFIG_BT_CS_DE_NFFT_SIZE - 1 : left_null_index - 1;
 		/* This is a heuristic, probably non-optimal definition of a null. */
-		if ((ifft_mag[left_null_index] * 2 > ifft_mag[peak_index] ||
-		     ifft_mag[left_null_index] > 1.10f * ifft_mag[next_left_null_index]) &&
-		    ifft_mag[left_null_index] * 10 > ifft_mag[peak_index] &&
+		if ((ifft_mag_scaled_gt(ifft_mag[left_null_index], 2, ifft_mag[peak_index], 1) ||
+		     ifft_mag_scaled_gt(ifft_mag[left_null_index], 10,
+					ifft_mag[next_left_null_index], 11)) &&
+		    ifft_mag_scaled_gt(ifft_mag[left_null_index], 10, ifft_mag[peak_index], 1) &&
 		    next_left_null_index != peak_index) {
 			left_null_index = next_left_null_index--;
 		} else {
@@ -140,8 +166,9 @@ static uint32_t calculate_distance_to_left_null(uint32_t peak_index, uint32_t le
 		       : (peak_index - left_null_index);
 }
 
-static int32_t calculate_left_null_compensation_of_peak(int32_t peak_index,
-							float ifft_mag[CONFIG_BT_CS_DE_NFFT_SIZE])
+static int32_t
+calculate_left_null_compensation_of_peak(int32_t peak_index,
+					 const ifft_mag_t ifft_mag[CONFIG_BT_CS_DE_NFFT_SIZE])
 {
 	int32_t compensated_peak_index = peak_index;
 	int32_t left_null_index = calculate_ifft_find_left_null(peak_index, ifft_mag);
@@ -161,7 +188,62 @@ static int32_t calculate_left_null_compensation_of_peak(int32_t peak_index,
 	return compensated_peak_index;
 }
 
-static void calculate_ifft_mag(float iq_tones_comb[2 * CONFIG_BT_CS_DE_NFFT_SIZE])
+#if defined(CONFIG_BT_CS_DE_IFFT_Q31)
+static const ifft_mag_t *calculate_ifft_mag(cs_de_ifft_scratch_t *scratch)
+{
+	/* This function calculates the magnitude of the IFFT of the input IQ values
+	 * in q31 fixed-point arithmetic. See the floating-point variant below for the steps.
+	 * The input is the floating-point view of the scratch memory, and the magnitude
+	 * is returned in its first CONFIG_BT_CS_DE_NFFT_SIZE fixed-point values.
+	 *
+	 * The input is scaled to half of the full range when converted. The FFT scales its
+	 * output down by CONFIG_BT_CS_DE_NFFT_SIZE, which is the scaling of the IFFT, so it does
+	 * not saturate. The magnitude is scaled down by further 2, which does not affect the
+	 * peak search and the interpolation.
+	 */
+	const float *iq_tones_comb = scratch->f32;
+	q31_t *iq_tones_comb_q31 = scratch->q31;
+	float abs_max = 0.0f;
+	float scale;
+
+	for (uint32_t i = 0; i < 2 * NUM_CHANNELS; i++) {
+		abs_max = fmaxf(abs_max, fabsf(iq_tones_comb[i]));
+	}
+
+	scale = (abs_max > 0.0f) ? (0.5f * 2147483648.0f) / abs_max : 0.0f;
+
+	/* Convert and complex conjugate the input in place. */
+	for (uint32_t i = 0; i < NUM_CHANNELS; i++) {
+		iq_tones_comb_q31[i * 2] = (q31_t)(iq_tones_comb[i * 2] * scale);
+		iq_tones_comb_q31[i * 2 + 1] = -(q31_t)(iq_tones_comb[i * 2 + 1] * scale);
+	}
+
+	/* Perform the FFT. */
+	#if CONFIG_BT_CS_DE_NFFT_SIZE == 512
+		arm_cfft_q31(&arm_cfft_sR_q31_len512, iq_tones_comb_q31, 0, 1);
+	#elif CONFIG_BT_CS_DE_NFFT_SIZE == 1024
+		arm_cfft_q31(&arm_cfft_sR_q31_len1024, iq_tones_comb_q31, 0, 1);
+	#elif CONFIG_BT_CS_DE_NFFT_SIZE == 2048
+		arm_cfft_q31(&arm_cfft_sR_q31_len2048, iq_tones_comb_q31, 0, 1);
+	#else
+	#error
+	#endif
+
+	/* The magnitude of each value is stored before the next value is read,
+	 * so it can be computed in place.
+	 */
+	arm_cmplx_mag_q31(iq_tones_comb_q31, iq_tones_comb_q31, CONFIG_BT_CS_DE_NFFT_SIZE);
+
+	return iq_tones_comb_q31;
+}
+
+static void ifft_mag_find_max(const ifft_mag_t ifft_mag[CONFIG_BT_CS_DE_NFFT_SIZE],
+			      ifft_mag_t *max, uint32_t *max_index)
+{
+	arm_max_q31(ifft_mag, CONFIG_BT_CS_DE_NFFT_SIZE, max, max_index);
+}
+#else
+static const ifft_mag_t *calculate_ifft_mag(cs_de_ifft_scratch_t *scratch)
 {
 	/* This function calculates the magnitude of the IFFT of the input IQ values.
 	 * Note that the result is written back to the input array.
@@ -176,6 +258,7 @@ static void calculate_ifft_mag(float iq_tones_comb[2 * CONFIG_BT_CS_DE_NFFT_SIZE
 	 * Since we are interested in the magnitude of the IFFT, we can skip step 3.
 	 * and directly calculate the magnitude of the output of step 2.
 	 */
+	float *iq_tones_comb = scratch->f32;
 
 	/* Complex conjugate the input. */
 	for (uint32_t i = 0; i < NUM_CHANNELS; i++) {
@@ -204,9 +287,18 @@ static void calculate_ifft_mag(float iq_tones_comb[2 * CONFIG_BT_CS_DE_NFFT_SIZE
 
 		arm_sqrt_f32((realIn * realIn) + (imagIn * imagIn), &iq_tones_comb[n]);
 	}
+
+	return iq_tones_comb;
+}
+
+static void ifft_mag_find_max(const ifft_mag_t ifft_mag[CONFIG_BT_CS_DE_NFFT_SIZE],
+			      ifft_mag_t *max, uint32_t *max_index)
+{
+	arm_max_f32(ifft_mag, CONFIG_BT_CS_DE_NFFT_SIZE, max, max_index);
 }
+#endif /* defined(CONFIG_BT_CS_DE_IFFT_Q31) */
 
-static uint32_t find_ifft_peak_index(float ifft_mag[2 * CONFIG_BT_CS_DE_NFFT_SIZE])
+static uint32_t find_ifft_peak_index(const ifft_mag_t ifft_mag[CONFIG_BT_CS_DE_NFFT_SIZE])
 {
 	/* This function tries to find the peak index of the input IFFT magnitude.
 	 *
@@ -217,9 +309,9 @@ static uint32_t find_ifft_peak_index(float ifft_mag[2 * CONFIG_BT_CS_DE_NFFT_SIZ
 	 *  3. When applicable: Compensate peak based on left null location.
 	 */
 	uint32_t ifft_mag_max_index;
-	float ifft_mag_max;
+	ifft_mag_t ifft_mag_max;
 
-	arm_max_f32(ifft_mag, CONFIG_BT_CS_DE_NFFT_SIZE, &ifft_mag_max, &ifft_mag_max_index);
+	ifft_mag_find_max(ifft_mag, &ifft_mag_max, &ifft_mag_max_index);
 
 	/* Search for strong peaks closer than the max value. */
 	uint32_t nw = CONFIG_BT_CS_DE_NFFT_SIZE - 2;
@@ -232,7 +324,8 @@ static uint32_t find_ifft_peak_index(float ifft_mag[2 * CONFIG_BT_CS_DE_NFFT_SIZ
 	while (nw != max_search_index && !short_path_found) {
 		if (ifft_mag[nw_next] < ifft_mag[nw]) {
 			/* Peak found */
-			if (2.5f * ifft_mag[nw] > ifft_mag_max && first_rise_found) {
+			if (ifft_mag_scaled_gt(ifft_mag[nw], 5, ifft_mag_max, 2) &&
+			    first_rise_found) {
 				/* New peak found */
 				shortest_path_idx = nw;
 				short_path_found = true;
@@ -254,7 +347,7 @@ static uint32_t find_ifft_peak_index(float ifft_mag[2 * CONFIG_BT_CS_DE_NFFT_SIZ
 	return compensated_peak_index;
 }
 
-static void calculate_dist_ifft(float *dist, float iq_tones_comb[2 * CONFIG_BT_CS_DE_NFFT_SIZE])
+static void calculate_dist_ifft(float *dist, cs_de_ifft_scratch_t *scratch)
 {
 	/* This function calculates a distance estimate
 	 * based on the IFFT magnitude of the input IQ values.
@@ -265,10 +358,8 @@ static void calculate_dist_ifft(float *dist, float iq_tones_comb[2 * CONFIG_BT_C
 	 *     to correspond to the path with the shortest propagattion time.
 	 *  3. Convert the peak index to a distance estimate.
 	 */
-	calculate_ifft_mag(iq_tones_comb);
-
 	/* The input IQ values are overwritten with the IFFT magnitude. */
-	float *ifft_mag = iq_tones_comb;
+	const ifft_mag_t *ifft_mag = calculate_ifft_mag(scratch);
 
 	uint32_t ifft_peak_index = find_ifft_peak_index(ifft_mag);
 
@@ -291,33 +382,61 @@ static void calculate_dist_rtt(cs_de_report_t *p_report)
 	}
 }
 
-static bool m_is_tone_quality_ok(cs_de_tone_quality_t *p_tone_qi, uint8_t channel_map[10])
+static void finalize_iq_tones(cs_de_report_t *p_report, const cs_de_iq_sums_t *p_iq_sums,
+			      const uint8_t channel_map[10])
 {
-	uint8_t ok_tones_count = 0;
-	for (uint8_t i = 0; i < NUM_CHANNELS; ++i) {
-		if (BT_LE_CS_CHANNEL_BIT_GET(channel_map, i + CHANNEL_INDEX_OFFSET) &&
-		    p_tone_qi[i] == CS_DE_TONE_QUALITY_OK) {
-			ok_tones_count += 1;
+	/* This function stores the mean of the summed IQ values in the report
+	 * and sets the tone quality of each antenna path.
+	 */
+	for (uint8_t ap = 0; ap < p_report->n_ap; ap++) {
+		const cs_de_iq_sums_t *sums = &p_iq_sums[ap];
+		cs_de_iq_tones_t *iq_tones = &p_report->iq_tones[ap];
+		uint8_t ok_tones_count = 0;
+
+		for (uint8_t n = 0; n < NUM_CHANNELS; n++) {
+			if (sums->count[n] == 0) {
+				iq_tones->i_local[n] = 0.0f;
+				iq_tones->q_local[n] = 0.0f;
+				iq_tones->i_remote[n] = 0.0f;
+				iq_tones->q_remote[n] = 0.0f;
+				continue;
+			}
+
+			float scale = 1.0f / sums->count[n];
+
+			iq_tones->i_local[n] = sums->i_local[n] * scale;
+			iq_tones->q_local[n] = sums->q_local[n] * scale;
+			iq_tones->i_remote[n] = sums->i_remote[n] * scale;
+			iq_tones->q_remote[n] = sums->q_remote[n] * scale;
+
+			if (BT_LE_CS_CHANNEL_BIT_GET(channel_map, n + CHANNEL_INDEX_OFFSET)) {
+				ok_tones_count += 1;
+			}
 		}
-	}
-	return (ok_tones_count >= TONE_QI_OK_TONE_COUNT_THRESHOLD);
-}
 
-static void cumulate_mean(float *avg, float new_value, uint16_t *N)
-{
-	float a = 1.0f / (*N);
-	float b = 1.0f - a;
-	*avg = a * new_value + b * (*avg);
+		p_report->tone_quality[ap] = (ok_tones_count >= TONE_QI_OK_TONE_COUNT_THRESHOLD)
+						     ? CS_DE_TONE_QUALITY_OK
+						     : CS_DE_TONE_QUALITY_BAD;
+
+		p_report->distance_estimates[ap].ifft = NAN;
+		p_report->distance_estimates[ap].phase_slope = NAN;
+		p_report->distance_estimates[ap].rtt = NAN;
+		p_report->distance_estimates[ap].best = NAN;
+	}
 }
 
-static void extract_pcts(cs_de_report_t *p_report, uint8_t channel_index,
+static void extract_pcts(struct accumulator *acc, uint8_t channel_index,
 			 uint8_t antenna_permutation_index,
 			 struct bt_hci_le_cs_step_data_tone_info *local_tone_info,
 			 struct bt_hci_le_cs_step_data_tone_info *remote_tone_info)
 {
+	if (channel_index >= NUM_CHANNELS) {
+		LOG_WRN("Invalid channel.");
+		return;
+	}
 
-	for (uint8_t tone_index = 0; tone_index < p_report->n_ap; tone_index++) {
-		int antenna_path = bt_le_cs_get_antenna_path(p_report->n_ap,
+	for (uint8_t tone_index = 0; tone_index < acc->report->n_ap; tone_index++) {
+		int antenna_path = bt_le_cs_get_antenna_path(acc->report->n_ap,
 							     antenna_permutation_index, tone_index);
 		if (antenna_path < 0) {
 			LOG_WRN("Invalid antenna path.");
@@ -335,25 +454,14 @@ static void extract_pcts(cs_de_report_t *p_report, uint8_t channel_index,
 			bt_le_cs_parse_pct(local_tone_info[tone_index].phase_correction_term);
 		struct bt_le_cs_iq_sample remote_iq =
 			bt_le_cs_parse_pct(remote_tone_info[tone_index].phase_correction_term);
-
-		m_n_iqs[antenna_path][channel_index]++;
-		m_tone_quality_indicators[antenna_path][channel_index] = CS_DE_TONE_QUALITY_OK;
-
-		if (m_n_iqs[antenna_path][channel_index] == 1) {
-			p_report->iq_tones[antenna_path].i_local[channel_index] = local_iq.i;
-			p_report->iq_tones[antenna_path].q_local[channel_index] = local_iq.q;
-			p_report->iq_tones[antenna_path].i_remote[channel_index] = remote_iq.i;
-			p_report->iq_tones[antenna_path].q_remote[channel_index] = remote_iq.q;
-		} else {
-			cumulate_mean(&p_report->iq_tones[antenna_path].i_local[channel_index],
-				      local_iq.i, &m_n_iqs[antenna_path][channel_index]);
-			cumulate_mean(&p_report->iq_tones[antenna_path].q_local[channel_index],
-				      local_iq.q, &m_n_iqs[antenna_path][channel_index]);
-			cumulate_mean(&p_report->iq_tones[antenna_path].i_remote[channel_index],
-				      remote_iq.i, &m_n_iqs[antenna_path][channel_index]);
-			cumulate_mean(&p_report->iq_tones[antenna_path].q_remote[channel_index],
-				      remote_iq.q, &m_n_iqs[antenna_path][channel_index]);
-		}
+		cs_de_iq_sums_t *sums = &acc->iq_sums[antenna_path];
+
+		/* The mean is taken once the procedure is complete. */
+		sums->i_local[channel_index] += local_iq.i;
+		sums->q_local[channel_index] += local_iq.q;
+		sums->i_remote[channel_index] += remote_iq.i;
+		sums->q_remote[channel_index] += remote_iq.q;
+		sums->count[channel_index]++;
 	}
 }
 
@@ -385,19 +493,20 @@ static void extract_rtt_timings(cs_de_report_t *p_report,
 
 static bool process_ranging_header(struct ras_ranging_header *ranging_header, void *user_data)
 {
-	cs_de_report_t *p_report = (cs_de_report_t *)user_data;
+	struct accumulator *acc = (struct accumulator *)user_data;
+	uint8_t n_ap = ((ranging_header->antenna_paths_mask & BIT(0)) +
+			((ranging_header->antenna_paths_mask & BIT(1)) >> 1) +
+			((ranging_header->antenna_paths_mask & BIT(2)) >> 2) +
+			((ranging_header->antenna_paths_mask & BIT(3)) >> 3));
 
-	p_report->n_ap = ((ranging_header->antenna_paths_mask & BIT(0)) +
-			  ((ranging_header->antenna_paths_mask & BIT(1)) >> 1) +
-			  ((ranging_header->antenna_paths_mask & BIT(2)) >> 2) +
-			  ((ranging_header->antenna_paths_mask & BIT(3)) >> 3));
+	acc->report->n_ap = MIN(n_ap, CONFIG_BT_RAS_MAX_ANTENNA_PATHS);
 	return true;
 }
 
 static bool process_step_data(struct bt_le_cs_subevent_step *local_step,
 			      struct bt_le_cs_subevent_step *peer_step, void *user_data)
 {
-	cs_de_report_t *p_report = (cs_de_report_t *)user_data;
+	struct accumulator *acc = (struct accumulator *)user_data;
 
 	if (local_step->mode == BT_HCI_OP_LE_CS_MAIN_MODE_2) {
 		struct bt_hci_le_cs_step_data_mode_2 *local_step_data =
@@ -405,7 +514,7 @@ static bool process_step_data(struct bt_le_cs_subevent_step *local_step,
 		struct bt_hci_le_cs_step_data_mode_2 *peer_step_data =
 			(struct bt_hci_le_cs_step_data_mode_2 *)peer_step->data;
 
-		extract_pcts(p_report, local_step->channel - CHANNEL_INDEX_OFFSET,
+		extract_pcts(acc, local_step->channel - CHANNEL_INDEX_OFFSET,
 			     local_step_data->antenna_permutation_index, local_step_data->tone_info,
 			     peer_step_data->tone_info);
 	} else if (local_step->mode == BT_HCI_OP_LE_CS_MAIN_MODE_1) {
@@ -414,18 +523,18 @@ static bool process_step_data(struct bt_le_cs_subevent_step *local_step,
 		struct bt_hci_le_cs_step_data_mode_1 *peer_step_data =
 			(struct bt_hci_le_cs_step_data_mode_1 *)peer_step->data;
 
-		extract_rtt_timings(p_report, local_step_data, peer_step_data);
+		extract_rtt_timings(acc->report, local_step_data, peer_step_data);
 	} else if (local_step->mode == BT_HCI_OP_LE_CS_MAIN_MODE_3) {
 		struct bt_hci_le_cs_step_data_mode_3 *local_step_data =
 			(struct bt_hci_le_cs_step_data_mode_3 *)local_step->data;
 		struct bt_hci_le_cs_step_data_mode_3 *peer_step_data =
 			(struct bt_hci_le_cs_step_data_mode_3 *)peer_step->data;
 
-		extract_pcts(p_report, local_step->channel - CHANNEL_INDEX_OFFSET,
+		extract_pcts(acc, local_step->channel - CHANNEL_INDEX_OFFSET,
 			     local_step_data->antenna_permutation_index, local_step_data->tone_info,
 			     peer_step_data->tone_info);
 
-		extract_rtt_timings(p_report,
+		extract_rtt_timings(acc->report,
 				    (struct bt_hci_le_cs_step_data_mode_1 *)local_step_data,
 				    (struct bt_hci_le_cs_step_data_mode_1 *)peer_step_data);
 	}
@@ -433,35 +542,8 @@ static bool process_step_data(struct bt_le_cs_subevent_step *local_step,
 	return true;
 }
 
-void cs_de_populate_report(struct net_buf_simple *local_steps, struct net_buf_simple *peer_steps,
-			   struct bt_conn_le_cs_config *config, cs_de_report_t *p_report)
-{
-	memset(p_report, 0x0, sizeof(*p_report));
-	memset(m_n_iqs, 0, sizeof(m_n_iqs));
-	memset(m_tone_quality_indicators, CS_DE_TONE_QUALITY_BAD,
-	       sizeof(m_tone_quality_indicators));
-
-	p_report->role = config->role;
-
-	bt_ras_rreq_rd_subevent_data_parse(peer_steps, local_steps, config->role,
-					   process_ranging_header, NULL, process_step_data,
-					   p_report);
-
-	for (uint8_t ap = 0; ap < p_report->n_ap; ap++) {
-		p_report->distance_estimates[ap].ifft = NAN;
-		p_report->distance_estimates[ap].phase_slope = NAN;
-		p_report->distance_estimates[ap].rtt = NAN;
-		p_report->distance_estimates[ap].best = NAN;
-
-		if (m_is_tone_quality_ok(&m_tone_quality_indicators[ap][0], config->channel_map)) {
-			p_report->tone_quality[ap] = CS_DE_TONE_QUALITY_OK;
-		} else {
-			p_report->tone_quality[ap] = CS_DE_TONE_QUALITY_BAD;
-		}
-	}
-}
-
-cs_de_quality_t cs_de_calc(cs_de_report_t *p_report)
+static cs_de_quality_t estimate_distance(cs_de_report_t *p_report,
+					 cs_de_ifft_scratch_t *scratch)
 {
 	cs_de_quality_t estimation_quality[CONFIG_BT_RAS_MAX_ANTENNA_PATHS];
 
@@ -475,18 +557,18 @@ cs_de_quality_t cs_de_calc(cs_de_report_t *p_report)
 			continue;
 		}
 
-		memset(m_iq_scratch_mem, 0, sizeof(m_iq_scratch_mem));
+		memset(scratch, 0, sizeof(*scratch));
 
 		/* Combine init and refl IQ values and store in scratch mem. */
-		calculate_vec_cmac_f(m_iq_scratch_mem, p_report->iq_tones[ap].i_remote,
+		calculate_vec_cmac_f(scratch->f32, p_report->iq_tones[ap].i_remote,
 				     p_report->iq_tones[ap].q_remote,
 				     p_report->iq_tones[ap].i_local,
 				     p_report->iq_tones[ap].q_local);
 
 		calculate_dist_d_spaced_kay_f(&p_report->distance_estimates[ap].phase_slope,
-					      m_iq_scratch_mem, DMEYR);
+					      scratch->f32, DMEYR);
 
-		calculate_dist_ifft(&p_report->distance_estimates[ap].ifft, m_iq_scratch_mem);
+		calculate_dist_ifft(&p_report->distance_estimates[ap].ifft, scratch);
 
 		estimation_quality[ap] = set_best_estimate(&p_report->distance_estimates[ap]);
 	}
@@ -499,3 +581,84 @@ cs_de_quality_t cs_de_calc(cs_de_report_t *p_report)
 
 	return CS_DE_QUALITY_DO_NOT_USE;
 }
+
+void cs_de_populate_report(struct net_buf_simple *local_steps, struct net_buf_simple *peer_steps,
+			   struct bt_conn_le_cs_config *config, cs_de_report_t *p_report)
+{
+	struct accumulator acc = {
+		.report = p_report,
+		.iq_sums = m_iq_sums,
+	};
+
+	memset(p_report, 0x0, sizeof(*p_report));
+	memset(m_iq_sums, 0, sizeof(m_iq_sums));
+
+	p_report->role = config->role;
+
+	bt_ras_rreq_rd_subevent_data_parse(peer_steps, local_steps, config->role,
+					   process_ranging_header, NULL, process_step_data,
+					   &acc);
+
+	finalize_iq_tones(p_report, m_iq_sums, config->channel_map);
+}
+
+cs_de_quality_t cs_de_calc(cs_de_report_t *p_report)
+{
+	return estimate_distance(p_report, &m_iq_scratch_mem);
+}
+
+void cs_de_ctx_init(cs_de_ctx_t *ctx, const struct bt_conn_le_cs_config *config)
+{
+	ctx->report.role = config->role;
+	memcpy(ctx->channel_map, config->channel_map, sizeof(ctx->channel_map));
+
+	cs_de_ctx_reset(ctx);
+}
+
+void cs_de_ctx_reset(cs_de_ctx_t *ctx)
+{
+	enum bt_conn_le_cs_role role = ctx->report.role;
+
+	memset(&ctx->report, 0x0, sizeof(ctx->report));
+	memset(ctx->iq_sums, 0, sizeof(ctx->iq_sums));
+
+	ctx->report.role = role;
+}
+
+bool cs_de_ctx_ranging_header_cb(struct ras_ranging_header *ranging_header, void *ctx)
+{
+	cs_de_ctx_t *p_ctx = (cs_de_ctx_t *)ctx;
+	struct accumulator acc = {
+		.report = &p_ctx->report,
+		.iq_sums = p_ctx->iq_sums,
+	};
+
+	return process_ranging_header(ranging_header, &acc);
+}
+
+bool cs_de_ctx_step_data_cb(struct bt_le_cs_subevent_step *local_step,
+			    struct bt_le_cs_subevent_step *peer_step, void *ctx)
+{
+	cs_de_ctx_t *p_ctx = (cs_de_ctx_t *)ctx;
+	struct accumulator acc = {
+		.report = &p_ctx->report,
+		.iq_sums = p_ctx->iq_sums,
+	};
+
+	return process_step_data(local_step, peer_step, &acc);
+}
+
+void cs_de_ctx_steps_add(cs_de_ctx_t *ctx, struct net_buf_simple *local_steps,
+			 struct net_buf_simple *peer_steps)
+{
+	bt_ras_rreq_rd_subevent_data_parse(peer_steps, local_steps, ctx->report.role,
+					   cs_de_ctx_ranging_header_cb, NULL,
+					   cs_de_ctx_step_data_cb, ctx);
+}
+
+cs_de_quality_t cs_de_ctx_calc(cs_de_ctx_t *ctx)
+{
+	finalize_iq_tones(&ctx->report, ctx->iq_sums, ctx->channel_map);
+
+	return estimate_distance(&ctx->report, &ctx->scratch);
+}
@@ -5,19 +5,60 @@
  */
 
 #include <inttypes.h>
+#include <stdlib.h>
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/bluetooth/bluetooth.h>
+#include <zephyr/net_buf.h>
+#include <zephyr/settings/settings.h>
+#include <zephyr/sys/byteorder.h>
 
 #include <bluetooth/gatt_dm.h>
 
 LOG_MODULE_REGISTER(bt_gatt_dm, CONFIG_BT_GATT_DM_LOG_LEVEL);
 
-/* Available sizes: 128, 512, 2048... */
-#define CHUNK_DATA_SIZE (128 - sizeof(struct k_heap *) \
-		- sizeof(struct data_chunk_item *))
+/* Size of a memory chunk for the attribute data, including the list node. */
+#define CHUNK_SIZE 128
+#define CHUNK_DATA_SIZE (CHUNK_SIZE - sizeof(sys_snode_t))
 
 #define DATA_ALIGN 4U
 
+#if CONFIG_BT_GATT_DM_CACHE
+/* Version of the format of the stored discovery results */
+#define CACHE_VERSION 1
+
+#define CACHE_DB_HASH_SIZE 16
+
+/* Length and value of a UUID */
+#define CACHE_UUID_MAX_SIZE (1 + BT_UUID_SIZE_128)
+
+/* Identity, start handle and UUID of a discovery procedure */
+#define CACHE_REQ_MAX_SIZE (1 + 2 + CACHE_UUID_MAX_SIZE)
+
+/* Characteristic: handle, permissions, UUID, value handle, properties and
+ * characteristic UUID. No other attribute type takes more space.
+ */
+#define CACHE_ATTR_MAX_SIZE (2 + 1 + CACHE_UUID_MAX_SIZE + 2 + 1 + CACHE_UUID_MAX_SIZE)
+
+/* Version, Database Hash, discovery procedure, end handle, attribute count
+ * and attributes.
+ */
+#define CACHE_ENTRY_MAX_SIZE (1 + CACHE_DB_HASH_SIZE + CACHE_REQ_MAX_SIZE + 2 + 1 + \
+			      CONFIG_BT_GATT_DM_MAX_ATTRS * CACHE_ATTR_MAX_SIZE)
+
+/* "bt/dm/<id>/<address><type>/<discovery procedure hash>" */
+#define CACHE_KEY_SIZE sizeof("bt/dm/255/0123456789ab1/01234567")
+
+BUILD_ASSERT(CONFIG_BT_GATT_DM_MAX_ATTRS <= UINT8_MAX);
+
+union cache_uuid {
+	struct bt_uuid uuid;
+	struct bt_uuid_16 u16;
+	struct bt_uuid_32 u32;
+	struct bt_uuid_128 u128;
+};
+#endif /* CONFIG_BT_GATT_DM_CACHE */
+
 /* They are placed in data_chunk without padding, so they must be aligned */
 BUILD_ASSERT(sizeof(struct bt_gatt_service_val) % DATA_ALIGN == 0);
 BUILD_ASSERT(sizeof(struct bt_gatt_chrc) % DATA_ALIGN == 0);
@@ -44,6 +85,7 @@ SYS_INIT(gatt_dm_wq_init, POST_KERNEL, CONFIG_BT_GATT_DM_WORKQ_INIT_PRIO);
 enum {
 	STATE_ATTRS_LOCKED,
 	STATE_ATTRS_RELEASE_PENDING,
+	STATE_CACHE_STORE_PENDING,
 	STATE_NUM
 };
 
@@ -59,6 +101,8 @@ struct data_chunk_item {
 struct bt_gatt_dm {
 	/* Connection object */
 	struct bt_conn *conn;
+	/* Connection of the discovery results last passed to the application */
+	struct bt_conn *result_conn;
 	/* The user context */
 	void *context;
 
@@ -92,10 +136,45 @@ struct bt_gatt_dm {
 
 	/* Work item used for discovery callbacks. */
 	struct k_work discover_work;
+
+#if CONFIG_BT_GATT_DM_CACHE
+	struct {
+		/* Database Hash read parameters */
+		struct bt_gatt_read_params read_params;
+		/* Database Hash of the peer */
+		uint8_t db_hash[CACHE_DB_HASH_SIZE];
+		/* Indicates that the Database Hash was read from the bonded peer. */
+		bool db_hash_valid;
+		/* The first handle of the current service discovery */
+		uint16_t start_handle;
+	} cache;
+#endif /* CONFIG_BT_GATT_DM_CACHE */
 };
 
-/* Currently only one instance is supported */
-static struct bt_gatt_dm bt_gatt_dm_inst;
+BUILD_ASSERT(sizeof(struct data_chunk_item) == CHUNK_SIZE);
+
+/* Memory chunks shared by all the instances */
+K_MEM_SLAB_DEFINE_STATIC(chunk_slab, CHUNK_SIZE, CONFIG_BT_GATT_DM_CHUNK_CNT, DATA_ALIGN);
+
+static struct bt_gatt_dm bt_gatt_dm_inst[CONFIG_BT_GATT_DM_MAX_INSTANCES];
+
+/* Protects the assignment of the instances to the connections */
+static struct k_spinlock inst_lock;
+
+#if CONFIG_BT_GATT_DM_CACHE
+/* Protects the buffer for the stored discovery results */
+static K_MUTEX_DEFINE(cache_mutex);
+NET_BUF_SIMPLE_DEFINE_STATIC(cache_buf, CACHE_ENTRY_MAX_SIZE);
+#endif /* CONFIG_BT_GATT_DM_CACHE */
+
+static void discover_work_submit(struct bt_gatt_dm *dm)
+{
+#if defined(CONFIG_BT_GATT_DM_WORKQ_OWN)
+	k_work_submit_to_queue(&bt_gatt_dm_wq, &dm->discover_work);
+#else
+	k_work_submit(&dm->discover_work);
+#endif
+}
 
 /* Returns pointer to newly allocated space in a dm->data_chunk */
 static void *user_data_alloc(struct bt_gatt_dm *dm,
@@ -114,12 +193,12 @@ static void *user_data_alloc(struct bt_gatt_dm *dm,
 	if (sys_slist_is_empty(&dm->chunk_list) ||
 	    dm->cur_chunk_len + len > CHUNK_DATA_SIZE) {
 
-		item = k_calloc(1, sizeof(struct data_chunk_item));
-
-		if (!item) {
+		if (k_mem_slab_alloc(&chunk_slab, (void **)&item, K_NO_WAIT)) {
 			return NULL;
 		}
 
+		memset(item, 0, sizeof(*item));
+
 		sys_slist_append(&dm->chunk_list, &item->node);
 		dm->cur_chunk_len = 0;
 
@@ -150,7 +229,7 @@ static void svc_attr_memory_release(struct bt_gatt_dm *dm)
 	while (!sys_slist_is_empty(&dm->chunk_list)) {
 		node = sys_slist_get_not_empty(&dm->chunk_list);
 		item = CONTAINER_OF(node, struct data_chunk_item, node);
-		k_free(item);
+		k_mem_slab_free(&chunk_slab, item);
 	}
 
 	dm->cur_chunk_len = 0;
@@ -268,36 +347,519 @@ static struct bt_gatt_dm_attr *attr_find_by_handle(
 	return NULL;
 }
 
-static void discovery_complete(struct bt_gatt_dm *dm)
+#if CONFIG_BT_GATT_DM_CACHE
+static size_t cache_peer_key(char key[CACHE_KEY_SIZE], uint8_t id,
+			     const bt_addr_le_t *addr)
 {
-	LOG_DBG("Discovery complete.");
+	return snprintk(key, CACHE_KEY_SIZE, "bt/dm/%u/%02x%02x%02x%02x%02x%02x%u",
+			id, addr->a.val[5], addr->a.val[4], addr->a.val[3],
+			addr->a.val[2], addr->a.val[1], addr->a.val[0], addr->type);
+}
+
+static void cache_uuid_encode(struct net_buf_simple *buf,
+			      const struct bt_uuid *uuid)
+{
+	if (!uuid) {
+		net_buf_simple_add_u8(buf, 0);
+		return;
+	}
+
+	switch (uuid->type) {
+	case BT_UUID_TYPE_16:
+		net_buf_simple_add_u8(buf, BT_UUID_SIZE_16);
+		net_buf_simple_add_le16(buf, BT_UUID_16(uuid)->val);
+		break;
+	case BT_UUID_TYPE_32:
+		net_buf_simple_add_u8(buf, BT_UUID_SIZE_32);
+		net_buf_simple_add_le32(buf, BT_UUID_32(uuid)->val);
+		break;
+	case BT_UUID_TYPE_128:
+		net_buf_simple_add_u8(buf, BT_UUID_SIZE_128);
+		net_buf_simple_add_mem(buf, BT_UUID_128(uuid)->val,
+				       BT_UUID_SIZE_128);
+		break;
+	default:
+		net_buf_simple_add_u8(buf, 0);
+		break;
+	}
+}
+
+/* Encodes the discovery procedure that is stored and creates
+ * the settings key of its results.
+ */
+static int cache_entry_key(struct bt_gatt_dm *dm, char key[CACHE_KEY_SIZE],
+			   struct net_buf_simple *req)
+{
+	struct bt_conn_info info;
+	uint32_t hash = 2166136261U;
+	size_t len;
+	int err;
+
+	err = bt_conn_get_info(dm->conn, &info);
+	if (err) {
+		return err;
+	}
+
+	net_buf_simple_add_u8(req, info.id);
+	net_buf_simple_add_le16(req, dm->cache.start_handle);
+	cache_uuid_encode(req, dm->search_svc_by_uuid ? &dm->svc_uuid.uuid : NULL);
+
+	/* FNV-1a hash of the discovery procedure. */
+	for (size_t i = 0; i < req->len; i++) {
+		hash = (hash ^ req->data[i]) * 16777619U;
+	}
+
+	len = cache_peer_key(key, info.id, info.le.dst);
+	snprintk(&key[len], CACHE_KEY_SIZE - len, "/%08x", hash);
+
+	return 0;
+}
+
+static void cache_attr_encode(struct net_buf_simple *buf,
+			      const struct bt_gatt_dm_attr *attr)
+{
+	const struct bt_gatt_service_val *service_val;
+	const struct bt_gatt_chrc *chrc;
+
+	net_buf_simple_add_le16(buf, attr->handle);
+	net_buf_simple_add_u8(buf, attr->perm);
+	cache_uuid_encode(buf, attr->uuid);
+
+	service_val = bt_gatt_dm_attr_service_val(attr);
+	if (service_val) {
+		net_buf_simple_add_le16(buf, service_val->end_handle);
+		cache_uuid_encode(buf, service_val->uuid);
+		return;
+	}
+
+	chrc = bt_gatt_dm_attr_chrc_val(attr);
+	if (chrc) {
+		net_buf_simple_add_le16(buf, chrc->value_handle);
+		net_buf_simple_add_u8(buf, chrc->properties);
+		cache_uuid_encode(buf, chrc->uuid);
+	}
+}
+
+/* Stores the result of the service discovery. No attributes are stored
+ * if the service was not found.
+ */
+static void cache_store(struct bt_gatt_dm *dm)
+{
+	char key[CACHE_KEY_SIZE];
+	int err;
+
+	NET_BUF_SIMPLE_DEFINE(req, CACHE_REQ_MAX_SIZE);
+
+	if (!dm->cache.db_hash_valid || cache_entry_key(dm, key, &req)) {
+		return;
+	}
+
+	k_mutex_lock(&cache_mutex, K_FOREVER);
+
+	net_buf_simple_reset(&cache_buf);
+	net_buf_simple_add_u8(&cache_buf, CACHE_VERSION);
+	net_buf_simple_add_mem(&cache_buf, dm->cache.db_hash,
+			       sizeof(dm->cache.db_hash));
+	net_buf_simple_add_mem(&cache_buf, req.data, req.len);
+	net_buf_simple_add_le16(&cache_buf, dm->cur_attr_id ?
+				dm->discover_params.end_handle : 0xffff);
+	net_buf_simple_add_u8(&cache_buf, dm->cur_attr_id);
+
+	for (size_t i = 0; i < dm->cur_attr_id; i++) {
+		cache_attr_encode(&cache_buf, &dm->attrs[i]);
+	}
+
+	err = settings_save_one(key, cache_buf.data, cache_buf.len);
+
+	k_mutex_unlock(&cache_mutex);
+
+	if (err) {
+		LOG_WRN("Failed to store discovery results, error: %d.", err);
+	} else {
+		LOG_DBG("Stored discovery results: %s", key);
+	}
+}
+#endif /* CONFIG_BT_GATT_DM_CACHE */
+
+static void discovery_result_ready(struct bt_gatt_dm *dm)
+{
+	dm->result_conn = dm->conn;
 	atomic_set_bit(dm->state_flags, STATE_ATTRS_RELEASE_PENDING);
 	if (dm->callback->completed) {
 		dm->callback->completed(dm, dm->context);
 	}
 }
 
-static void discovery_complete_not_found(struct bt_gatt_dm *dm)
+#if CONFIG_BT_GATT_DM_CACHE
+/* Defers the completion of the discovery to the discovery work, which
+ * stores the results first. Saving the settings may block, so it must not
+ * be done in the discovery callback.
+ * Returns false if there is nothing to store.
+ */
+static bool cache_store_submit(struct bt_gatt_dm *dm)
 {
-	LOG_DBG("Discover complete. No service found.");
+	if (!dm->cache.db_hash_valid) {
+		return false;
+	}
+
+	atomic_set_bit(dm->state_flags, STATE_CACHE_STORE_PENDING);
+	discover_work_submit(dm);
+
+	return true;
+}
+#endif /* CONFIG_BT_GATT_DM_CACHE */
+
+static void discovery_complete(struct bt_gatt_dm *dm)
+{
+	LOG_DBG("Discovery complete.");
+
+#if CONFIG_BT_GATT_DM_CACHE
+	if (cache_store_submit(dm)) {
+		return;
+	}
+#endif /* CONFIG_BT_GATT_DM_CACHE */
+
+	discovery_result_ready(dm);
+}
+
+/* Releases the instance, so that it can be used for any connection. */
+static struct bt_conn *discovery_end(struct bt_gatt_dm *dm)
+{
+	struct bt_conn *conn = dm->conn;
 
 	svc_attr_memory_release(dm);
+	dm->conn = NULL;
 	atomic_clear_bit(dm->state_flags, STATE_ATTRS_LOCKED);
 
+	return conn;
+}
+
+static void discovery_complete_not_found(struct bt_gatt_dm *dm)
+{
+	LOG_DBG("Discover complete. No service found.");
+
+	struct bt_conn *conn = discovery_end(dm);
+
 	if (dm->callback->service_not_found) {
-		dm->callback->service_not_found(dm->conn, dm->context);
+		dm->callback->service_not_found(conn, dm->context);
 	}
 }
 
 static void discovery_complete_error(struct bt_gatt_dm *dm, int err)
 {
-	svc_attr_memory_release(dm);
-	atomic_clear_bit(dm->state_flags, STATE_ATTRS_LOCKED);
+	struct bt_conn *conn = discovery_end(dm);
+
 	if (dm->callback->error_found) {
-		dm->callback->error_found(dm->conn, err, dm->context);
+		dm->callback->error_found(conn, err, dm->context);
 	}
 }
 
+#if CONFIG_BT_GATT_DM_CACHE
+static int cache_uuid_decode(struct net_buf_simple *buf,
+			     union cache_uuid *uuid)
+{
+	uint8_t len;
+
+	if (buf->len < 1) {
+		return -EINVAL;
+	}
+
+	len = net_buf_simple_pull_u8(buf);
+	if ((buf->len < len) ||
+	    !bt_uuid_create(&uuid->uuid, net_buf_simple_pull_mem(buf, len), len)) {
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+static int cache_attr_decode(struct bt_gatt_dm *dm, struct net_buf_simple *buf)
+{
+	union cache_uuid uuid;
+	union cache_uuid val_uuid;
+	struct bt_gatt_attr attr = {.uuid = &uuid.uuid};
+	struct bt_gatt_dm_attr *cur_attr;
+	struct bt_gatt_service_val *service_val;
+	struct bt_gatt_chrc *chrc;
+	int err;
+
+	if (buf->len < 3) {
+		return -EINVAL;
+	}
+
+	attr.handle = net_buf_simple_pull_le16(buf);
+	attr.perm = net_buf_simple_pull_u8(buf);
+
+	err = cache_uuid_decode(buf, &uuid);
+	if (err) {
+		return err;
+	}
+
+	if (!bt_uuid_cmp(attr.uuid, BT_UUID_GATT_PRIMARY) ||
+	    !bt_uuid_cmp(attr.uuid, BT_UUID_GATT_SECONDARY)) {
+		if (buf->len < 2) {
+			return -EINVAL;
+		}
+
+		uint16_t end_handle = net_buf_simple_pull_le16(buf);
+
+		err = cache_uuid_decode(buf, &val_uuid);
+		if (err) {
+			return err;
+		}
+
+		cur_attr = attr_store(dm, &attr, sizeof(*service_val));
+		if (!cur_attr) {
+			return -ENOMEM;
+		}
+
+		service_val = bt_gatt_dm_attr_service_val(cur_attr);
+		service_val->end_handle = end_handle;
+		service_val->uuid = uuid_store(dm, &val_uuid.uuid);
+
+		return service_val->uuid ? 0 : -ENOMEM;
+	}
+
+	if (!bt_uuid_cmp(attr.uuid, BT_UUID_GATT_CHRC)) {
+		if (buf->len < 3) {
+			return -EINVAL;
+		}
+
+		uint16_t value_handle = net_buf_simple_pull_le16(buf);
+		uint8_t properties = net_buf_simple_pull_u8(buf);
+
+		err = cache_uuid_decode(buf, &val_uuid);
+		if (err) {
+			return err;
+		}
+
+		cur_attr = attr_store(dm, &attr, sizeof(*chrc));
+		if (!cur_attr) {
+			return -ENOMEM;
+		}
+
+		chrc = bt_gatt_dm_attr_chrc_val(cur_attr);
+		chrc->value_handle = value_handle;
+		chrc->properties = properties;
+		chrc->uuid = uuid_store(dm, &val_uuid.uuid);
+
+		return chrc->uuid ? 0 : -ENOMEM;
+	}
+
+	return attr_store(dm, &attr, 0) ? 0 : -ENOMEM;
+}
+
+/* Returns -ENOENT if the stored results are not valid for the discovery. */
+static int cache_entry_decode(struct bt_gatt_dm *dm, struct net_buf_simple *buf,
+			      const struct net_buf_simple *req)
+{
+	uint16_t end_handle;
+	uint8_t attr_cnt;
+	int err;
+
+	if ((buf->len < (1 + sizeof(dm->cache.db_hash) + req->len + 3)) ||
+	    (net_buf_simple_pull_u8(buf) != CACHE_VERSION) ||
+	    memcmp(net_buf_simple_pull_mem(buf, sizeof(dm->cache.db_hash)),
+		   dm->cache.db_hash, sizeof(dm->cache.db_hash)) ||
+	    memcmp(net_buf_simple_pull_mem(buf, req->len), req->data, req->len)) {
+		return -ENOENT;
+	}
+
+	end_handle = net_buf_simple_pull_le16(buf);
+	attr_cnt = net_buf_simple_pull_u8(buf);
+
+	for (size_t i = 0; i < attr_cnt; i++) {
+		err = cache_attr_decode(dm, buf);
+		if (err) {
+			return err;
+		}
+	}
+
+	/* As after the discovery of the service, see bt_gatt_dm_continue(). */
+	dm->discover_params.uuid = NULL;
+	dm->discover_params.end_handle = end_handle;
+
+	return 0;
+}
+
+static int cache_load_cb(const char *key, size_t len, settings_read_cb read_cb,
+			 void *cb_arg, void *param)
+{
+	struct net_buf_simple *buf = param;
+	ssize_t size;
+
+	/* Only the exact key is loaded. */
+	if (key || (len > buf->size)) {
+		return 0;
+	}
+
+	net_buf_simple_reset(buf);
+	size = read_cb(cb_arg, buf->data, len);
+	if (size == (ssize_t)len) {
+		buf->len = size;
+	}
+
+	return 0;
+}
+
+/* Passes the stored results of the discovery to the application.
+ * Returns false if there are no valid results for the discovery.
+ */
+static bool cache_restore(struct bt_gatt_dm *dm)
+{
+	char key[CACHE_KEY_SIZE];
+	int err;
+
+	NET_BUF_SIMPLE_DEFINE(req, CACHE_REQ_MAX_SIZE);
+
+	if (!dm->cache.db_hash_valid || cache_entry_key(dm, key, &req)) {
+		return false;
+	}
+
+	k_mutex_lock(&cache_mutex, K_FOREVER);
+
+	net_buf_simple_reset(&cache_buf);
+	(void)settings_load_subtree_direct(key, cache_load_cb, &cache_buf);
+	err = cache_entry_decode(dm, &cache_buf, &req);
+
+	k_mutex_unlock(&cache_mutex);
+
+	if (err) {
+		if (err != -ENOENT) {
+			LOG_WRN("Stored discovery results not restored, error: %d.", err);
+		}
+
+		svc_attr_memory_release(dm);
+		return false;
+	}
+
+	LOG_DBG("Restored discovery results: %s", key);
+
+	if (!dm->cur_attr_id) {
+		discovery_complete_not_found(dm);
+	} else {
+		discovery_result_ready(dm);
+	}
+
+	return true;
+}
+
+static uint8_t cache_db_hash_read_cb(struct bt_conn *conn, uint8_t err,
+				     struct bt_gatt_read_params *params,
+				     const void *data, uint16_t length)
+{
+	struct bt_gatt_dm *dm = CONTAINER_OF(params, struct bt_gatt_dm,
+					     cache.read_params);
+
+	if (!err && data && (length == sizeof(dm->cache.db_hash))) {
+		memcpy(dm->cache.db_hash, data, sizeof(dm->cache.db_hash));
+		dm->cache.db_hash_valid = true;
+	} else {
+		LOG_DBG("Database Hash not read, error: %u.", err);
+	}
+
+	/* Restore the results or start the discovery from the workqueue. */
+	discover_work_submit(dm);
+
+	return BT_GATT_ITER_STOP;
+}
+
+/* Reads the Database Hash of a bonded peer before the discovery. */
+static int cache_db_hash_read(struct bt_gatt_dm *dm)
+{
+	struct bt_gatt_read_params *params = &dm->cache.read_params;
+	struct bt_conn_info info;
+	int err;
+
+	dm->cache.db_hash_valid = false;
+	dm->cache.start_handle = dm->discover_params.start_handle;
+
+	err = bt_conn_get_info(dm->conn, &info);
+	if (err) {
+		return err;
+	}
+
+	if (!bt_addr_le_is_bonded(info.id, info.le.dst)) {
+		return -ENOENT;
+	}
+
+	params->func = cache_db_hash_read_cb;
+	params->handle_count = 0;
+	params->by_uuid.start_handle = 0x0001;
+	params->by_uuid.end_handle = 0xffff;
+	params->by_uuid.uuid = BT_UUID_GATT_DB_HASH;
+
+	return bt_gatt_read(dm->conn, params);
+}
+
+struct cache_peer_entries {
+	uint32_t hash[8];
+	size_t cnt;
+};
+
+static int cache_peer_entries_cb(const char *key, size_t len,
+				 settings_read_cb read_cb, void *cb_arg,
+				 void *param)
+{
+	struct cache_peer_entries *entries = param;
+
+	if (key && (entries->cnt < ARRAY_SIZE(entries->hash))) {
+		entries->hash[entries->cnt++] = strtoul(key, NULL, 16);
+	}
+
+	return 0;
+}
+
+static void cache_bond_deleted(uint8_t id, const bt_addr_le_t *peer)
+{
+	struct cache_peer_entries entries;
+	char key[CACHE_KEY_SIZE];
+	size_t len = cache_peer_key(key, id, peer);
+	int err = 0;
+
+	do {
+		entries.cnt = 0;
+		key[len] = '\0';
+		(void)settings_load_subtree_direct(key, cache_peer_entries_cb, &entries);
+
+		for (size_t i = 0; (i < entries.cnt) && !err; i++) {
+			snprintk(&key[len], sizeof(key) - len, "/%08x", entries.hash[i]);
+			err = settings_delete(key);
+		}
+	} while (!err && (entries.cnt == ARRAY_SIZE(entries.hash)));
+
+	if (err) {
+		LOG_WRN("Failed to delete discovery results, error: %d.", err);
+	}
+}
+
+static struct bt_conn_auth_info_cb cache_auth_info_cb = {
+	.bond_deleted = cache_bond_deleted,
+};
+
+static int cache_settings_set(const char *key, size_t len,
+			      settings_read_cb read_cb, void *cb_arg)
+{
+	ARG_UNUSED(key);
+	ARG_UNUSED(len);
+	ARG_UNUSED(read_cb);
+	ARG_UNUSED(cb_arg);
+
+	/* The stored results are read when the discovery is started. */
+	return 0;
+}
+
+SETTINGS_STATIC_HANDLER_DEFINE(bt_gatt_dm, "bt/dm", NULL, cache_settings_set,
+			       NULL, NULL);
+
+static int gatt_dm_cache_init(void)
+{
+	return bt_conn_auth_info_cb_register(&cache_auth_info_cb);
+}
+
+SYS_INIT(gatt_dm_cache_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
+#endif /* CONFIG_BT_GATT_DM_CACHE */
+
 static void gatt_discover_work(struct k_work *work)
 {
 	struct bt_gatt_dm *dm = CONTAINER_OF(work, struct bt_gatt_dm, discover_work);
@@ -307,6 +869,27 @@ static void gatt_discover_work(struct k_work *work)
 		return;
 	}
 
+#if CONFIG_BT_GATT_DM_CACHE
+	if (atomic_test_and_clear_bit(dm->state_flags,
+				      STATE_CACHE_STORE_PENDING)) {
+		cache_store(dm);
+
+		/* No attributes are stored if the service was not found. */
+		if (dm->cur_attr_id) {
+			discovery_result_ready(dm);
+		} else {
+			discovery_complete_not_found(dm);
+		}
+
+		return;
+	}
+
+	if ((dm->discover_params.type == BT_GATT_DISCOVER_PRIMARY) &&
+	    cache_restore(dm)) {
+		return;
+	}
+#endif /* CONFIG_BT_GATT_DM_CACHE */
+
 	int err = bt_gatt_discover(dm->conn, &(dm->discover_params));
 
 	if (err) {
@@ -320,6 +903,11 @@ static uint8_t discovery_process_service(struct bt_gatt_dm *dm,
 				      struct bt_gatt_discover_params *params)
 {
 	if (!attr) {
+#if CONFIG_BT_GATT_DM_CACHE
+		if (cache_store_submit(dm)) {
+			return BT_GATT_ITER_STOP;
+		}
+#endif /* CONFIG_BT_GATT_DM_CACHE */
 		discovery_complete_not_found(dm);
 		return BT_GATT_ITER_STOP;
 	}
@@ -373,11 +961,7 @@ static uint8_t discovery_process_service(struct bt_gatt_dm *dm,
 	dm->discover_params.start_handle = cur_attr->handle + 1;
 	LOG_DBG("Starting descriptors discovery");
 
-#if defined(CONFIG_BT_GATT_DM_WORKQ_OWN)
-	k_work_submit_to_queue(&bt_gatt_dm_wq, &dm->discover_work);
-#else
-	k_work_submit(&dm->discover_work);
-#endif
+	discover_work_submit(dm);
 
 	return BT_GATT_ITER_STOP;
 }
@@ -396,11 +980,7 @@ static uint8_t discovery_process_attribute(struct bt_gatt_dm *dm,
 			dm->discover_params.type =
 				BT_GATT_DISCOVER_CHARACTERISTIC;
 
-#if defined(CONFIG_BT_GATT_DM_WORKQ_OWN)
-			k_work_submit_to_queue(&bt_gatt_dm_wq, &dm->discover_work);
-#else
-			k_work_submit(&dm->discover_work);
-#endif
+			discover_work_submit(dm);
 		} else {
 			discovery_complete(dm);
 		}
@@ -475,28 +1055,27 @@ static uint8_t discovery_callback(struct bt_conn *conn,
 		LOG_DBG("Attr: handle %u", attr->handle);
 	}
 
-	if (conn != bt_gatt_dm_inst.conn) {
+	struct bt_gatt_dm *dm = CONTAINER_OF(params, struct bt_gatt_dm,
+					     discover_params);
+
+	if (conn != dm->conn) {
 		LOG_ERR("Unexpected conn object. Aborting.");
-		discovery_complete_error(&bt_gatt_dm_inst, -EFAULT);
+		discovery_complete_error(dm, -EFAULT);
 		return BT_GATT_ITER_STOP;
 	}
 
 	switch (params->type) {
 	case BT_GATT_DISCOVER_PRIMARY:
 	case BT_GATT_DISCOVER_SECONDARY:
-		return discovery_process_service(&bt_gatt_dm_inst,
-						 attr, params);
+		return discovery_process_service(dm, attr, params);
 	case BT_GATT_DISCOVER_ATTRIBUTE:
-		return discovery_process_attribute(&bt_gatt_dm_inst,
-						   attr, params);
+		return discovery_process_attribute(dm, attr, params);
 	case BT_GATT_DISCOVER_CHARACTERISTIC:
-		return discovery_process_characteristic(&bt_gatt_dm_inst,
-							attr,
-							params);
+		return discovery_process_characteristic(dm, attr, params);
 	default:
 		/* This should not be possible */
 		__ASSERT(false, "Unknown param type.");
-		discovery_complete_error(&bt_gatt_dm_inst, -EINVAL);
+		discovery_complete_error(dm, -EINVAL);
 
 		break;
 	}
@@ -633,6 +1212,55 @@ const struct bt_gatt_dm_attr *bt_gatt_dm_desc_next(
 	return curr;
 }
 
+/* Selects and locks an instance for the discovery on the given connection.
+ * An instance that has released its data keeps its connection, so that
+ * the discovery can be continued. It is only reused for another connection
+ * if there are no instances that were never used or have finished.
+ */
+static struct bt_gatt_dm *inst_lock_for_conn(struct bt_conn *conn)
+{
+	struct bt_gatt_dm *found = NULL;
+	struct bt_gatt_dm *fallback = NULL;
+	k_spinlock_key_t key = k_spin_lock(&inst_lock);
+
+	for (size_t i = 0; i < ARRAY_SIZE(bt_gatt_dm_inst); i++) {
+		struct bt_gatt_dm *dm = &bt_gatt_dm_inst[i];
+		bool locked = atomic_test_bit(dm->state_flags,
+					      STATE_ATTRS_LOCKED);
+
+		if (dm->conn == conn) {
+			found = locked ? NULL : dm;
+			fallback = NULL;
+			break;
+		}
+
+		if (locked) {
+			continue;
+		}
+
+		if (!dm->conn) {
+			if (!found) {
+				found = dm;
+			}
+		} else if (!fallback) {
+			fallback = dm;
+		}
+	}
+
+	if (!found) {
+		found = fallback;
+	}
+
+	if (found) {
+		atomic_set_bit(found->state_flags, STATE_ATTRS_LOCKED);
+		found->conn = conn;
+	}
+
+	k_spin_unlock(&inst_lock, key);
+
+	return found;
+}
+
 int bt_gatt_dm_start(struct bt_conn *conn,
 		     const struct bt_uuid *svc_uuid,
 		     const struct bt_gatt_dm_cb *cb,
@@ -651,13 +1279,11 @@ int bt_gatt_dm_start(struct bt_conn *conn,
 		return -EINVAL;
 	}
 
-	dm = &bt_gatt_dm_inst;
-
-	if (atomic_test_and_set_bit(dm->state_flags, STATE_ATTRS_LOCKED)) {
+	dm = inst_lock_for_conn(conn);
+	if (!dm) {
 		return -EALREADY;
 	}
 
-	dm->conn = conn;
 	dm->context = context;
 	dm->callback = cb;
 	dm->cur_attr_id = 0;
@@ -679,9 +1305,16 @@ int bt_gatt_dm_start(struct bt_conn *conn,
 	dm->discover_params.type = BT_GATT_DISCOVER_PRIMARY;
 	k_work_init(&dm->discover_work, gatt_discover_work);
 
+#if CONFIG_BT_GATT_DM_CACHE
+	if (!cache_db_hash_read(dm)) {
+		return 0;
+	}
+#endif /* CONFIG_BT_GATT_DM_CACHE */
+
 	err = bt_gatt_discover(conn, &dm->discover_params);
 	if (err) {
 		LOG_ERR("Discover failed, error: %d.", err);
+		dm->conn = NULL;
 		atomic_clear_bit(dm->state_flags, STATE_ATTRS_LOCKED);
 	}
 
@@ -698,6 +1331,13 @@ int bt_gatt_dm_continue(struct bt_gatt_dm *dm, void *context)
 		return -EINVAL;
 	}
 
+	/* The discovery has ended, or the instance was taken by another
+	 * connection after the data was released.
+	 */
+	if (!dm->conn || (dm->conn != dm->result_conn)) {
+		return -EINVAL;
+	}
+
 	/* If UUID is set, it does not make sense to call this function.
 	 * The stored UUID would be broken anyway in bt_gatt_dm_data_release.
 	 */
@@ -722,6 +1362,18 @@ int bt_gatt_dm_continue(struct bt_gatt_dm *dm, void *context)
 	dm->discover_params.type = BT_GATT_DISCOVER_PRIMARY;
 	dm->discover_params.uuid = dm->search_svc_by_uuid ? &dm->svc_uuid.uuid : NULL;
 
+#if CONFIG_BT_GATT_DM_CACHE
+	dm->cache.start_handle = dm->discover_params.start_handle;
+
+	if (dm->cache.db_hash_valid) {
+		/* The results might be restored, which must not happen
+		 * in the caller context.
+		 */
+		discover_work_submit(dm);
+		return 0;
+	}
+#endif /* CONFIG_BT_GATT_DM_CACHE */
+
 	err = bt_gatt_discover(dm->conn, &dm->discover_params);
 	if (err) {
 		LOG_ERR("Discover failed, error: %d.", err);
@@ -12,6 +12,7 @@
 #include <zephyr/bluetooth/bluetooth.h>
 #include <zephyr/bluetooth/att.h>
 #include <zephyr/bluetooth/gatt.h>
+#include <bluetooth/bt_rpc.h>
 
 #include "bt_rpc_common.h"
 #include "bt_rpc_gatt_common.h"
@@ -737,42 +738,138 @@ int bt_gatt_service_unregister(struct bt_gatt_service *svc)
 }
 #endif /* defined(CONFIG_BT_GATT_DYNAMIC_DB) */
 
-static size_t bt_gatt_notify_params_buf_size(const struct bt_gatt_notify_params *data)
+#if defined(CONFIG_BT_RPC_GATT_ATTR_CACHE)
+int bt_rpc_gatt_attr_cache_set(const struct bt_gatt_attr *attr, const void *value, uint16_t len)
 {
-	size_t buffer_size_max = 23;
+	struct nrf_rpc_cbor_ctx ctx;
+	uint32_t attr_index;
+	int result;
+	size_t buffer_size_max;
 
-	buffer_size_max += sizeof(uint8_t) * data->len;
+	if (bt_rpc_gatt_attr_to_index(attr, &attr_index)) {
+		return -EINVAL;
+	}
 
-	buffer_size_max += data->len;
+	/* The host copies the value into the cache directly from the packet. */
+	buffer_size_max = NRF_RPC_CBOR_UINT_SIZE(attr_index) + nrf_rpc_encode_buffer_size(value, len);
 
-	return buffer_size_max;
+	NRF_RPC_CBOR_ALLOC(&bt_rpc_grp, ctx, buffer_size_max);
+
+	nrf_rpc_encode_uint(&ctx, attr_index);
+	nrf_rpc_encode_buffer(&ctx, value, len);
+
+	nrf_rpc_cbor_cmd_no_err(&bt_rpc_grp, BT_RPC_GATT_ATTR_CACHE_SET_RPC_CMD,
+		&ctx, nrf_rpc_rsp_decode_i32, &result);
+
+	return result;
 }
 
-static size_t bt_gatt_notify_params_sp_size(const struct bt_gatt_notify_params *data)
+int bt_rpc_gatt_attr_cache_invalidate(const struct bt_gatt_attr *attr)
 {
-	size_t scratchpad_size = 0;
+	struct nrf_rpc_cbor_ctx ctx;
+	uint32_t attr_index;
+	int result;
+	size_t buffer_size_max = 5;
 
-	scratchpad_size += NRF_RPC_SCRATCHPAD_ALIGN(sizeof(uint8_t) * data->len);
+	if (bt_rpc_gatt_attr_to_index(attr, &attr_index)) {
+		return -EINVAL;
+	}
 
-	scratchpad_size += data->len;
+	NRF_RPC_CBOR_ALLOC(&bt_rpc_grp, ctx, buffer_size_max);
 
-	return scratchpad_size;
+	nrf_rpc_encode_uint(&ctx, attr_index);
+
+	nrf_rpc_cbor_cmd_no_err(&bt_rpc_grp, BT_RPC_GATT_ATTR_CACHE_INVALIDATE_RPC_CMD,
+		&ctx, nrf_rpc_rsp_decode_i32, &result);
+
+	return result;
 }
+#endif /* defined(CONFIG_BT_RPC_GATT_ATTR_CACHE) */
+
+#if defined(CONFIG_BT_RPC_GATT_NOTIFY_ASYNC)
+static bt_rpc_gatt_notify_error_cb_t notify_error_cb;
+static atomic_t notify_sent;
+static atomic_t notify_failed;
+static atomic_t notify_last_err;
 
-static void bt_gatt_notify_params_enc(struct nrf_rpc_cbor_ctx *encoder,
-				      const struct bt_gatt_notify_params *data)
+void bt_rpc_gatt_notify_error_cb_register(bt_rpc_gatt_notify_error_cb_t cb)
 {
-	bt_rpc_encode_gatt_attr(encoder, data->attr);
-	nrf_rpc_encode_uint(encoder, data->len);
-	nrf_rpc_encode_buffer(encoder, data->data, sizeof(uint8_t) * data->len);
-	nrf_rpc_encode_callback(encoder, data->func);
-	nrf_rpc_encode_uint(encoder, (uintptr_t)data->user_data);
+	notify_error_cb = cb;
+}
 
-	if (data->uuid) {
-		bt_uuid_enc(encoder, data->uuid);
-	} else {
-		nrf_rpc_encode_null(encoder);
+void bt_rpc_gatt_notify_stats_get(struct bt_rpc_gatt_notify_stats *stats)
+{
+	stats->sent = atomic_get(&notify_sent);
+	stats->failed = atomic_get(&notify_failed);
+	stats->last_err = atomic_get(&notify_last_err);
+}
+
+static void bt_gatt_notify_error_rpc_handler(const struct nrf_rpc_group *group,
+					     struct nrf_rpc_cbor_ctx *ctx, void *handler_data)
+{
+	struct bt_conn *conn;
+	int err;
+	uint16_t failed;
+	bt_rpc_gatt_notify_error_cb_t cb = notify_error_cb;
+
+	conn = bt_rpc_decode_bt_conn(ctx);
+	err = nrf_rpc_decode_int(ctx);
+	failed = nrf_rpc_decode_uint(ctx);
+
+	if (!nrf_rpc_decoding_done_and_check(group, ctx)) {
+		goto decoding_error;
 	}
+
+	atomic_add(&notify_failed, failed);
+	atomic_set(&notify_last_err, err);
+
+	LOG_WRN("Host failed to send %u notifications: %d", failed, err);
+
+	if (cb) {
+		cb(conn, err, failed);
+	}
+
+	return;
+decoding_error:
+	report_decoding_error(BT_GATT_NOTIFY_ERROR_RPC_EVT, handler_data);
+}
+
+NRF_RPC_CBOR_EVT_DECODER(bt_rpc_grp, bt_gatt_notify_error, BT_GATT_NOTIFY_ERROR_RPC_EVT,
+			 bt_gatt_notify_error_rpc_handler, NULL);
+#endif /* defined(CONFIG_BT_RPC_GATT_NOTIFY_ASYNC) */
+
+/* Send up to CONFIG_BT_RPC_GATT_NOTIFY_BATCH_MAX notifications in a single RPC packet. */
+static int bt_gatt_notify_batch(struct bt_conn *conn, uint16_t num_params,
+				const struct bt_gatt_notify_params *params)
+{
+	struct nrf_rpc_cbor_ctx ctx;
+	int result = 0;
+	size_t scratchpad_size = 0;
+	size_t buffer_size_max = NRF_RPC_CBOR_INT_MAX_SIZE(uint8_t) +
+				 NRF_RPC_CBOR_UINT_SIZE(num_params);
+
+	for (uint16_t i = 0; i < num_params; i++) {
+		buffer_size_max += bt_rpc_gatt_notify_params_buf_size(&params[i]);
+		scratchpad_size += bt_rpc_gatt_notify_params_sp_size(&params[i]);
+	}
+
+	buffer_size_max += NRF_RPC_CBOR_UINT_SIZE(scratchpad_size);
+
+	NRF_RPC_CBOR_ALLOC(&bt_rpc_grp, ctx, buffer_size_max);
+	nrf_rpc_encode_uint(&ctx, scratchpad_size);
+
+	bt_rpc_encode_bt_conn(&ctx, conn);
+	bt_rpc_gatt_notify_batch_enc(&ctx, num_params, params);
+
+#if defined(CONFIG_BT_RPC_GATT_NOTIFY_ASYNC)
+	nrf_rpc_cbor_evt_no_err(&bt_rpc_grp, BT_GATT_NOTIFY_MULTIPLE_RPC_EVT, &ctx);
+	atomic_add(&notify_sent, num_params);
+#else
+	nrf_rpc_cbor_cmd_no_err(&bt_rpc_grp, BT_GATT_NOTIFY_MULTIPLE_RPC_CMD,
+		&ctx, nrf_rpc_rsp_decode_i32, &result);
+#endif
+
+	return result;
 }
 
 int bt_gatt_notify_cb(struct bt_conn *conn,
@@ -781,17 +878,22 @@ int bt_gatt_notify_cb(struct bt_conn *conn,
 	struct nrf_rpc_cbor_ctx ctx;
 	int result;
 	size_t scratchpad_size = 0;
-	size_t buffer_size_max = 8;
+	size_t buffer_size_max = NRF_RPC_CBOR_INT_MAX_SIZE(uint8_t);
+
+	if (IS_ENABLED(CONFIG_BT_RPC_GATT_NOTIFY_ASYNC)) {
+		return bt_gatt_notify_batch(conn, 1, params);
+	}
 
-	buffer_size_max += bt_gatt_notify_params_buf_size(params);
+	buffer_size_max += bt_rpc_gatt_notify_params_buf_size(params);
 
-	scratchpad_size += bt_gatt_notify_params_sp_size(params);
+	scratchpad_size += bt_rpc_gatt_notify_params_sp_size(params);
+	buffer_size_max += NRF_RPC_CBOR_UINT_SIZE(scratchpad_size);
 
 	NRF_RPC_CBOR_ALLOC(&bt_rpc_grp, ctx, buffer_size_max);
 	nrf_rpc_encode_uint(&ctx, scratchpad_size);
 
 	bt_rpc_encode_bt_conn(&ctx, conn);
-	bt_gatt_notify_params_enc(&ctx, params);
+	bt_rpc_gatt_notify_params_enc(&ctx, params);
 
 	nrf_rpc_cbor_cmd_no_err(&bt_rpc_grp, BT_GATT_NOTIFY_CB_RPC_CMD,
 		&ctx, nrf_rpc_rsp_decode_i32, &result);
@@ -803,14 +905,17 @@ int bt_gatt_notify_cb(struct bt_conn *conn,
 int bt_gatt_notify_multiple(struct bt_conn *conn, uint16_t num_params,
 			    struct bt_gatt_notify_params *params)
 {
-	int i, ret;
+	uint16_t batch;
+	int ret;
 
 	__ASSERT(params, "invalid parameters\n");
 	__ASSERT(num_params, "invalid parameters\n");
 	__ASSERT(params->attr, "invalid parameters\n");
 
-	for (i = 0; i < num_params; i++) {
-		ret = bt_gatt_notify_cb(conn, &params[i]);
+	for (uint16_t i = 0; i < num_params; i += batch) {
+		batch = MIN(num_params - i, CONFIG_BT_RPC_GATT_NOTIFY_BATCH_MAX);
+
+		ret = bt_gatt_notify_batch(conn, batch, &params[i]);
 		if (ret < 0) {
 			return ret;
 		}
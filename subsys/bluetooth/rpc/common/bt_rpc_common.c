@@ -13,6 +13,7 @@
 #elif CONFIG_NRF_RPC_UART_TRANSPORT
 #include <nrf_rpc/nrf_rpc_uart.h>
 #endif
+#include <nrf_rpc/nrf_rpc_thread_pool.h>
 #include <nrf_rpc_cbor.h>
 
 #include "bt_rpc_common.h"
@@ -28,6 +29,11 @@ NRF_RPC_IPC_TRANSPORT(bt_rpc_tr, DEVICE_DT_GET(DT_NODELABEL(ipc0)), "bt_rpc_ept"
 #endif
 NRF_RPC_GROUP_DEFINE(bt_rpc_grp, "bt_rpc", &bt_rpc_tr, NULL, NULL, NULL);
 
+#if CONFIG_BT_RPC_THREAD_POOL_SIZE > 0
+NRF_RPC_THREAD_POOL_DEFINE(bt_rpc_pool, bt_rpc_grp, CONFIG_BT_RPC_THREAD_POOL_SIZE,
+			   CONFIG_NRF_RPC_THREAD_STACK_SIZE);
+#endif
+
 enum {
 	CHECK_ENTRY_FLAGS,
 	CHECK_ENTRY_UINT,
@@ -205,7 +211,7 @@ static const CHECK_LIST_ENTRY_TYPE check_table[] = {
 		CONFIG_BT_GATT_CLIENT,
 		CONFIG_BT_RPC_INTERNAL_FUNCTIONS,
 		CONFIG_BT_DEVICE_APPEARANCE_DYNAMIC,
-		0,
+		CONFIG_BT_RPC_GATT_ATTR_CACHE,
 		0,
 		0,
 		0),
@@ -216,6 +222,7 @@ static const CHECK_LIST_ENTRY_TYPE check_table[] = {
 	CHECK_UINT8(CONFIG_BT_PER_ADV_SYNC_MAX),
 	CHECK_UINT16(CONFIG_BT_DEVICE_APPEARANCE),
 	CHECK_UINT16_PAIR(CONFIG_NRF_RPC_CBKPROXY_OUT_SLOTS, CONFIG_NRF_RPC_CBKPROXY_IN_SLOTS),
+	CHECK_UINT8(CONFIG_BT_RPC_GATT_NOTIFY_BATCH_MAX),
 };
 
 static const STR_CHECK_LIST_ENTRY_TYPE str_check_list[] =
@@ -135,6 +135,9 @@ enum bt_rpc_cmd_from_cli_to_host {
 	BT_GATT_RESUBSCRIBE_RPC_CMD,
 	BT_GATT_UNSUBSCRIBE_RPC_CMD,
 	BT_RPC_GATT_SUBSCRIBE_FLAG_UPDATE_RPC_CMD,
+	BT_GATT_NOTIFY_MULTIPLE_RPC_CMD,
+	BT_RPC_GATT_ATTR_CACHE_SET_RPC_CMD,
+	BT_RPC_GATT_ATTR_CACHE_INVALIDATE_RPC_CMD,
 	/* crypto.h API */
 	BT_RAND_RPC_CMD,
 	BT_ENCRYPT_LE_RPC_CMD,
@@ -146,6 +149,14 @@ enum bt_rpc_cmd_from_cli_to_host {
 	BT_HCI_CMD_SEND_SYNC_RPC_CMD,
 };
 
+/** @brief Client events IDs used in bluetooth API serialization.
+ *         Those events are sent from the client to the host.
+ */
+enum bt_rpc_evt_from_cli_to_host {
+	/* gatt.h API */
+	BT_GATT_NOTIFY_MULTIPLE_RPC_EVT,
+};
+
 /** @brief Host commands IDs used in bluetooth API serialization.
  *         Those commands are sent from the host to the client.
  */
@@ -208,6 +219,8 @@ enum bt_rpc_cmd_from_host_to_cli {
 enum bt_rpc_evt_from_host_to_cli {
 	/* bluetooth.h API */
 	BT_READY_CB_T_CALLBACK_RPC_EVT,
+	/* gatt.h API */
+	BT_GATT_NOTIFY_ERROR_RPC_EVT,
 };
 
 /** @brief Pairing flags IDs. Those flags are used to setup valid callback sets on
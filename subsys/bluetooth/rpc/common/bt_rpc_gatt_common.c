@@ -10,6 +10,8 @@
 
 #include <zephyr/bluetooth/gatt.h>
 
+#include <nrf_rpc/nrf_rpc_serialize.h>
+
 #include "bt_rpc_gatt_common.h"
 
 #include <zephyr/logging/log.h>
@@ -224,3 +226,120 @@ void bt_rpc_gatt_foreach_attr_type(uint16_t start_handle, uint16_t end_handle,
 		}
 	}
 }
+
+static size_t uuid_size(const struct bt_uuid *uuid)
+{
+	if (uuid == NULL) {
+		return 0;
+	}
+
+	switch (uuid->type) {
+	case BT_UUID_TYPE_16:
+		return sizeof(struct bt_uuid_16);
+	case BT_UUID_TYPE_32:
+		return sizeof(struct bt_uuid_32);
+	case BT_UUID_TYPE_128:
+		return sizeof(struct bt_uuid_128);
+	default:
+		return 0;
+	}
+}
+
+size_t bt_rpc_gatt_notify_params_buf_size(const struct bt_gatt_notify_params *data)
+{
+	/* The attribute index is not looked up twice, so reserve the maximum for it. */
+	return NRF_RPC_CBOR_INT_MAX_SIZE(uint32_t) +
+	       NRF_RPC_CBOR_UINT_SIZE(data->len) +
+	       nrf_rpc_encode_buffer_size(data->data, data->len) +
+	       NRF_RPC_CBOR_CALLBACK_MAX_SIZE +
+	       NRF_RPC_CBOR_UINT_SIZE((uintptr_t)data->user_data) +
+	       1 + uuid_size(data->uuid);
+}
+
+size_t bt_rpc_gatt_notify_params_sp_size(const struct bt_gatt_notify_params *data)
+{
+	size_t scratchpad_size = 0;
+
+	scratchpad_size += NRF_RPC_SCRATCHPAD_ALIGN(sizeof(uint8_t) * data->len);
+
+	if (data->uuid) {
+		scratchpad_size += NRF_RPC_SCRATCHPAD_ALIGN(uuid_size(data->uuid));
+	}
+
+	return scratchpad_size;
+}
+
+void bt_rpc_gatt_notify_params_enc(struct nrf_rpc_cbor_ctx *ctx,
+				   const struct bt_gatt_notify_params *data)
+{
+	bt_rpc_encode_gatt_attr(ctx, data->attr);
+	nrf_rpc_encode_uint(ctx, data->len);
+	nrf_rpc_encode_buffer(ctx, data->data, sizeof(uint8_t) * data->len);
+	nrf_rpc_encode_callback(ctx, data->func);
+	nrf_rpc_encode_uint(ctx, (uintptr_t)data->user_data);
+
+	if (!data->uuid) {
+		nrf_rpc_encode_null(ctx);
+	} else if (uuid_size(data->uuid) == 0) {
+		nrf_rpc_encoder_invalid(ctx);
+	} else {
+		nrf_rpc_encode_buffer(ctx, data->uuid, uuid_size(data->uuid));
+	}
+}
+
+void bt_rpc_gatt_notify_params_dec(struct nrf_rpc_scratchpad *scratchpad,
+				   struct bt_gatt_notify_params *data, void *func_handler)
+{
+	struct nrf_rpc_cbor_ctx *ctx = scratchpad->ctx;
+
+	data->attr = bt_rpc_decode_gatt_attr(ctx);
+	data->len = nrf_rpc_decode_uint(ctx);
+	data->data = nrf_rpc_decode_buffer_into_scratchpad(scratchpad, NULL);
+	data->func = (bt_gatt_complete_func_t)nrf_rpc_decode_callbackd(ctx, func_handler);
+	data->user_data = (void *)(uintptr_t)nrf_rpc_decode_uint(ctx);
+
+	data->uuid = (struct bt_uuid *)nrf_rpc_decode_buffer_into_scratchpad(scratchpad, NULL);
+}
+
+void bt_rpc_gatt_notify_batch_enc(struct nrf_rpc_cbor_ctx *ctx, uint16_t num_params,
+				  const struct bt_gatt_notify_params *params)
+{
+	nrf_rpc_encode_uint(ctx, num_params);
+
+	for (uint16_t i = 0; i < num_params; i++) {
+		bt_rpc_gatt_notify_params_enc(ctx, &params[i]);
+	}
+}
+
+void bt_rpc_gatt_notify_batch_dec(struct nrf_rpc_scratchpad *scratchpad, struct bt_conn *conn,
+				  void *func_handler, bt_rpc_gatt_notify_t notify, int *result,
+				  uint16_t *failed)
+{
+	struct nrf_rpc_cbor_ctx *ctx = scratchpad->ctx;
+	struct bt_gatt_notify_params params;
+	uint32_t count;
+
+	count = nrf_rpc_decode_uint(ctx);
+
+	if (count > CONFIG_BT_RPC_GATT_NOTIFY_BATCH_MAX) {
+		nrf_rpc_decoder_invalid(ctx, ZCBOR_ERR_WRONG_RANGE);
+		count = 0;
+	}
+
+	*result = 0;
+	*failed = 0;
+
+	for (uint32_t i = 0; i < count; i++) {
+		bt_rpc_gatt_notify_params_dec(scratchpad, &params, func_handler);
+
+		/* Entries after a failed one are decoded, but not sent. */
+		if (*result < 0 || !nrf_rpc_decode_valid(ctx)) {
+			continue;
+		}
+
+		*result = notify(conn, &params);
+		if (*result < 0) {
+			*failed = count - i;
+		}
+	}
+}
@@ -12,6 +12,8 @@
 
 #include <nrf_rpc_cbor.h>
 
+struct nrf_rpc_scratchpad;
+
 #define BT_RPC_GATT_ATTR_READ_PRESENT_FLAG 0x100
 #define BT_RPC_GATT_ATTR_WRITE_PRESENT_FLAG 0x200
 
@@ -135,4 +137,147 @@ void bt_rpc_encode_gatt_attr(struct nrf_rpc_cbor_ctx *ctx, const struct bt_gatt_
  */
 const struct bt_gatt_attr *bt_rpc_decode_gatt_attr(struct nrf_rpc_cbor_ctx *ctx);
 
+/**@brief Function that sends a decoded notification, bt_gatt_notify_cb() on the host.
+ *
+ * @param[in] conn Connection object.
+ * @param[in] params Notification parameters.
+ *
+ * @return 0 on success, otherwise a negative error code.
+ */
+typedef int (*bt_rpc_gatt_notify_t)(struct bt_conn *conn, struct bt_gatt_notify_params *params);
+
+/**@brief Get the maximum encoded size of notification parameters.
+ *
+ * @param[in] data Notification parameters.
+ *
+ * @return Maximum number of bytes encoded by @ref bt_rpc_gatt_notify_params_enc.
+ */
+size_t bt_rpc_gatt_notify_params_buf_size(const struct bt_gatt_notify_params *data);
+
+/**@brief Get the scratchpad size needed to decode notification parameters.
+ *
+ * @param[in] data Notification parameters.
+ *
+ * @return Scratchpad size.
+ */
+size_t bt_rpc_gatt_notify_params_sp_size(const struct bt_gatt_notify_params *data);
+
+/**@brief Encode notification parameters.
+ *
+ * @param[in, out] ctx CBOR encoder context.
+ * @param[in] data Notification parameters.
+ */
+void bt_rpc_gatt_notify_params_enc(struct nrf_rpc_cbor_ctx *ctx,
+				   const struct bt_gatt_notify_params *data);
+
+/**@brief Decode notification parameters.
+ *
+ * The value and the UUID are decoded into the scratchpad.
+ *
+ * @param[in, out] scratchpad Scratchpad with the CBOR decoder context.
+ * @param[out] data Notification parameters.
+ * @param[in] func_handler Callback proxy handler of the notification complete callback.
+ */
+void bt_rpc_gatt_notify_params_dec(struct nrf_rpc_scratchpad *scratchpad,
+				   struct bt_gatt_notify_params *data, void *func_handler);
+
+/**@brief Encode a batch of notifications.
+ *
+ * @param[in, out] ctx CBOR encoder context.
+ * @param[in] num_params Number of notifications, at most
+ *            @kconfig{CONFIG_BT_RPC_GATT_NOTIFY_BATCH_MAX}.
+ * @param[in] params Notification parameters.
+ */
+void bt_rpc_gatt_notify_batch_enc(struct nrf_rpc_cbor_ctx *ctx, uint16_t num_params,
+				  const struct bt_gatt_notify_params *params);
+
+/**@brief Decode a batch of notifications and send them in order.
+ *
+ * Each notification is sent as soon as it is decoded, so only one entry is stored at a time.
+ * Sending stops at the first failure, and the remaining entries are decoded, but not sent.
+ * If an entry cannot be decoded, the decoder context is marked invalid, and the notifications
+ * before that entry have already been sent.
+ *
+ * @param[in, out] scratchpad Scratchpad with the CBOR decoder context.
+ * @param[in] conn Connection object.
+ * @param[in] func_handler Callback proxy handler of the notification complete callback.
+ * @param[in] notify Function that sends a notification.
+ * @param[out] result Result of the last notification sent, or 0 if none was sent.
+ * @param[out] failed Number of notifications not sent because of a failure.
+ */
+void bt_rpc_gatt_notify_batch_dec(struct nrf_rpc_scratchpad *scratchpad, struct bt_conn *conn,
+				  void *func_handler, bt_rpc_gatt_notify_t notify, int *result,
+				  uint16_t *failed);
+
+/**@brief Read callback of the attributes registered by the client.
+ *
+ * Serves the value from the attribute value cache if it is enabled and holds the value.
+ * Otherwise, forwards the read to the client.
+ *
+ * @param[in] conn Connection object.
+ * @param[in] attr GATT attribute.
+ * @param[out] buf Buffer for the value.
+ * @param[in] len Size of the buffer.
+ * @param[in] offset Offset in the attribute value.
+ *
+ * @return Number of bytes read or a GATT error.
+ */
+ssize_t bt_rpc_normal_attr_read(struct bt_conn *conn, const struct bt_gatt_attr *attr, void *buf,
+				uint16_t len, uint16_t offset);
+
+/**@brief Write callback of the attributes registered by the client.
+ *
+ * Forwards the write to the client.
+ *
+ * @param[in] conn Connection object.
+ * @param[in] attr GATT attribute.
+ * @param[in] buf Value to write.
+ * @param[in] len Length of the value.
+ * @param[in] offset Offset in the attribute value.
+ * @param[in] flags Write flags.
+ *
+ * @return Number of bytes written or a GATT error.
+ */
+ssize_t bt_rpc_normal_attr_write(struct bt_conn *conn, const struct bt_gatt_attr *attr,
+				 const void *buf, uint16_t len, uint16_t offset, uint8_t flags);
+
+/**@brief Store the value of an attribute in the attribute value cache.
+ *
+ * Reads of the attribute are served from the cache until the value is removed.
+ *
+ * @param[in] attr GATT attribute.
+ * @param[in] value Attribute value.
+ * @param[in] len Length of the attribute value.
+ *
+ * @retval 0 If the operation was successful.
+ * @retval -ENOMEM If there is no free cache entry or no space for the value.
+ */
+int bt_rpc_gatt_value_cache_set(const struct bt_gatt_attr *attr, const void *value,
+				uint16_t len);
+
+/**@brief Remove the value of an attribute from the attribute value cache.
+ *
+ * @param[in] attr GATT attribute.
+ */
+void bt_rpc_gatt_value_cache_remove(const struct bt_gatt_attr *attr);
+
+/**@brief Remove the values of all attributes of a service from the attribute value cache.
+ *
+ * @param[in] svc GATT service structure.
+ */
+void bt_rpc_gatt_value_cache_remove_service(const struct bt_gatt_service *svc);
+
+/**@brief Read an attribute value from the attribute value cache.
+ *
+ * @param[in] attr GATT attribute.
+ * @param[out] buf Buffer for the value.
+ * @param[in] len Size of the buffer.
+ * @param[in] offset Offset in the attribute value.
+ *
+ * @return Number of bytes read, a GATT error if the offset is invalid,
+ *         or -ENOENT if the attribute value is not cached.
+ */
+ssize_t bt_rpc_gatt_value_cache_read(const struct bt_gatt_attr *attr, void *buf, uint16_t len,
+				     uint16_t offset);
+
 #endif /* BT_RPC_GATT_COMMON_H_ */
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Read and write callbacks of attributes registered by the client. */
+
+#include <zephyr/kernel.h>
+
+#include <zephyr/bluetooth/gatt.h>
+#include <zephyr/bluetooth/conn.h>
+
+#include <nrf_rpc_cbor.h>
+
+#include "bt_rpc_gatt_common.h"
+#include "bt_rpc_common.h"
+#include <nrf_rpc/nrf_rpc_serialize.h>
+
+struct bt_normal_attr_read_res {
+	uint8_t *buf;
+	int read_len;
+};
+
+static void bt_normal_attr_read_rsp(const struct nrf_rpc_group *group, struct nrf_rpc_cbor_ctx *ctx,
+				    void *handler_data)
+{
+	struct bt_normal_attr_read_res *res = (struct bt_normal_attr_read_res *)handler_data;
+
+	res->read_len = nrf_rpc_decode_int(ctx);
+	nrf_rpc_decode_buffer(ctx, res->buf, (res->read_len > 0) ? res->read_len : 0);
+}
+
+ssize_t bt_rpc_normal_attr_read(struct bt_conn *conn, const struct bt_gatt_attr *attr, void *buf,
+				uint16_t len, uint16_t offset)
+{
+	struct nrf_rpc_cbor_ctx ctx;
+	struct bt_normal_attr_read_res result;
+	size_t buffer_size_max = 19;
+	size_t scratchpad_size = 0;
+	uint8_t read_buf[len];
+
+#if defined(CONFIG_BT_RPC_GATT_ATTR_CACHE)
+	ssize_t cached_len = bt_rpc_gatt_value_cache_read(attr, buf, len, offset);
+
+	if (cached_len != -ENOENT) {
+		return cached_len;
+	}
+#endif /* defined(CONFIG_BT_RPC_GATT_ATTR_CACHE) */
+
+	NRF_RPC_CBOR_ALLOC(&bt_rpc_grp, ctx, buffer_size_max);
+
+	scratchpad_size += NRF_RPC_SCRATCHPAD_ALIGN(len);
+
+	nrf_rpc_encode_uint(&ctx, scratchpad_size);
+	bt_rpc_encode_bt_conn(&ctx, conn);
+	bt_rpc_encode_gatt_attr(&ctx, attr);
+	nrf_rpc_encode_uint(&ctx, len);
+	nrf_rpc_encode_uint(&ctx, offset);
+
+	result.buf = read_buf;
+	result.read_len = 0;
+
+	nrf_rpc_cbor_cmd_no_err(&bt_rpc_grp, BT_RPC_GATT_CB_ATTR_READ_RPC_CMD, &ctx,
+				bt_normal_attr_read_rsp, &result);
+
+	if (result.read_len < 0) {
+		return result.read_len;
+	} else {
+		return bt_gatt_attr_read(conn, attr, buf, len, 0, result.buf, result.read_len);
+	}
+}
+
+ssize_t bt_rpc_normal_attr_write(struct bt_conn *conn, const struct bt_gatt_attr *attr,
+				 const void *buf, uint16_t len, uint16_t offset, uint8_t flags)
+{
+	struct nrf_rpc_cbor_ctx ctx;
+	int result;
+	size_t buffer_size_max = 26;
+	size_t scratchpad_size = 0;
+
+	buffer_size_max += len;
+
+	NRF_RPC_CBOR_ALLOC(&bt_rpc_grp, ctx, buffer_size_max);
+
+	scratchpad_size += NRF_RPC_SCRATCHPAD_ALIGN(len);
+
+	nrf_rpc_encode_uint(&ctx, scratchpad_size);
+	bt_rpc_encode_bt_conn(&ctx, conn);
+	bt_rpc_encode_gatt_attr(&ctx, attr);
+	nrf_rpc_encode_uint(&ctx, len);
+	nrf_rpc_encode_uint(&ctx, offset);
+	nrf_rpc_encode_uint(&ctx, flags);
+	nrf_rpc_encode_buffer(&ctx, buf, len);
+
+	nrf_rpc_cbor_cmd_no_err(&bt_rpc_grp, BT_RPC_GATT_CB_ATTR_WRITE_RPC_CMD, &ctx,
+				nrf_rpc_rsp_decode_i32, &result);
+
+	return result;
+}
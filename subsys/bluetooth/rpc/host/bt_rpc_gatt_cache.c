@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Cache of attribute values served by the host without calling the client. */
+
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/bluetooth/gatt.h>
+
+#include "bt_rpc_gatt_common.h"
+
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_DECLARE(BT_RPC, CONFIG_BT_RPC_LOG_LEVEL);
+
+struct value_cache_entry {
+	const struct bt_gatt_attr *attr;
+	uint8_t *value;
+	uint16_t len;
+};
+
+static struct value_cache_entry entries[CONFIG_BT_RPC_GATT_ATTR_CACHE_ENTRIES];
+static K_HEAP_DEFINE(value_heap, CONFIG_BT_RPC_GATT_ATTR_CACHE_SIZE);
+static K_MUTEX_DEFINE(cache_mutex);
+
+static struct value_cache_entry *entry_find(const struct bt_gatt_attr *attr)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(entries); i++) {
+		if (entries[i].attr == attr) {
+			return &entries[i];
+		}
+	}
+
+	return NULL;
+}
+
+static void entry_free(struct value_cache_entry *entry)
+{
+	k_heap_free(&value_heap, entry->value);
+	entry->attr = NULL;
+	entry->value = NULL;
+	entry->len = 0;
+}
+
+int bt_rpc_gatt_value_cache_set(const struct bt_gatt_attr *attr, const void *value,
+				uint16_t len)
+{
+	struct value_cache_entry *entry;
+	uint8_t *copy;
+
+	if (!attr) {
+		return -EINVAL;
+	}
+
+	/* Allocate one byte for an empty value, so that it is distinguished from no value. */
+	copy = k_heap_alloc(&value_heap, MAX(len, 1), K_NO_WAIT);
+	if (!copy) {
+		LOG_WRN("No space for a cached value of %u bytes. %s", len,
+			"Increase CONFIG_BT_RPC_GATT_ATTR_CACHE_SIZE.");
+		return -ENOMEM;
+	}
+
+	if (len > 0) {
+		memcpy(copy, value, len);
+	}
+
+	k_mutex_lock(&cache_mutex, K_FOREVER);
+
+	entry = entry_find(attr);
+	if (entry) {
+		k_heap_free(&value_heap, entry->value);
+	} else {
+		entry = entry_find(NULL);
+	}
+
+	if (entry) {
+		entry->attr = attr;
+		entry->value = copy;
+		entry->len = len;
+	}
+
+	k_mutex_unlock(&cache_mutex);
+
+	if (!entry) {
+		k_heap_free(&value_heap, copy);
+		LOG_WRN("No free cache entry. %s",
+			"Increase CONFIG_BT_RPC_GATT_ATTR_CACHE_ENTRIES.");
+		return -ENOMEM;
+	}
+
+	return 0;
+}
+
+void bt_rpc_gatt_value_cache_remove(const struct bt_gatt_attr *attr)
+{
+	struct value_cache_entry *entry;
+
+	if (!attr) {
+		return;
+	}
+
+	k_mutex_lock(&cache_mutex, K_FOREVER);
+
+	entry = entry_find(attr);
+	if (entry) {
+		entry_free(entry);
+	}
+
+	k_mutex_unlock(&cache_mutex);
+}
+
+void bt_rpc_gatt_value_cache_remove_service(const struct bt_gatt_service *svc)
+{
+	k_mutex_lock(&cache_mutex, K_FOREVER);
+
+	for (size_t i = 0; i < ARRAY_SIZE(entries); i++) {
+		if (entries[i].attr >= svc->attrs &&
+		    entries[i].attr < &svc->attrs[svc->attr_count]) {
+			entry_free(&entries[i]);
+		}
+	}
+
+	k_mutex_unlock(&cache_mutex);
+}
+
+ssize_t bt_rpc_gatt_value_cache_read(const struct bt_gatt_attr *attr, void *buf, uint16_t len,
+				     uint16_t offset)
+{
+	struct value_cache_entry *entry;
+	ssize_t read_len;
+
+	k_mutex_lock(&cache_mutex, K_FOREVER);
+
+	entry = entry_find(attr);
+	if (!entry || !attr) {
+		read_len = -ENOENT;
+	} else if (offset > entry->len) {
+		read_len = BT_GATT_ERR(BT_ATT_ERR_INVALID_OFFSET);
+	} else {
+		read_len = MIN(len, entry->len - offset);
+		memcpy(buf, entry->value + offset, read_len);
+	}
+
+	k_mutex_unlock(&cache_mutex);
+
+	return read_len;
+}
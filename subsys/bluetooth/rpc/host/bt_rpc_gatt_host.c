@@ -252,81 +252,6 @@ decoding_error:
 NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_rpc_gatt_start_service, BT_RPC_GATT_START_SERVICE_RPC_CMD,
 			 bt_rpc_gatt_start_service_rpc_handler, NULL);
 
-struct bt_normal_attr_read_res {
-	uint8_t *buf;
-	int read_len;
-};
-
-static void bt_normal_attr_read_rsp(const struct nrf_rpc_group *group, struct nrf_rpc_cbor_ctx *ctx,
-				    void *handler_data)
-{
-	struct bt_normal_attr_read_res *res = (struct bt_normal_attr_read_res *)handler_data;
-
-	res->read_len = nrf_rpc_decode_int(ctx);
-	nrf_rpc_decode_buffer(ctx, res->buf, (res->read_len > 0) ? res->read_len : 0);
-}
-
-static ssize_t bt_rpc_normal_attr_read(struct bt_conn *conn, const struct bt_gatt_attr *attr,
-				       void *buf, uint16_t len, uint16_t offset)
-{
-	struct nrf_rpc_cbor_ctx ctx;
-	struct bt_normal_attr_read_res result;
-	size_t buffer_size_max = 19;
-	size_t scratchpad_size = 0;
-	uint8_t read_buf[len];
-
-	NRF_RPC_CBOR_ALLOC(&bt_rpc_grp, ctx, buffer_size_max);
-
-	scratchpad_size += NRF_RPC_SCRATCHPAD_ALIGN(len);
-
-	nrf_rpc_encode_uint(&ctx, scratchpad_size);
-	bt_rpc_encode_bt_conn(&ctx, conn);
-	bt_rpc_encode_gatt_attr(&ctx, attr);
-	nrf_rpc_encode_uint(&ctx, len);
-	nrf_rpc_encode_uint(&ctx, offset);
-
-	result.buf = read_buf;
-	result.read_len = 0;
-
-	nrf_rpc_cbor_cmd_no_err(&bt_rpc_grp, BT_RPC_GATT_CB_ATTR_READ_RPC_CMD, &ctx,
-				bt_normal_attr_read_rsp, &result);
-
-	if (result.read_len < 0) {
-		return result.read_len;
-	} else {
-		return bt_gatt_attr_read(conn, attr, buf, len, 0, result.buf, result.read_len);
-	}
-}
-
-static ssize_t bt_rpc_normal_attr_write(struct bt_conn *conn, const struct bt_gatt_attr *attr,
-					const void *buf, uint16_t len, uint16_t offset,
-					uint8_t flags)
-{
-	struct nrf_rpc_cbor_ctx ctx;
-	int result;
-	size_t buffer_size_max = 26;
-	size_t scratchpad_size = 0;
-
-	buffer_size_max += len;
-
-	NRF_RPC_CBOR_ALLOC(&bt_rpc_grp, ctx, buffer_size_max);
-
-	scratchpad_size += NRF_RPC_SCRATCHPAD_ALIGN(len);
-
-	nrf_rpc_encode_uint(&ctx, scratchpad_size);
-	bt_rpc_encode_bt_conn(&ctx, conn);
-	bt_rpc_encode_gatt_attr(&ctx, attr);
-	nrf_rpc_encode_uint(&ctx, len);
-	nrf_rpc_encode_uint(&ctx, offset);
-	nrf_rpc_encode_uint(&ctx, flags);
-	nrf_rpc_encode_buffer(&ctx, buf, len);
-
-	nrf_rpc_cbor_cmd_no_err(&bt_rpc_grp, BT_RPC_GATT_CB_ATTR_WRITE_RPC_CMD, &ctx,
-				nrf_rpc_rsp_decode_i32, &result);
-
-	return result;
-}
-
 static void add_user_attr(struct bt_gatt_attr *attr, const struct bt_uuid *uuid, uint16_t data)
 {
 	attr->uuid = uuid;
@@ -737,6 +662,12 @@ static void bt_rpc_gatt_service_unregister_rpc_handler(const struct nrf_rpc_grou
 		result = bt_gatt_service_unregister((struct bt_gatt_service *)svc);
 	}
 
+#if defined(CONFIG_BT_RPC_GATT_ATTR_CACHE)
+	if (!result) {
+		bt_rpc_gatt_value_cache_remove_service(svc);
+	}
+#endif /* defined(CONFIG_BT_RPC_GATT_ATTR_CACHE) */
+
 	if (!result) {
 		result = bt_rpc_gatt_remove_service(svc);
 	}
@@ -762,6 +693,69 @@ NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_rpc_gatt_service_unregister,
 			 bt_rpc_gatt_service_unregister_rpc_handler, NULL);
 #endif /* CONFIG_BT_GATT_DYNAMIC_DB */
 
+#if defined(CONFIG_BT_RPC_GATT_ATTR_CACHE)
+static void bt_rpc_gatt_attr_cache_set_rpc_handler(const struct nrf_rpc_group *group,
+						   struct nrf_rpc_cbor_ctx *ctx,
+						   void *handler_data)
+{
+	const struct bt_gatt_attr *attr;
+	const void *value;
+	size_t len = 0;
+	bool valid;
+	int result = -EINVAL;
+
+	attr = bt_rpc_decode_gatt_attr(ctx);
+	value = nrf_rpc_decode_buffer_ptr_and_size(ctx, &len);
+	valid = nrf_rpc_decode_valid(ctx);
+
+	/* The cache keeps its own copy, so copy the value straight from the packet
+	 * before releasing it.
+	 */
+	if (valid && attr && (value || len == 0) && len <= UINT16_MAX) {
+		result = bt_rpc_gatt_value_cache_set(attr, value, len);
+	}
+
+	if (!nrf_rpc_decoding_done_and_check(group, ctx)) {
+		goto decoding_error;
+	}
+
+	nrf_rpc_rsp_send_int(group, result);
+
+	return;
+decoding_error:
+	report_decoding_error(BT_RPC_GATT_ATTR_CACHE_SET_RPC_CMD, handler_data);
+}
+
+NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_rpc_gatt_attr_cache_set,
+			 BT_RPC_GATT_ATTR_CACHE_SET_RPC_CMD,
+			 bt_rpc_gatt_attr_cache_set_rpc_handler, NULL);
+
+static void bt_rpc_gatt_attr_cache_invalidate_rpc_handler(const struct nrf_rpc_group *group,
+							  struct nrf_rpc_cbor_ctx *ctx,
+							  void *handler_data)
+{
+	const struct bt_gatt_attr *attr;
+
+	attr = bt_rpc_decode_gatt_attr(ctx);
+
+	if (!nrf_rpc_decoding_done_and_check(group, ctx)) {
+		goto decoding_error;
+	}
+
+	bt_rpc_gatt_value_cache_remove(attr);
+
+	nrf_rpc_rsp_send_int(group, attr ? 0 : -EINVAL);
+
+	return;
+decoding_error:
+	report_decoding_error(BT_RPC_GATT_ATTR_CACHE_INVALIDATE_RPC_CMD, handler_data);
+}
+
+NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_rpc_gatt_attr_cache_invalidate,
+			 BT_RPC_GATT_ATTR_CACHE_INVALIDATE_RPC_CMD,
+			 bt_rpc_gatt_attr_cache_invalidate_rpc_handler, NULL);
+#endif /* defined(CONFIG_BT_RPC_GATT_ATTR_CACHE) */
+
 static inline void bt_gatt_complete_func_t_callback(struct bt_conn *conn, void *user_data,
 						    uint32_t callback_slot)
 {
@@ -781,22 +775,6 @@ static inline void bt_gatt_complete_func_t_callback(struct bt_conn *conn, void *
 NRF_RPC_CBKPROXY_HANDLER(bt_gatt_complete_func_t_encoder, bt_gatt_complete_func_t_callback,
 			 (struct bt_conn *conn, void *user_data), (conn, user_data));
 
-static void bt_gatt_notify_params_dec(struct nrf_rpc_scratchpad *scratchpad,
-				      struct bt_gatt_notify_params *data)
-{
-
-	struct nrf_rpc_cbor_ctx *ctx = scratchpad->ctx;
-
-	data->attr = bt_rpc_decode_gatt_attr(ctx);
-	data->len = nrf_rpc_decode_uint(ctx);
-	data->data = nrf_rpc_decode_buffer_into_scratchpad(scratchpad, NULL);
-	data->func = (bt_gatt_complete_func_t)nrf_rpc_decode_callbackd(
-		ctx, bt_gatt_complete_func_t_encoder);
-	data->user_data = (void *)(uintptr_t)nrf_rpc_decode_uint(ctx);
-
-	data->uuid = (struct bt_uuid *)nrf_rpc_decode_buffer_into_scratchpad(scratchpad, NULL);
-}
-
 static void bt_gatt_notify_cb_rpc_handler(const struct nrf_rpc_group *group,
 					  struct nrf_rpc_cbor_ctx *ctx, void *handler_data)
 {
@@ -809,7 +787,7 @@ static void bt_gatt_notify_cb_rpc_handler(const struct nrf_rpc_group *group,
 	NRF_RPC_SCRATCHPAD_DECLARE(&scratchpad, ctx);
 
 	conn = bt_rpc_decode_bt_conn(ctx);
-	bt_gatt_notify_params_dec(&scratchpad, &params);
+	bt_rpc_gatt_notify_params_dec(&scratchpad, &params, bt_gatt_complete_func_t_encoder);
 
 	if (!nrf_rpc_decoding_done_and_check(group, ctx)) {
 		goto decoding_error;
@@ -827,6 +805,81 @@ decoding_error:
 NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_gatt_notify_cb, BT_GATT_NOTIFY_CB_RPC_CMD,
 			 bt_gatt_notify_cb_rpc_handler, NULL);
 
+/* Returns false if the packet could not be decoded. */
+static bool bt_gatt_notify_batch_dec_send(const struct nrf_rpc_group *group,
+					  struct nrf_rpc_cbor_ctx *ctx, struct bt_conn **conn,
+					  int *result, uint16_t *failed)
+{
+	struct nrf_rpc_scratchpad scratchpad;
+
+	NRF_RPC_SCRATCHPAD_DECLARE(&scratchpad, ctx);
+
+	*conn = bt_rpc_decode_bt_conn(ctx);
+	bt_rpc_gatt_notify_batch_dec(&scratchpad, *conn, bt_gatt_complete_func_t_encoder,
+				     bt_gatt_notify_cb, result, failed);
+
+	return nrf_rpc_decoding_done_and_check(group, ctx);
+}
+
+static void bt_gatt_notify_multiple_rpc_handler(const struct nrf_rpc_group *group,
+						struct nrf_rpc_cbor_ctx *ctx, void *handler_data)
+{
+	struct bt_conn *conn;
+	int result;
+	uint16_t failed;
+
+	if (!bt_gatt_notify_batch_dec_send(group, ctx, &conn, &result, &failed)) {
+		goto decoding_error;
+	}
+
+	nrf_rpc_rsp_send_int(group, result);
+
+	return;
+decoding_error:
+	report_decoding_error(BT_GATT_NOTIFY_MULTIPLE_RPC_CMD, handler_data);
+}
+
+NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, bt_gatt_notify_multiple, BT_GATT_NOTIFY_MULTIPLE_RPC_CMD,
+			 bt_gatt_notify_multiple_rpc_handler, NULL);
+
+static void bt_gatt_notify_error_send(struct bt_conn *conn, int err, uint16_t failed)
+{
+	struct nrf_rpc_cbor_ctx ctx;
+	size_t buffer_size_max = 11;
+
+	NRF_RPC_CBOR_ALLOC(&bt_rpc_grp, ctx, buffer_size_max);
+
+	bt_rpc_encode_bt_conn(&ctx, conn);
+	nrf_rpc_encode_int(&ctx, err);
+	nrf_rpc_encode_uint(&ctx, failed);
+
+	nrf_rpc_cbor_evt_no_err(&bt_rpc_grp, BT_GATT_NOTIFY_ERROR_RPC_EVT, &ctx);
+}
+
+static void bt_gatt_notify_multiple_evt_rpc_handler(const struct nrf_rpc_group *group,
+						    struct nrf_rpc_cbor_ctx *ctx,
+						    void *handler_data)
+{
+	struct bt_conn *conn;
+	int result;
+	uint16_t failed;
+
+	if (!bt_gatt_notify_batch_dec_send(group, ctx, &conn, &result, &failed)) {
+		goto decoding_error;
+	}
+
+	if (result < 0) {
+		bt_gatt_notify_error_send(conn, result, failed);
+	}
+
+	return;
+decoding_error:
+	report_decoding_error(BT_GATT_NOTIFY_MULTIPLE_RPC_EVT, handler_data);
+}
+
+NRF_RPC_CBOR_EVT_DECODER(bt_rpc_grp, bt_gatt_notify_multiple_evt, BT_GATT_NOTIFY_MULTIPLE_RPC_EVT,
+			 bt_gatt_notify_multiple_evt_rpc_handler, NULL);
+
 static void bt_gatt_indicate_params_dec(struct nrf_rpc_scratchpad *scratchpad,
 					struct bt_gatt_indicate_params *data)
 {
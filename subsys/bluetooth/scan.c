@@ -18,9 +18,44 @@ LOG_MODULE_REGISTER(nrf_bt_scan, CONFIG_BT_SCAN_LOG_LEVEL);
 	BT_SCAN_SHORT_NAME_FILTER | BT_SCAN_APPEARANCE_FILTER | \
 	BT_SCAN_UUID_FILTER | BT_SCAN_MANUFACTURER_DATA_FILTER)
 
+/* Number of hash slots of an address table of the given size. Keeping at least
+ * half of the slots free keeps the probe sequences short.
+ */
+#define ADDR_HASH_SLOTS(_size) (2 * (_size))
+
 /* Scan filter mutex. */
 K_MUTEX_DEFINE(scan_mutex);
 
+#if CONFIG_BT_SCAN_BLOCKLIST || CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER
+/* Blocklist and connection attempts filter lock. It is held only for
+ * the hash table operations, so it is cheap to take for every report.
+ */
+static struct k_spinlock device_filter_lock;
+#endif /* CONFIG_BT_SCAN_BLOCKLIST || CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER */
+
+#if CONFIG_BT_SCAN_DEDUP
+/* Duplicate report cache lock. */
+static struct k_spinlock dedup_lock;
+#endif /* CONFIG_BT_SCAN_DEDUP */
+
+/* Open-addressed hash index of the addresses stored in an array.
+ * Each slot holds the array index of an address increased by one,
+ * or zero if the slot is free. Collisions are resolved by linear probing.
+ */
+struct addr_hash {
+	/* Hash slots. */
+	uint16_t *slots;
+
+	/* Number of the hash slots. */
+	size_t slots_num;
+
+	/* First indexed address. */
+	const void *addr;
+
+	/* Distance in bytes between the consecutive indexed addresses. */
+	size_t stride;
+};
+
 /* Scanning control structure used to
  * compare matching filters, their mode and event generation.
  */
@@ -28,6 +63,9 @@ struct bt_scan_control {
 	/* Number of active filters. */
 	uint8_t filter_cnt;
 
+	/* Number of active filters that check the advertising data. */
+	uint8_t ad_filter_cnt;
+
 	/* Number of matched filters. */
 	uint8_t filter_match_cnt;
 
@@ -89,6 +127,9 @@ struct bt_scan_addr_filter {
 	/* Addresses advertised by the peripherals. */
 	bt_addr_le_t target_addr[CONFIG_BT_SCAN_ADDRESS_CNT];
 
+	/* Hash index of the addresses. */
+	uint16_t hash_slots[ADDR_HASH_SLOTS(CONFIG_BT_SCAN_ADDRESS_CNT)];
+
 	/* Address filter counter. */
 	uint8_t cnt;
 
@@ -110,6 +151,17 @@ struct bt_scan_uuid {
 		/* 128-bit UUID. */
 		struct bt_uuid_128 uuid_128;
 	} uuid_data;
+
+	/* 128-bit form of the UUID, as encoded in the advertising data. */
+	uint8_t val_128[BT_SCAN_UUID_128_SIZE];
+
+	/* 16-bit or 32-bit value of the UUID. Valid if the UUID is
+	 * derived from the Bluetooth Base UUID.
+	 */
+	uint32_t val_short;
+
+	/* Indicates that the UUID is derived from the Bluetooth Base UUID. */
+	bool is_short;
 };
 
 /* UUIDs filter structure.
@@ -211,6 +263,9 @@ struct conn_attempts_filter {
 	/* Array of the filtered devices. */
 	struct conn_attempts_device device[CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER_LEN];
 
+	/* Hash index of the device addresses. */
+	uint16_t hash_slots[ADDR_HASH_SLOTS(CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER_LEN)];
+
 	/* The oldest device index. */
 	uint32_t oldest_idx;
 
@@ -225,11 +280,60 @@ struct conn_blocklist {
 	/* Array of the blocklist devices. */
 	bt_addr_le_t addr[CONFIG_BT_SCAN_BLOCKLIST_LEN];
 
+	/* Hash index of the blocklist devices. */
+	uint16_t hash_slots[ADDR_HASH_SLOTS(CONFIG_BT_SCAN_BLOCKLIST_LEN)];
+
 	/* Blocklist device count. */
 	uint32_t count;
 };
 #endif /* CONFIG_BT_SCAN_BLOCKLIST */
 
+#if CONFIG_BT_SCAN_DEDUP
+/* Kinds of the reports tracked by the duplicate report cache. */
+enum dedup_report {
+	DEDUP_REPORT_ADV,
+	DEDUP_REPORT_SCAN_RSP,
+
+	DEDUP_REPORT_COUNT,
+};
+
+/* Duplicate report cache device. */
+struct dedup_device {
+	/* Device address. */
+	bt_addr_le_t addr;
+
+	/* Bit mask of the report kinds that were passed to the application. */
+	uint8_t reported;
+
+	/* Hashes of the reports last passed to the application. */
+	uint32_t hash[DEDUP_REPORT_COUNT];
+
+	/* Uptime of the reports last passed to the application, in milliseconds. */
+	uint32_t report_time[DEDUP_REPORT_COUNT];
+
+	/* Uptime of the last report of any kind passed to the application. */
+	uint32_t last_report_time;
+};
+
+/* Duplicate report cache. */
+struct dedup_cache {
+	/* Array of the cached devices. */
+	struct dedup_device device[CONFIG_BT_SCAN_DEDUP_CACHE_LEN];
+
+	/* Hash index of the device addresses. */
+	uint16_t hash_slots[ADDR_HASH_SLOTS(CONFIG_BT_SCAN_DEDUP_CACHE_LEN)];
+
+	/* The oldest device index. */
+	uint32_t oldest_idx;
+
+	/* Count of the cached devices. */
+	size_t count;
+
+	/* Duplicate report statistics. */
+	struct bt_scan_dedup_stats stats;
+};
+#endif /* CONFIG_BT_SCAN_DEDUP */
+
 /* Scanning module instance. Options for the different scanning modes.
  * This structure stores all module settings. It is used to enable
  * or disable scanning modes and to configure filters.
@@ -266,10 +370,147 @@ static struct bt_scan {
 	struct conn_blocklist blocklist;
 #endif /* CONFIG_BT_SCAN_BLOCKLIST */
 
+#if CONFIG_BT_SCAN_DEDUP
+	/* Duplicate report cache. */
+	struct dedup_cache dedup;
+#endif /* CONFIG_BT_SCAN_DEDUP */
+
 } bt_scan;
 
+static const struct addr_hash addr_filter_hash = {
+	.slots = bt_scan.scan_filters.addr.hash_slots,
+	.slots_num = ARRAY_SIZE(bt_scan.scan_filters.addr.hash_slots),
+	.addr = bt_scan.scan_filters.addr.target_addr,
+	.stride = sizeof(bt_addr_le_t),
+};
+
+#if CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER
+static const struct addr_hash attempts_hash = {
+	.slots = bt_scan.attempts_filter.hash_slots,
+	.slots_num = ARRAY_SIZE(bt_scan.attempts_filter.hash_slots),
+	.addr = &bt_scan.attempts_filter.device[0].addr,
+	.stride = sizeof(struct conn_attempts_device),
+};
+#endif /* CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER */
+
+#if CONFIG_BT_SCAN_BLOCKLIST
+static const struct addr_hash blocklist_hash = {
+	.slots = bt_scan.blocklist.hash_slots,
+	.slots_num = ARRAY_SIZE(bt_scan.blocklist.hash_slots),
+	.addr = bt_scan.blocklist.addr,
+	.stride = sizeof(bt_addr_le_t),
+};
+#endif /* CONFIG_BT_SCAN_BLOCKLIST */
+
+#if CONFIG_BT_SCAN_DEDUP
+static const struct addr_hash dedup_hash = {
+	.slots = bt_scan.dedup.hash_slots,
+	.slots_num = ARRAY_SIZE(bt_scan.dedup.hash_slots),
+	.addr = &bt_scan.dedup.device[0].addr,
+	.stride = sizeof(struct dedup_device),
+};
+#endif /* CONFIG_BT_SCAN_DEDUP */
+
+/* Bluetooth Base UUID, in the little-endian byte order. */
+static const uint8_t base_uuid[BT_SCAN_UUID_128_SIZE] = {
+	BT_UUID_128_ENCODE(0x00000000, 0x0000, 0x1000, 0x8000, 0x00805F9B34FB)
+};
+
 static sys_slist_t callback_list;
 
+static const bt_addr_le_t *addr_hash_entry(const struct addr_hash *hash, uint16_t idx)
+{
+	return (const bt_addr_le_t *)((const uint8_t *)hash->addr + idx * hash->stride);
+}
+
+static size_t addr_hash_home(const struct addr_hash *hash, const bt_addr_le_t *addr)
+{
+	/* Multiplicative hashing. The upper bits of the product are mapped
+	 * to the slot range, which avoids a division.
+	 */
+	uint32_t key = sys_get_le32(&addr->a.val[0]) ^
+		       ((uint32_t)sys_get_le16(&addr->a.val[4]) << 8) ^ addr->type;
+
+	key *= 0x9E3779B1;
+
+	return ((uint64_t)key * hash->slots_num) >> 32;
+}
+
+static size_t addr_hash_next(const struct addr_hash *hash, size_t slot)
+{
+	slot++;
+
+	return (slot == hash->slots_num) ? 0 : slot;
+}
+
+/* Returns the array index of the address or -ENOENT if it is not indexed. */
+static int addr_hash_find(const struct addr_hash *hash, const bt_addr_le_t *addr)
+{
+	size_t slot = addr_hash_home(hash, addr);
+
+	while (hash->slots[slot]) {
+		uint16_t idx = hash->slots[slot] - 1;
+
+		if (bt_addr_le_cmp(addr_hash_entry(hash, idx), addr) == 0) {
+			return idx;
+		}
+
+		slot = addr_hash_next(hash, slot);
+	}
+
+	return -ENOENT;
+}
+
+/* The address must already be stored in the array. */
+static void addr_hash_add(const struct addr_hash *hash, uint16_t idx)
+{
+	size_t slot = addr_hash_home(hash, addr_hash_entry(hash, idx));
+
+	while (hash->slots[slot]) {
+		slot = addr_hash_next(hash, slot);
+	}
+
+	hash->slots[slot] = idx + 1;
+}
+
+#if CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER || CONFIG_BT_SCAN_DEDUP
+/* The address must still be stored in the array. */
+static void addr_hash_remove(const struct addr_hash *hash, uint16_t idx)
+{
+	size_t slot = addr_hash_home(hash, addr_hash_entry(hash, idx));
+	size_t next;
+
+	while (hash->slots[slot] != idx + 1) {
+		slot = addr_hash_next(hash, slot);
+	}
+
+	/* Move back the entries that follow in the probe sequence,
+	 * so that the lookups do not stop at the freed slot.
+	 */
+	next = addr_hash_next(hash, slot);
+
+	for (; hash->slots[next]; next = addr_hash_next(hash, next)) {
+		size_t home = addr_hash_home(hash, addr_hash_entry(hash, hash->slots[next] - 1));
+
+		/* The entry can be moved unless its home slot lies
+		 * cyclically between the freed slot and the entry.
+		 */
+		if ((slot < next) ? (home <= slot || home > next) :
+				    (home <= slot && home > next)) {
+			hash->slots[slot] = hash->slots[next];
+			slot = next;
+		}
+	}
+
+	hash->slots[slot] = 0;
+}
+#endif /* CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER || CONFIG_BT_SCAN_DEDUP */
+
+static void addr_hash_clear(const struct addr_hash *hash)
+{
+	memset(hash->slots, 0, hash->slots_num * sizeof(hash->slots[0]));
+}
+
 void bt_scan_cb_register(struct bt_scan_cb *cb)
 {
 	if (!cb) {
@@ -331,144 +572,238 @@ static void notify_connecting_error(struct bt_scan_device_info *device_info)
 #endif /* CONFIG_BT_CENTRAL */
 
 #if CONFIG_BT_SCAN_BLOCKLIST
+/* Must be called with the device filter lock held. */
 static bool blocklist_device_check(const bt_addr_le_t *addr)
 {
-	bool blocklist_device = false;
-
-	k_mutex_lock(&scan_mutex, K_FOREVER);
-
-	for (size_t i = 0; i < bt_scan.blocklist.count; i++) {
-		if (bt_addr_le_cmp(&bt_scan.blocklist.addr[i], addr) == 0) {
-			blocklist_device = true;
-
-			break;
-		}
-	}
-
-	k_mutex_unlock(&scan_mutex);
-
-	return blocklist_device;
+	return addr_hash_find(&blocklist_hash, addr) >= 0;
 }
 #endif /* CONFIG_BT_SCAN_BLOCKLIST */
 
 #if CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER
-static void attempts_filter_force_add(struct conn_attempts_filter *filter,
-				      const bt_addr_le_t *addr)
+static size_t attempts_filter_force_add(struct conn_attempts_filter *filter)
 {
+	size_t idx = filter->oldest_idx;
+
 	/* Overwrite the oldest device */
-	filter->device[filter->oldest_idx].attempts = 0;
-	bt_addr_le_copy(&filter->device[filter->oldest_idx].addr, addr);
+	addr_hash_remove(&attempts_hash, idx);
 
 	if (filter->oldest_idx == (ARRAY_SIZE(filter->device) - 1)) {
 		filter->oldest_idx = 0;
-
-		return;
+	} else {
+		filter->oldest_idx++;
 	}
 
-	filter->oldest_idx++;
+	return idx;
 }
 
 static void scan_attempts_filter_device_add(const bt_addr_le_t *addr)
 {
 	struct conn_attempts_filter *filter = &bt_scan.attempts_filter;
 	char addr_str[BT_ADDR_LE_STR_LEN];
+	bool forced = false;
+	k_spinlock_key_t key;
+	size_t idx;
 
 	bt_addr_le_to_str(addr, addr_str, sizeof(addr_str));
 
-	k_mutex_lock(&scan_mutex, K_FOREVER);
+	key = k_spin_lock(&device_filter_lock);
 
 	/* Check if device is already in the filter array. */
-	for (size_t i = 0; i < filter->count; i++) {
-		struct conn_attempts_device *device = &filter->device[i];
+	if (addr_hash_find(&attempts_hash, addr) >= 0) {
+		k_spin_unlock(&device_filter_lock, key);
+		LOG_DBG("Device %s is already in the filter array", addr_str);
 
-		if (bt_addr_le_cmp(addr, &device->addr) == 0) {
-			LOG_DBG("Device %s is already in the filter array",
-				addr_str);
-			goto out;
-		}
+		return;
 	}
 
 	if (filter->count >= ARRAY_SIZE(filter->device)) {
-		LOG_DBG("Force adding %s device filter", addr_str);
-		attempts_filter_force_add(filter, addr);
+		idx = attempts_filter_force_add(filter);
+		forced = true;
 	} else {
-		bt_addr_le_copy(&filter->device[filter->count].addr, addr);
+		idx = filter->count;
 		filter->count++;
 	}
 
-out:
-	k_mutex_unlock(&scan_mutex);
+	filter->device[idx].attempts = 0;
+	bt_addr_le_copy(&filter->device[idx].addr, addr);
+	addr_hash_add(&attempts_hash, idx);
+
+	k_spin_unlock(&device_filter_lock, key);
+
+	if (forced) {
+		LOG_DBG("Force adding %s device filter", addr_str);
+	}
 }
 
 static void device_conn_attempts_count(struct bt_conn *conn)
 {
 	const bt_addr_le_t *addr = bt_conn_get_dst(conn);
 	struct conn_attempts_filter *filter = &bt_scan.attempts_filter;
+	k_spinlock_key_t key = k_spin_lock(&device_filter_lock);
+	int idx = addr_hash_find(&attempts_hash, addr);
 
-	k_mutex_lock(&scan_mutex, K_FOREVER);
+	if ((idx >= 0) &&
+	    (filter->device[idx].attempts < CONFIG_BT_SCAN_CONN_ATTEMPTS_COUNT)) {
+		filter->device[idx].attempts++;
+	}
 
-	for (size_t i = 0; i < filter->count; i++) {
-		struct conn_attempts_device *device = &filter->device[i];
+	k_spin_unlock(&device_filter_lock, key);
+}
 
-		if (bt_addr_le_cmp(addr, &device->addr) == 0) {
-			if (device->attempts < CONFIG_BT_SCAN_CONN_ATTEMPTS_COUNT) {
-				device->attempts++;
-			}
+/* Must be called with the device filter lock held. */
+static bool conn_attempts_exceeded(const bt_addr_le_t *addr)
+{
+	int idx = addr_hash_find(&attempts_hash, addr);
 
-			break;
-		}
+	return (idx >= 0) &&
+	       (bt_scan.attempts_filter.device[idx].attempts >=
+		CONFIG_BT_SCAN_CONN_ATTEMPTS_COUNT);
+}
+
+#endif /* CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER */
+
+static bool scan_device_filter_check(const bt_addr_le_t *addr)
+{
+	bool blocked = false;
+	bool exceeded = false;
+
+#if CONFIG_BT_SCAN_BLOCKLIST || CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER
+	k_spinlock_key_t key = k_spin_lock(&device_filter_lock);
+
+#if CONFIG_BT_SCAN_BLOCKLIST
+	blocked = blocklist_device_check(addr);
+#endif /* CONFIG_BT_SCAN_BLOCKLIST */
+
+#if CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER
+	exceeded = !blocked && conn_attempts_exceeded(addr);
+#endif /* CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER */
+
+	k_spin_unlock(&device_filter_lock, key);
+#endif /* CONFIG_BT_SCAN_BLOCKLIST || CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER */
+
+	/* The address is formatted only if it is going to be logged,
+	 * as this function is called for every advertising report.
+	 */
+	if (exceeded && IS_ENABLED(CONFIG_BT_SCAN_LOG_LEVEL_DBG)) {
+		char addr_str[BT_ADDR_LE_STR_LEN];
+
+		bt_addr_le_to_str(addr, addr_str, sizeof(addr_str));
+		LOG_DBG("Connection attempts count for %s exceeded", addr_str);
 	}
 
-	k_mutex_unlock(&scan_mutex);
+	return !blocked && !exceeded;
 }
 
-static bool conn_attempts_exceeded(const bt_addr_le_t *addr)
+#if CONFIG_BT_SCAN_DEDUP
+static uint32_t dedup_report_hash(const struct bt_le_scan_recv_info *info,
+				  const struct net_buf_simple *ad)
 {
-	struct conn_attempts_filter *filter = &bt_scan.attempts_filter;
-	char addr_str[BT_ADDR_LE_STR_LEN];
-	bool attempts_exceeded = false;
+	/* FNV-1a hash of the advertising set, the advertising type
+	 * and properties, and the advertising data.
+	 */
+	const uint8_t head[] = {info->sid, info->adv_type,
+				(uint8_t)info->adv_props, (uint8_t)(info->adv_props >> 8)};
+	uint32_t hash = 2166136261U;
 
-	bt_addr_le_to_str(addr, addr_str, sizeof(addr_str));
+	for (size_t i = 0; i < sizeof(head); i++) {
+		hash = (hash ^ head[i]) * 16777619U;
+	}
 
-	k_mutex_lock(&scan_mutex, K_FOREVER);
+	for (size_t i = 0; i < ad->len; i++) {
+		hash = (hash ^ ad->data[i]) * 16777619U;
+	}
 
-	/* Check if the device is in the filter array. */
-	for (size_t i = 0; i < filter->count; i++) {
-		struct conn_attempts_device *device = &filter->device[i];
+	return hash;
+}
 
-		if (bt_addr_le_cmp(addr, &device->addr) == 0) {
-			if (device->attempts >= CONFIG_BT_SCAN_CONN_ATTEMPTS_COUNT) {
-				LOG_DBG("Connection attempts count for %s exceeded",
-					addr_str);
-				attempts_exceeded = true;
-			}
+/* Must be called with the duplicate report cache lock held. */
+static size_t dedup_device_add(struct dedup_cache *cache,
+			       const bt_addr_le_t *addr)
+{
+	size_t idx;
 
-			break;
+	if (cache->count < ARRAY_SIZE(cache->device)) {
+		idx = cache->count;
+		cache->count++;
+	} else {
+		/* Replace the oldest device. */
+		idx = cache->oldest_idx;
+		addr_hash_remove(&dedup_hash, idx);
+		cache->stats.evictions++;
+
+		if (cache->oldest_idx == (ARRAY_SIZE(cache->device) - 1)) {
+			cache->oldest_idx = 0;
+		} else {
+			cache->oldest_idx++;
 		}
 	}
 
-	k_mutex_unlock(&scan_mutex);
+	bt_addr_le_copy(&cache->device[idx].addr, addr);
+	cache->device[idx].reported = 0;
+	addr_hash_add(&dedup_hash, idx);
 
-	return attempts_exceeded;
+	return idx;
 }
 
-#endif /* CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER */
-
-static bool scan_device_filter_check(const bt_addr_le_t *addr)
+/* Returns false if the report is to be suppressed. */
+static bool dedup_check(const struct bt_le_scan_recv_info *info,
+			const struct net_buf_simple *ad)
 {
-#if CONFIG_BT_SCAN_BLOCKLIST
-	if (blocklist_device_check(addr)) {
-		return false;
+	struct dedup_cache *cache = &bt_scan.dedup;
+	enum dedup_report kind = (info->adv_props & BT_GAP_ADV_PROP_SCAN_RESPONSE) ?
+				 DEDUP_REPORT_SCAN_RSP : DEDUP_REPORT_ADV;
+	uint32_t hash = dedup_report_hash(info, ad);
+	uint32_t now = k_uptime_get_32();
+	struct dedup_device *device;
+	bool pass = true;
+	k_spinlock_key_t key = k_spin_lock(&dedup_lock);
+	int idx = addr_hash_find(&dedup_hash, info->addr);
+
+	if (idx < 0) {
+		idx = dedup_device_add(cache, info->addr);
+		device = &cache->device[idx];
+	} else {
+		device = &cache->device[idx];
+
+		if ((device->reported & BIT(kind)) && (device->hash[kind] == hash) &&
+		    ((now - device->report_time[kind]) < CONFIG_BT_SCAN_DEDUP_TIMEOUT_MS)) {
+			cache->stats.duplicates++;
+			pass = false;
+		} else if ((now - device->last_report_time) <
+			   CONFIG_BT_SCAN_DEDUP_MIN_INTERVAL_MS) {
+			/* The stored hash is not updated, so that the change
+			 * is reported once the interval elapses.
+			 */
+			cache->stats.rate_limited++;
+			pass = false;
+		}
 	}
-#endif /* CONFIG_BT_SCAN_BLOCKLIST */
 
-#if CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER
-	if (conn_attempts_exceeded(addr)) {
-		return false;
+	if (pass) {
+		device->reported |= BIT(kind);
+		device->hash[kind] = hash;
+		device->report_time[kind] = now;
+		device->last_report_time = now;
+		cache->stats.passed++;
 	}
-#endif /* CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER */
 
-	return true;
+	k_spin_unlock(&dedup_lock, key);
+
+	return pass;
+}
+#endif /* CONFIG_BT_SCAN_DEDUP */
+
+static void dedup_clear(void)
+{
+#if CONFIG_BT_SCAN_DEDUP
+	k_spinlock_key_t key = k_spin_lock(&dedup_lock);
+
+	addr_hash_clear(&dedup_hash);
+	bt_scan.dedup.oldest_idx = 0;
+	bt_scan.dedup.count = 0;
+
+	k_spin_unlock(&dedup_lock, key);
+#endif /* CONFIG_BT_SCAN_DEDUP */
 }
 
 #if CONFIG_BT_CENTRAL
@@ -509,19 +844,16 @@ static void scan_connect_with_target(struct bt_scan_control *control,
 static bool adv_addr_compare(const bt_addr_le_t *target_addr,
 			     struct bt_scan_control *control)
 {
-	const bt_addr_le_t *addr =
-			bt_scan.scan_filters.addr.target_addr;
-	uint8_t counter = bt_scan.scan_filters.addr.cnt;
-
-	for (size_t i = 0; i < counter; i++) {
-		if (bt_addr_le_cmp(target_addr, &addr[i]) == 0) {
-			control->filter_status.addr.addr = &addr[i];
+	int idx = addr_hash_find(&addr_filter_hash, target_addr);
 
-			return true;
-		}
+	if (idx < 0) {
+		return false;
 	}
 
-	return false;
+	control->filter_status.addr.addr =
+		&bt_scan.scan_filters.addr.target_addr[idx];
+
+	return true;
 }
 
 static bool is_addr_filter_enabled(void)
@@ -556,14 +888,13 @@ static int scan_addr_filter_add(const bt_addr_le_t *target_addr)
 	}
 
 	/* Check for duplicated filter. */
-	for (size_t i = 0; i < counter; i++) {
-		if (bt_addr_le_cmp(target_addr, &addr_filter[i]) == 0) {
-			return 0;
-		}
+	if (addr_hash_find(&addr_filter_hash, target_addr) >= 0) {
+		return 0;
 	}
 
 	/* Add target address to filter. */
 	bt_addr_le_copy(&addr_filter[counter], target_addr);
+	addr_hash_add(&addr_filter_hash, counter);
 
 	LOG_DBG("Filter set on address type %i",
 		addr_filter[counter].type);
@@ -788,15 +1119,32 @@ static bool find_uuid(const uint8_t *data,
 		return false;
 	}
 
-	for (size_t i = 0; i < data_len; i += uuid_len) {
-		struct bt_uuid_128 uuid;
+	/* 16-bit and 32-bit UUIDs can only be equal to the UUIDs
+	 * derived from the Bluetooth Base UUID.
+	 */
+	if ((uuid_type != BT_UUID_TYPE_128) && !target_uuid->is_short) {
+		return false;
+	}
 
-		if (!bt_uuid_create(&uuid.uuid, &data[i], uuid_len)) {
-			return false;
-		}
+	for (size_t i = 0; (i + uuid_len) <= data_len; i += uuid_len) {
+		switch (uuid_type) {
+		case BT_UUID_TYPE_16:
+			if (sys_get_le16(&data[i]) == target_uuid->val_short) {
+				return true;
+			}
+			break;
 
-		if (bt_uuid_cmp(&uuid.uuid, target_uuid->uuid) == 0) {
-			return true;
+		case BT_UUID_TYPE_32:
+			if (sys_get_le32(&data[i]) == target_uuid->val_short) {
+				return true;
+			}
+			break;
+
+		default:
+			if (memcmp(&data[i], target_uuid->val_128, uuid_len) == 0) {
+				return true;
+			}
+			break;
 		}
 	}
 
@@ -867,6 +1215,35 @@ static void uuid_check(struct bt_scan_control *control,
 	}
 }
 
+/* Prepare the UUID for matching against the advertising data,
+ * so that no UUID conversion is needed for each advertising report.
+ */
+static void uuid_filter_compile(struct bt_scan_uuid *target)
+{
+	struct bt_uuid *uuid = target->uuid;
+
+	switch (uuid->type) {
+	case BT_UUID_TYPE_16:
+		target->val_short = BT_UUID_16(uuid)->val;
+		break;
+
+	case BT_UUID_TYPE_32:
+		target->val_short = BT_UUID_32(uuid)->val;
+		break;
+
+	default:
+		memcpy(target->val_128, BT_UUID_128(uuid)->val,
+		       sizeof(target->val_128));
+		target->val_short = sys_get_le32(&target->val_128[12]);
+		target->is_short = (memcmp(target->val_128, base_uuid, 12) == 0);
+		return;
+	}
+
+	memcpy(target->val_128, base_uuid, sizeof(target->val_128));
+	sys_put_le32(target->val_short, &target->val_128[12]);
+	target->is_short = true;
+}
+
 static int scan_uuid_filter_add(struct bt_uuid *uuid)
 {
 	struct bt_scan_uuid *uuid_filter = bt_scan.scan_filters.uuid.uuid;
@@ -880,13 +1257,6 @@ static int scan_uuid_filter_add(struct bt_uuid *uuid)
 		return -ENOMEM;
 	}
 
-	/* Check for duplicated filter. */
-	for (size_t i = 0; i < counter; i++) {
-		if (bt_uuid_cmp(uuid_filter[i].uuid, uuid) == 0) {
-			return 0;
-		}
-	}
-
 	/* Add UUID to the filter. */
 	switch (uuid->type) {
 	case BT_UUID_TYPE_16:
@@ -917,6 +1287,16 @@ static int scan_uuid_filter_add(struct bt_uuid *uuid)
 		return -EINVAL;
 	}
 
+	uuid_filter_compile(&uuid_filter[counter]);
+
+	/* Check for duplicated filter. */
+	for (size_t i = 0; i < counter; i++) {
+		if (memcmp(uuid_filter[i].val_128, uuid_filter[counter].val_128,
+			   BT_SCAN_UUID_128_SIZE) == 0) {
+			return 0;
+		}
+	}
+
 	bt_scan.scan_filters.uuid.cnt++;
 	LOG_DBG("Added filter on UUID type %x", uuid->type);
 
@@ -1211,6 +1591,9 @@ int bt_scan_filter_add(enum bt_scan_filter_type type,
 
 	k_mutex_unlock(&scan_mutex);
 
+	/* The devices that were reported might match the new filter. */
+	dedup_clear();
+
 	return err;
 }
 
@@ -1229,6 +1612,7 @@ void bt_scan_filter_remove_all(void)
 	struct bt_scan_addr_filter *addr_filter =
 			&bt_scan.scan_filters.addr;
 	addr_filter->cnt = 0;
+	addr_hash_clear(&addr_filter_hash);
 
 	struct bt_scan_uuid_filter *uuid_filter =
 			&bt_scan.scan_filters.uuid;
@@ -1243,6 +1627,8 @@ void bt_scan_filter_remove_all(void)
 	manufacturer_data_filter->cnt = 0;
 
 	k_mutex_unlock(&scan_mutex);
+
+	dedup_clear();
 }
 
 void bt_scan_filter_disable(void)
@@ -1254,6 +1640,8 @@ void bt_scan_filter_disable(void)
 	bt_scan.scan_filters.uuid.enabled = false;
 	bt_scan.scan_filters.appearance.enabled = false;
 	bt_scan.scan_filters.manufacturer_data.enabled = false;
+
+	dedup_clear();
 }
 
 int bt_scan_filter_enable(uint8_t mode, bool match_all)
@@ -1337,6 +1725,7 @@ void bt_scan_init(const struct bt_scan_init_param *init)
 
 	/* Disable all scanning filters. */
 	memset(&bt_scan.scan_filters, 0, sizeof(bt_scan.scan_filters));
+	dedup_clear();
 
 	/* If the pointer to the initialization structure exist,
 	 * use it to scan the configuration.
@@ -1383,10 +1772,6 @@ static void check_enabled_filters(struct bt_scan_control *control)
 {
 	control->filter_cnt = 0;
 
-	if (is_addr_filter_enabled()) {
-		control->filter_cnt++;
-	}
-
 	if (is_name_filter_enabled()) {
 		control->filter_cnt++;
 	}
@@ -1406,13 +1791,17 @@ static void check_enabled_filters(struct bt_scan_control *control)
 	if (is_manufacturer_data_filter_enabled()) {
 		control->filter_cnt++;
 	}
+
+	control->ad_filter_cnt = control->filter_cnt;
+
+	if (is_addr_filter_enabled()) {
+		control->filter_cnt++;
+	}
 }
 
-static bool adv_data_found(struct bt_data *data, void *user_data)
+static void adv_data_found(const struct bt_data *data,
+			   struct bt_scan_control *scan_control)
 {
-	struct bt_scan_control *scan_control =
-			(struct bt_scan_control *)user_data;
-
 	switch (data->type) {
 	case BT_DATA_NAME_COMPLETE:
 		/* Check the name filter. */
@@ -1454,17 +1843,47 @@ static bool adv_data_found(struct bt_data *data, void *user_data)
 	default:
 		break;
 	}
+}
 
-	return true;
+/* Check all the advertising data filters in a single pass over the data.
+ * The advertising data is walked in place, so the buffer state does not
+ * need to be restored for the application.
+ */
+static void adv_data_check(struct bt_scan_control *control,
+			   const struct net_buf_simple *ad)
+{
+	const uint8_t *data = ad->data;
+	size_t len = ad->len;
+
+	while (len > 1) {
+		struct bt_data field;
+		uint8_t field_len = data[0];
+
+		/* Check for early termination. */
+		if (field_len == 0) {
+			return;
+		}
+
+		if (field_len > (len - 1)) {
+			LOG_DBG("Malformed advertising data %u / %zu",
+				field_len, len - 1);
+			return;
+		}
+
+		field.type = data[1];
+		field.data_len = field_len - 1;
+		field.data = &data[2];
+
+		adv_data_found(&field, control);
+
+		data += field_len + 1;
+		len -= field_len + 1;
+	}
 }
 
 static void filter_state_check(struct bt_scan_control *control,
 			       const bt_addr_le_t *addr)
 {
-	if (!scan_device_filter_check(addr)) {
-		return;
-	}
-
 	if (control->all_mode &&
 	    (control->filter_match_cnt == control->filter_cnt)) {
 		notify_filter_matched(&control->device_info,
@@ -1495,7 +1914,19 @@ static void scan_recv(const struct bt_le_scan_recv_info *info,
 		      struct net_buf_simple *ad)
 {
 	struct bt_scan_control scan_control;
-	struct net_buf_simple_state state;
+
+	/* Devices on the blocklist or with too many connection attempts
+	 * do not generate any event, so their data is not checked at all.
+	 */
+	if (!scan_device_filter_check(info->addr)) {
+		return;
+	}
+
+#if CONFIG_BT_SCAN_DEDUP
+	if (!dedup_check(info, ad)) {
+		return;
+	}
+#endif /* CONFIG_BT_SCAN_DEDUP */
 
 	memset(&scan_control, 0, sizeof(scan_control));
 
@@ -1510,12 +1941,9 @@ static void scan_recv(const struct bt_le_scan_recv_info *info,
 	/* Check the address filter. */
 	check_addr(&scan_control, info->addr);
 
-	/* Save advertising buffer state to transfer it
-	 * data to application if futher processing is needed.
-	 */
-	net_buf_simple_save(ad, &state);
-	bt_data_parse(ad, adv_data_found, (void *)&scan_control);
-	net_buf_simple_restore(ad, &state);
+	if (scan_control.ad_filter_cnt > 0) {
+		adv_data_check(&scan_control, ad);
+	}
 
 	scan_control.device_info.recv_info = info;
 	scan_control.device_info.conn_param = &bt_scan.conn_param;
@@ -1547,6 +1975,9 @@ int bt_scan_start(enum bt_scan_type scan_type)
 		return -EINVAL;
 	}
 
+	/* Report every device again in the new scanning session. */
+	dedup_clear();
+
 	/* Start the scanning. */
 	int err = bt_le_scan_start(&bt_scan.scan_param, NULL);
 
@@ -1579,6 +2010,7 @@ int bt_scan_blocklist_device_add(const bt_addr_le_t *addr)
 {
 	int err = 0;
 	char addr_str[BT_ADDR_LE_STR_LEN];
+	k_spinlock_key_t key;
 
 	if (!addr) {
 		return -EINVAL;
@@ -1586,51 +2018,77 @@ int bt_scan_blocklist_device_add(const bt_addr_le_t *addr)
 
 	bt_addr_le_to_str(addr, addr_str, sizeof(addr_str));
 
-	k_mutex_lock(&scan_mutex, K_FOREVER);
+	key = k_spin_lock(&device_filter_lock);
 
 	/* Check if the device is already on the blocklist. */
-	for (size_t i = 0; i < ARRAY_SIZE(bt_scan.blocklist.addr); i++) {
-		if (bt_addr_le_cmp(&bt_scan.blocklist.addr[i], addr) == 0) {
-			LOG_DBG("Device %s is already on the blocklist",
-				addr_str);
-
-			goto out;
-		}
-	}
-
-	if (bt_scan.blocklist.count >= ARRAY_SIZE(bt_scan.blocklist.addr)) {
-		LOG_ERR("No place for the new device");
+	if (addr_hash_find(&blocklist_hash, addr) >= 0) {
+		err = -EALREADY;
+	} else if (bt_scan.blocklist.count >= ARRAY_SIZE(bt_scan.blocklist.addr)) {
 		err = -ENOMEM;
 	} else {
 		bt_addr_le_copy(&bt_scan.blocklist.addr[bt_scan.blocklist.count],
 				addr);
+		addr_hash_add(&blocklist_hash, bt_scan.blocklist.count);
 		bt_scan.blocklist.count++;
-		LOG_INF("Device %s added to the scanning blocklist", addr_str);
 	}
 
-out:
-	k_mutex_unlock(&scan_mutex);
+	k_spin_unlock(&device_filter_lock, key);
+
+	if (err == -EALREADY) {
+		LOG_DBG("Device %s is already on the blocklist", addr_str);
+
+		return 0;
+	} else if (err) {
+		LOG_ERR("No place for the new device");
+	} else {
+		LOG_INF("Device %s added to the scanning blocklist", addr_str);
+	}
 
 	return err;
 }
 
 void bt_scan_blocklist_clear(void)
 {
-	k_mutex_lock(&scan_mutex, K_FOREVER);
+	k_spinlock_key_t key = k_spin_lock(&device_filter_lock);
+
 	memset(&bt_scan.blocklist, 0, sizeof(bt_scan.blocklist));
-	k_mutex_unlock(&scan_mutex);
+	k_spin_unlock(&device_filter_lock, key);
 }
 #endif /* CONFIG_BT_SCAN_BLOCKLIST */
 
 #if CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER
 void bt_scan_conn_attempts_filter_clear(void)
 {
-	k_mutex_lock(&scan_mutex, K_FOREVER);
+	k_spinlock_key_t key = k_spin_lock(&device_filter_lock);
+
 	memset(&bt_scan.attempts_filter, 0, sizeof(bt_scan.attempts_filter));
-	k_mutex_unlock(&scan_mutex);
+	k_spin_unlock(&device_filter_lock, key);
 }
 #endif /* CONFIG_BT_SCAN_CONN_ATTEMPTS_FILTER */
 
+#if CONFIG_BT_SCAN_DEDUP
+void bt_scan_dedup_clear(void)
+{
+	dedup_clear();
+}
+
+void bt_scan_dedup_stats_get(struct bt_scan_dedup_stats *stats)
+{
+	k_spinlock_key_t key = k_spin_lock(&dedup_lock);
+
+	*stats = bt_scan.dedup.stats;
+	k_spin_unlock(&dedup_lock, key);
+}
+
+void bt_scan_dedup_stats_reset(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&dedup_lock);
+
+	memset(&bt_scan.dedup.stats, 0, sizeof(bt_scan.dedup.stats));
+	k_spin_unlock(&dedup_lock, key);
+}
+#endif /* CONFIG_BT_SCAN_DEDUP */
+
 #if CONFIG_BT_CENTRAL
 void bt_scan_update_connect_if_match(bool connect_if_match)
 {
@@ -6,6 +6,7 @@
 
 #include <zephyr/kernel.h>
 #include <zephyr/spinlock.h>
+#include <zephyr/sys/math_extras.h>
 #include <app_event_manager.h>
 #include <event_manager_proxy.h>
 #include <zephyr/logging/log.h>
@@ -16,15 +17,31 @@ LOG_MODULE_REGISTER(event_manager_proxy, CONFIG_APP_EVENT_MANAGER_LOG_LEVEL);
 
 #define EMP_BIND_TIMEOUT K_MSEC(CONFIG_EVENT_MANAGER_PROXY_BIND_TIMEOUT_MS)
 
+/* Size of the record carrying an event of the given size, including the padding. */
+#define EMP_RECORD_SIZE(event_size) \
+	(sizeof(struct emp_event_record) + ROUND_UP(event_size, sizeof(uint32_t)))
+
+/** @brief Numeric event type ID, the index of the event type on the sender core. */
+typedef uint16_t emp_event_id_t;
+
 /* Helpers - allow linker to get information about these structure sizes. */
 static struct event_type _emp_event_type_size_check
 	__used __attribute__((__section__("event_manager_proxy_event_type_size")));
-static struct event_type *_emp_event_type_pointer_size_check
-	__used __attribute__((__section__("event_manager_proxy_event_type_pointer_size")));
+static emp_event_id_t _emp_event_id_size_check
+	__used __attribute__((__section__("event_manager_proxy_event_id_size")));
+static atomic_t _emp_subscribers_size_check
+	__used __attribute__((__section__("event_manager_proxy_subscribers_size")));
 
 /* Array used for inter-core event type mapping. */
-extern struct event_type *event_manager_proxy_array[];
-extern struct event_type *_event_manager_proxy_array_list_end[];
+extern emp_event_id_t event_manager_proxy_array[];
+extern emp_event_id_t _event_manager_proxy_array_list_end[];
+
+/* Bitmap of IPC instances subscribed to the event, one per event type. */
+extern atomic_t event_manager_proxy_subscribers[];
+extern atomic_t _event_manager_proxy_subscribers_list_end[];
+
+BUILD_ASSERT(CONFIG_EVENT_MANAGER_PROXY_CH_COUNT <= 32,
+	     "Subscriber bitmap cannot hold all IPC instances");
 
 
 /** @brief Command codes used by the proxy. */
@@ -47,10 +64,23 @@ struct emp_cmd {
  */
 struct emp_cmd_subscribe {
 	enum emp_cmd_code code;
-	const struct event_type *id;
+	uint32_t id;
 	char name[];
 };
 
+/**
+ * @brief The record of a single event in a message.
+ *
+ * After the proxy is started, every message carries one or more records placed one after
+ * another. Each record is padded to the 4-byte boundary. The event type is identified by
+ * the ID that the receiver passed in the subscribe command.
+ */
+struct emp_event_record {
+	uint16_t size;
+	emp_event_id_t id;
+	uint32_t data[];
+};
+
 /** @brief Inter-core communication data. */
 struct emp_ipc_data {
 	struct ipc_ept ept;
@@ -58,13 +88,30 @@ struct emp_ipc_data {
 	bool used;
 	bool started;
 	struct k_event bound;
-	const struct event_type **event_type_map;
+	emp_event_id_t *event_type_map;
+
+	/** Protects the message being filled with events. */
+	struct k_mutex tx_lock;
+	/** Sends the message once the events pending at the moment are added to it. */
+	struct k_work tx_flush_work;
+	/** The message being filled, NULL if there is none. */
+	uint8_t *tx_buf;
+	size_t tx_buf_size;
+	size_t tx_len;
+	/** Number of received events dropped because of no memory. */
+	uint32_t rx_dropped;
+#ifndef CONFIG_EVENT_MANAGER_PROXY_NOCOPY
+	uint32_t tx_batch[CONFIG_EVENT_MANAGER_PROXY_BATCH_SIZE / sizeof(uint32_t)];
+#endif
 };
 
 
 /** @brief True if proxy was started. */
 static bool emp_started;
 
+/** @brief True if the event types are sorted by name, see @ref find_event_by_name. */
+static bool emp_event_types_sorted;
+
 /** @brief Event informing all remotes have sent start. */
 static K_EVENT_DEFINE(emp_all_remotes_started);
 
@@ -92,9 +139,41 @@ static struct emp_ipc_data *find_ipc_by_instance(const struct device *instance)
 	return NULL;
 }
 
+/**
+ * @brief Get the number of event types.
+ *
+ * @return Number of event types.
+ */
+static size_t event_type_count(void)
+{
+	return _event_type_list_end - _event_type_list_start;
+}
+
+/**
+ * @brief Check if the event types are sorted by name.
+ *
+ * The linker sorts the event type section by the names of the event type definitions,
+ * which consist of a common prefix and the event name. Verify it once, so that the
+ * lookup does not depend on the toolchain behavior.
+ */
+static void check_event_types_sorted(void)
+{
+	for (size_t i = 1; i < event_type_count(); ++i) {
+		if (strcmp(_event_type_list_start[i - 1].name, _event_type_list_start[i].name) >= 0) {
+			LOG_WRN("Event types not sorted by name, using linear lookup");
+			emp_event_types_sorted = false;
+			return;
+		}
+	}
+
+	emp_event_types_sorted = true;
+}
+
 /**
  * @brief Find event type by name.
  *
+ * The event type section is a name table sorted at build time, so the binary search is used.
+ *
  * @param name The name of the event.
  *
  * @retval NULL    Cannot find event.
@@ -102,9 +181,29 @@ static struct emp_ipc_data *find_ipc_by_instance(const struct device *instance)
  */
 static struct event_type *find_event_by_name(const char *name)
 {
-	STRUCT_SECTION_FOREACH(event_type, et) {
-		if (!strcmp(et->name, name)) {
-			return et;
+	if (!emp_event_types_sorted) {
+		STRUCT_SECTION_FOREACH(event_type, et) {
+			if (!strcmp(et->name, name)) {
+				return et;
+			}
+		}
+
+		return NULL;
+	}
+
+	size_t low = 0;
+	size_t high = event_type_count();
+
+	while (low < high) {
+		size_t mid = low + (high - low) / 2;
+		int cmp = strcmp(name, _event_type_list_start[mid].name);
+
+		if (cmp == 0) {
+			return &_event_type_list_start[mid];
+		} else if (cmp < 0) {
+			high = mid;
+		} else {
+			low = mid + 1;
 		}
 	}
 
@@ -151,12 +250,49 @@ static void handle_ipc_endpoint_bound(void *priv)
 	k_event_set(&ipc->bound, 0x1);
 }
 
-static void handle_remote_event(struct emp_ipc_data *ipc, const void *data, size_t len)
+static void handle_remote_events(struct emp_ipc_data *ipc, const void *data, size_t len)
 {
-	void *event = app_event_manager_alloc(len);
+	const uint8_t *pos = data;
+	const uint8_t *end = pos + len;
+	size_t dropped = 0;
+
+	while (pos < end) {
+		const struct emp_event_record *record = (const struct emp_event_record *)pos;
+		void *event = NULL;
+
+		if ((end - pos < sizeof(*record)) ||
+		    (record->size < sizeof(struct app_event_header)) ||
+		    (EMP_RECORD_SIZE(record->size) > end - pos) ||
+		    (record->id >= event_type_count())) {
+			LOG_ERR("Malformed event message from ipc %zu", ipc2idx(ipc));
+			__ASSERT_NO_MSG(false);
+			break;
+		}
 
-	memcpy(event, data, len);
-	_event_submit(event);
+		/* Once an event is dropped, drop the rest of the message to keep the event order.
+		 * The event memory pool is used if enabled.
+		 */
+		if (dropped == 0) {
+			event = app_event_manager_alloc(record->size);
+		}
+
+		if (event) {
+			memcpy(event, record->data, record->size);
+			((struct app_event_header *)event)->type_id =
+				&_event_type_list_start[record->id];
+			_event_submit(event);
+		} else {
+			dropped++;
+		}
+
+		pos += EMP_RECORD_SIZE(record->size);
+	}
+
+	if (dropped > 0) {
+		ipc->rx_dropped += dropped;
+		LOG_WRN("No memory, %zu events from ipc %zu dropped (%u in total)", dropped,
+			ipc2idx(ipc), ipc->rx_dropped);
+	}
 }
 
 static void handle_remote_command_subscribe(struct emp_ipc_data *ipc, const void *data, size_t len)
@@ -184,7 +320,9 @@ static void handle_remote_command_subscribe(struct emp_ipc_data *ipc, const void
 		size_t ctx_idx = ipc2idx(ipc);
 		size_t et_idx = et2idx(et);
 
-		ipc->event_type_map[et_idx] = cmd->id;
+		ipc->event_type_map[et_idx] = (emp_event_id_t)cmd->id;
+		/* Subscriptions from other remotes may be handled at the same time. */
+		atomic_or(&event_manager_proxy_subscribers[et_idx], BIT(ctx_idx));
 		LOG_DBG("Remote event %s registered on ipc %zu", cmd->name, ctx_idx);
 	}
 }
@@ -256,7 +394,7 @@ static void handle_ipc_data_receive(const void *data, size_t len, void *priv)
 	__ASSERT_NO_MSG(!k_is_in_isr());
 
 	if (ipc->started && emp_started) {
-		handle_remote_event(ipc, data, len);
+		handle_remote_events(ipc, data, len);
 	} else {
 		handle_remote_command(ipc, data, len);
 	}
@@ -274,30 +412,130 @@ static void handle_ipc_endpoint_error(const char *message, void *priv)
 	__ASSERT_NO_MSG(false);
 }
 
-static int send_event_to_remote(struct emp_ipc_data *ipc, const struct app_event_header *eh)
+static int ipc_send(struct emp_ipc_data *ipc, const void *data, size_t len)
 {
-	const struct event_type *remote_ev = ipc->event_type_map[et2idx(eh->type_id)];
 	int ret;
 
-	if (remote_ev == NULL) {
-		return 0;
+	for (size_t cnt = CONFIG_EVENT_MANAGER_PROXY_SEND_RETRIES + 1; cnt > 0; --cnt) {
+		ret = ipc_service_send(&ipc->ept, data, len);
+		if (ret >= 0) {
+			break;
+		}
+		k_usleep(1);
 	}
 
-	size_t size = app_event_manager_event_size(eh);
-	uint32_t buffer[DIV_ROUND_UP(size, sizeof(uint32_t))];
-	struct app_event_header *remote_eh = (struct app_event_header *)buffer;
+	return ret;
+}
 
-	memcpy(buffer, eh, sizeof(buffer));
-	remote_eh->type_id = remote_ev;
+/**
+ * @brief Get the buffer for the next message.
+ *
+ * With no-copy enabled, events are written directly to the IPC service TX buffer.
+ * Otherwise, they are collected in the batch buffer of the channel.
+ *
+ * Must be called with the tx_lock held.
+ */
+static int tx_buf_get(struct emp_ipc_data *ipc)
+{
+#ifdef CONFIG_EVENT_MANAGER_PROXY_NOCOPY
+	void *data;
+	uint32_t size;
+	int ret;
 
 	for (size_t cnt = CONFIG_EVENT_MANAGER_PROXY_SEND_RETRIES + 1; cnt > 0; --cnt) {
-		ret = ipc_service_send(&ipc->ept, buffer, sizeof(buffer));
+		/* Request any size, the backend returns the size of the buffer. */
+		size = 0;
+		ret = ipc_service_get_tx_buffer(&ipc->ept, &data, &size, K_NO_WAIT);
 		if (ret >= 0) {
 			break;
 		}
 		k_usleep(1);
 	}
 
+	if (ret < 0) {
+		return ret;
+	}
+
+	ipc->tx_buf = data;
+	ipc->tx_buf_size = size;
+#else
+	ipc->tx_buf = (uint8_t *)ipc->tx_batch;
+	ipc->tx_buf_size = sizeof(ipc->tx_batch);
+#endif
+	ipc->tx_len = 0;
+
+	return 0;
+}
+
+/**
+ * @brief Send the message being filled, if any.
+ *
+ * Must be called with the tx_lock held.
+ */
+static int tx_flush(struct emp_ipc_data *ipc)
+{
+	int ret = 0;
+
+	if (!ipc->tx_buf) {
+		return 0;
+	}
+
+#ifdef CONFIG_EVENT_MANAGER_PROXY_NOCOPY
+	if (ipc->tx_len > 0) {
+		ret = ipc_service_send_nocopy(&ipc->ept, ipc->tx_buf, ipc->tx_len);
+	}
+
+	if ((ipc->tx_len == 0) || (ret < 0)) {
+		ipc_service_drop_tx_buffer(&ipc->ept, ipc->tx_buf);
+	}
+#else
+	if (ipc->tx_len > 0) {
+		ret = ipc_send(ipc, ipc->tx_buf, ipc->tx_len);
+	}
+#endif
+
+	ipc->tx_buf = NULL;
+	ipc->tx_len = 0;
+
+	if (ret < 0) {
+		LOG_ERR("Cannot send events to remote %p, err: %d", ipc, ret);
+		__ASSERT_NO_MSG(false);
+	}
+
+	return ret;
+}
+
+static void tx_flush_work_handler(struct k_work *work)
+{
+	struct emp_ipc_data *ipc = CONTAINER_OF(work, struct emp_ipc_data, tx_flush_work);
+
+	k_mutex_lock(&ipc->tx_lock, K_FOREVER);
+	tx_flush(ipc);
+	k_mutex_unlock(&ipc->tx_lock);
+}
+
+static void record_fill(struct emp_event_record *record, const struct app_event_header *eh,
+			size_t size, emp_event_id_t remote_id)
+{
+	record->size = size;
+	record->id = remote_id;
+	memcpy(record->data, eh, size);
+}
+
+/**
+ * @brief Send the event that does not fit in a message buffer in a separate message.
+ *
+ * Must be called with the tx_lock held.
+ */
+static int send_event_alone(struct emp_ipc_data *ipc, const struct app_event_header *eh,
+			    size_t size, emp_event_id_t remote_id)
+{
+	uint32_t buffer[EMP_RECORD_SIZE(size) / sizeof(uint32_t)];
+	int ret;
+
+	record_fill((struct emp_event_record *)buffer, eh, size, remote_id);
+
+	ret = ipc_send(ipc, buffer, sizeof(buffer));
 	if (ret < 0) {
 		LOG_ERR("Cannot send event to remote %p, err: %d", ipc, ret);
 		__ASSERT_NO_MSG(false);
@@ -306,6 +544,60 @@ static int send_event_to_remote(struct emp_ipc_data *ipc, const struct app_event
 	return ret;
 }
 
+static int send_event_to_remote(struct emp_ipc_data *ipc, const struct app_event_header *eh,
+				emp_event_id_t remote_id)
+{
+	int ret = 0;
+	size_t size = app_event_manager_event_size(eh);
+	size_t record_size = EMP_RECORD_SIZE(size);
+
+	if (size > UINT16_MAX) {
+		LOG_ERR("Event %s too big to be sent to remote", eh->type_id->name);
+		__ASSERT_NO_MSG(false);
+		return -EMSGSIZE;
+	}
+
+	k_mutex_lock(&ipc->tx_lock, K_FOREVER);
+
+	if (ipc->tx_buf && (ipc->tx_len + record_size > ipc->tx_buf_size)) {
+		ret = tx_flush(ipc);
+	}
+
+	if (!ret && !ipc->tx_buf) {
+		ret = tx_buf_get(ipc);
+		if (ret < 0) {
+			LOG_ERR("Cannot get TX buffer for remote %p, err: %d", ipc, ret);
+			__ASSERT_NO_MSG(false);
+		}
+	}
+
+	if (ret < 0) {
+		goto out;
+	}
+
+	if (record_size > ipc->tx_buf_size) {
+		tx_flush(ipc);
+		ret = send_event_alone(ipc, eh, size, remote_id);
+		goto out;
+	}
+
+	record_fill((struct emp_event_record *)&ipc->tx_buf[ipc->tx_len], eh, size, remote_id);
+	ipc->tx_len += record_size;
+
+	if (ipc->tx_len == record_size) {
+		/*
+		 * The first event in the message. The message is sent after the events already
+		 * pending in the system workqueue are processed and added to it.
+		 */
+		k_work_submit(&ipc->tx_flush_work);
+	}
+
+out:
+	k_mutex_unlock(&ipc->tx_lock);
+
+	return ret;
+}
+
 static void event_manager_proxy_on_event_process(const struct app_event_header *eh)
 {
 	int ret = 0;
@@ -314,14 +606,19 @@ static void event_manager_proxy_on_event_process(const struct app_event_header *
 		return;
 	}
 
-	for (size_t i = 0; (i < ARRAY_SIZE(emp_ipc_data)) && !ret; ++i) {
-		struct emp_ipc_data *ipc = &emp_ipc_data[i];
+	size_t et_idx = et2idx(eh->type_id);
+	uint32_t subscribers = atomic_get(&event_manager_proxy_subscribers[et_idx]);
+
+	while (subscribers && !ret) {
+		struct emp_ipc_data *ipc = &emp_ipc_data[u32_count_trailing_zeros(subscribers)];
 
-		if (!ipc->used || !ipc->started) {
+		subscribers &= subscribers - 1;
+
+		if (!ipc->started) {
 			continue;
 		}
 
-		ret = send_event_to_remote(ipc, eh);
+		ret = send_event_to_remote(ipc, eh, ipc->event_type_map[et_idx]);
 	}
 }
 APP_EVENT_HOOK_POSTPROCESS_REGISTER(event_manager_proxy_on_event_process);
@@ -346,15 +643,28 @@ static int add_ipc_instace(struct emp_ipc_data *ipc, const struct device *instan
 		.priv = ipc
 	};
 
-	size_t event_type_count = _event_type_list_end - _event_type_list_start;
+	size_t et_count = event_type_count();
 
-	ipc->event_type_map = (void *)&event_manager_proxy_array[ipc2idx(ipc) * event_type_count];
+	ipc->event_type_map = &event_manager_proxy_array[ipc2idx(ipc) * et_count];
 	__ASSERT_NO_MSG((char *)ipc->event_type_map < (char *)_event_manager_proxy_array_list_end);
-	__ASSERT_NO_MSG((char *)(ipc->event_type_map + event_type_count) <=
+	__ASSERT_NO_MSG((char *)(ipc->event_type_map + et_count) <=
 			(char *)_event_manager_proxy_array_list_end);
-	memset(ipc->event_type_map, 0, event_type_count * sizeof(ipc->event_type_map[0]));
+	__ASSERT_NO_MSG((char *)(event_manager_proxy_subscribers + et_count) <=
+			(char *)_event_manager_proxy_subscribers_list_end);
+	memset(ipc->event_type_map, 0, et_count * sizeof(ipc->event_type_map[0]));
+
+	if (ipc == &emp_ipc_data[0]) {
+		/* The first remote added. */
+		memset(event_manager_proxy_subscribers, 0,
+		       et_count * sizeof(event_manager_proxy_subscribers[0]));
+		check_event_types_sorted();
+	}
 
 	k_event_init(&ipc->bound);
+	k_mutex_init(&ipc->tx_lock);
+	k_work_init(&ipc->tx_flush_work, tx_flush_work_handler);
+	ipc->tx_buf = NULL;
+	ipc->tx_len = 0;
 
 	ret = ipc_service_register_endpoint(instance, &ipc->ept, &ipc->ept_cfg);
 	if (ret) {
@@ -404,7 +714,7 @@ static int send_subscribe_command_to_remote(struct emp_ipc_data *ipc,
 
 	cmd = (struct emp_cmd_subscribe *)buffer;
 	cmd->code = EMP_CMD_SUBSCRIBE;
-	cmd->id  = local_event_id;
+	cmd->id  = et2idx(local_event_id);
 	strcpy(cmd->name, remote_event_name);
 
 	int ret = ipc_service_send(&ipc->ept, buffer, sizeof(buffer));
@@ -28,6 +28,10 @@
 #include <zephyr/logging/log_output.h>
 #include <zephyr/drivers/coredump.h>
 #include <zephyr/random/random.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/cbprintf.h>
+
+#include <zcbor_encode.h>
 
 #include <string.h>
 
@@ -105,6 +109,23 @@ static bool panic_mode;
 static uint32_t log_format = LOG_OUTPUT_TEXT;
 static enum log_rpc_level stream_level = LOG_RPC_LEVEL_NONE;
 static log_timestamp_t log_timestamp_delta;
+static ATOMIC_DEFINE(filtered_out_sources, CONFIG_LOG_BACKEND_RPC_FILTER_SOURCES_MAX);
+
+#ifdef CONFIG_LOG_BACKEND_RPC_BINARY
+/* Level, timestamp, and the headers of the source name and the package. */
+#define BINARY_RECORD_OVERHEAD (1 + 9 + 3 + 5)
+#define BINARY_CONVERT_FLAGS CBPRINTF_PACKAGE_CONVERT_RO_STR
+#define BINARY_STRL_MAX 4
+
+static void batch_flush_task(struct k_work *work);
+static K_MUTEX_DEFINE(batch_mtx);
+static K_WORK_DELAYABLE_DEFINE(batch_flush_work, batch_flush_task);
+static K_THREAD_STACK_DEFINE(batch_flush_workq_stack,
+			     CONFIG_LOG_BACKEND_RPC_BINARY_FLUSH_THREAD_STACK_SIZE);
+static struct k_work_q batch_flush_workq;
+static uint8_t batch_buf[CONFIG_LOG_BACKEND_RPC_BINARY_BATCH_SIZE];
+static size_t batch_len;
+#endif
 
 #ifdef CONFIG_LOG_BACKEND_RPC_HISTORY
 static enum log_rpc_level history_level = LOG_RPC_LEVEL_NONE;
@@ -467,8 +488,8 @@ static int output_to_buf(uint8_t *data, size_t length, void *ctx)
 	return (int)length;
 }
 
-static size_t format_message_to_buf(struct log_msg *msg, uint32_t flags, uint8_t *out,
-				    size_t out_len)
+static __maybe_unused size_t format_message_to_buf(struct log_msg *msg, uint32_t flags,
+						   uint8_t *out, size_t out_len)
 {
 	struct output_to_buf_ctx output_ctx = {
 		.out = out,
@@ -481,7 +502,123 @@ static size_t format_message_to_buf(struct log_msg *msg, uint32_t flags, uint8_t
 	return output_ctx.total_len;
 }
 
-static void stream_message(struct log_msg *msg)
+#ifdef CONFIG_LOG_BACKEND_RPC_BINARY
+
+static int package_to_zcbor(const void *buf, size_t len, void *ctx)
+{
+	zcbor_state_t *zs = ctx;
+
+	if (len > zs->payload_end - zs->payload_mut) {
+		return -ENOSPC;
+	}
+
+	memcpy(zs->payload_mut, buf, len);
+	zs->payload_mut += len;
+
+	return (int)len;
+}
+
+/*
+ * Encodes a log message as a binary record: the level, the timestamp in microseconds, the source
+ * name and the cbprintf package with all strings appended, so that the forwarder can format the
+ * message without access to the memory of this device.
+ *
+ * Returns the record length or 0 if the record does not fit in the buffer.
+ */
+static size_t encode_binary_record(struct log_msg *msg, const char *source_name, uint8_t *out,
+				   size_t out_len)
+{
+	uint16_t strl[BINARY_STRL_MAX];
+	size_t name_len = source_name ? strlen(source_name) : 0;
+	uint8_t *package;
+	size_t package_len;
+	int converted_len;
+	bool ok;
+
+	ZCBOR_STATE_E(zs, 1, out, out_len, 0);
+
+	package = log_msg_get_package(msg, &package_len);
+	converted_len = cbprintf_package_convert(package, package_len, NULL, NULL,
+						 BINARY_CONVERT_FLAGS, strl, ARRAY_SIZE(strl));
+
+	if (converted_len < 0 || BINARY_RECORD_OVERHEAD + name_len + converted_len > out_len) {
+		return 0;
+	}
+
+	ok = zcbor_uint32_put(zs, log_msg_get_level(msg));
+	ok = ok && zcbor_uint64_put(zs, log_output_timestamp_to_us(log_msg_get_timestamp(msg)));
+	ok = ok && (source_name ? zcbor_tstr_encode_ptr(zs, source_name, name_len)
+				: zcbor_nil_put(zs, NULL));
+	ok = ok && zcbor_bstr_start_encode(zs);
+	ok = ok && cbprintf_package_convert(package, package_len, package_to_zcbor, zs,
+					    BINARY_CONVERT_FLAGS, strl, ARRAY_SIZE(strl)) >= 0;
+	ok = ok && zcbor_bstr_end_encode(zs, NULL);
+
+	return ok ? (size_t)(zs->payload_mut - out) : 0;
+}
+
+static void batch_send(const uint8_t *data, size_t length)
+{
+	struct nrf_rpc_cbor_ctx ctx;
+
+	NRF_RPC_CBOR_ALLOC(&log_rpc_group, ctx, length);
+	memcpy(ctx.zs[0].payload_mut, data, length);
+	ctx.zs[0].payload_mut += length;
+	nrf_rpc_cbor_evt_no_err(&log_rpc_group, LOG_RPC_EVT_MSG_BATCH, &ctx);
+}
+
+/* Must be called with batch_mtx locked, or in panic mode. */
+static void batch_flush(void)
+{
+	if (batch_len > 0) {
+		batch_send(batch_buf, batch_len);
+		batch_len = 0;
+	}
+}
+
+static void batch_flush_task(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	k_mutex_lock(&batch_mtx, K_FOREVER);
+	batch_flush();
+	k_mutex_unlock(&batch_mtx);
+}
+
+static void stream_message(struct log_msg *msg, const char *source_name)
+{
+	size_t length;
+
+	k_mutex_lock(&batch_mtx, K_FOREVER);
+
+	length = encode_binary_record(msg, source_name, &batch_buf[batch_len],
+				      sizeof(batch_buf) - batch_len);
+
+	if (length == 0 && batch_len > 0) {
+		/* The batch is full, send it and start a new one. */
+		batch_flush();
+		length = encode_binary_record(msg, source_name, batch_buf, sizeof(batch_buf));
+	}
+
+	if (length == 0) {
+		/* The message does not fit in an empty batch, drop it. */
+		k_mutex_unlock(&batch_mtx);
+		return;
+	}
+
+	if (batch_len == 0) {
+		k_work_schedule_for_queue(&batch_flush_workq, &batch_flush_work,
+					  K_MSEC(CONFIG_LOG_BACKEND_RPC_BINARY_FLUSH_INTERVAL));
+	}
+
+	batch_len += length;
+
+	k_mutex_unlock(&batch_mtx);
+}
+
+#else
+
+static void stream_message(struct log_msg *msg, const char *source_name)
 {
 	const uint32_t flags = common_output_flags | LOG_OUTPUT_FLAG_CRLF_NONE;
 
@@ -489,6 +626,8 @@ static void stream_message(struct log_msg *msg)
 	size_t length;
 	size_t max_length;
 
+	ARG_UNUSED(source_name);
+
 	/* 1. Calculate the formatted message length to allocate a sufficient CBOR encode buffer */
 	length = format_message_to_buf(msg, flags, NULL, 0);
 
@@ -506,25 +645,26 @@ static void stream_message(struct log_msg *msg)
 	nrf_rpc_cbor_evt_no_err(&log_rpc_group, LOG_RPC_EVT_MSG, &ctx);
 }
 
-static const char *log_msg_source_name_get(struct log_msg *msg)
+#endif /* CONFIG_LOG_BACKEND_RPC_BINARY */
+
+static bool log_msg_source_id_get(struct log_msg *msg, uint32_t *source_id)
 {
 	void *source;
-	uint32_t source_id;
 
 	if (log_msg_get_domain(msg) != Z_LOG_LOCAL_DOMAIN_ID) {
-		return NULL;
+		return false;
 	}
 
 	source = (void *)log_msg_get_source(msg);
 
 	if (source == NULL) {
-		return NULL;
+		return false;
 	}
 
-	source_id = IS_ENABLED(CONFIG_LOG_RUNTIME_FILTERING) ? log_dynamic_source_id(source)
-							     : log_const_source_id(source);
+	*source_id = IS_ENABLED(CONFIG_LOG_RUNTIME_FILTERING) ? log_dynamic_source_id(source)
+							      : log_const_source_id(source);
 
-	return TYPE_SECTION_START(log_const)[source_id].name;
+	return true;
 }
 
 static bool starts_with(const char *str, const char *prefix)
@@ -532,7 +672,7 @@ static bool starts_with(const char *str, const char *prefix)
 	return strncmp(str, prefix, strlen(prefix)) == 0;
 }
 
-static bool should_filter_out(struct log_msg *msg)
+static bool source_name_filtered_out(const char *source_name)
 {
 	/*
 	 * Drop messages coming from nRF RPC to avoid the log feedback loop:
@@ -542,24 +682,49 @@ static bool should_filter_out(struct log_msg *msg)
 	 * 4. more logs sent over nRF RPC
 	 * ...
 	 */
-	static const char *const filtered_out_sources[] = {
+	static const char *const filtered_out_prefixes[] = {
 		"nrf_rpc",
 		"NRF_RPC",
 	};
 
-	const char *source_name = log_msg_source_name_get(msg);
-
-	if (source_name != NULL) {
-		for (size_t i = 0; i < ARRAY_SIZE(filtered_out_sources); i++) {
-			if (starts_with(source_name, filtered_out_sources[i])) {
-				return true;
-			}
+	for (size_t i = 0; i < ARRAY_SIZE(filtered_out_prefixes); i++) {
+		if (starts_with(source_name, filtered_out_prefixes[i])) {
+			return true;
 		}
 	}
 
 	return false;
 }
 
+/*
+ * Matches the names of all local log sources once, so that filtering a message only takes
+ * a bit test. Sources beyond the bitmap are matched by name for each message.
+ */
+static void filter_init(void)
+{
+	uint32_t count = MIN(log_src_cnt_get(Z_LOG_LOCAL_DOMAIN_ID),
+			     CONFIG_LOG_BACKEND_RPC_FILTER_SOURCES_MAX);
+
+	for (uint32_t source_id = 0; source_id < count; source_id++) {
+		if (source_name_filtered_out(TYPE_SECTION_START(log_const)[source_id].name)) {
+			atomic_set_bit(filtered_out_sources, source_id);
+		}
+	}
+}
+
+static bool should_filter_out(bool has_source, uint32_t source_id, const char *source_name)
+{
+	if (!has_source) {
+		return false;
+	}
+
+	if (source_id < CONFIG_LOG_BACKEND_RPC_FILTER_SOURCES_MAX) {
+		return atomic_test_bit(filtered_out_sources, source_id);
+	}
+
+	return source_name_filtered_out(source_name);
+}
+
 static void process(const struct log_backend *const backend, union log_msg_generic *msg_generic)
 {
 	struct log_msg *msg = &msg_generic->log;
@@ -572,13 +737,20 @@ static void process(const struct log_backend *const backend, union log_msg_gener
 
 	max_level = stream_level;
 
-	if (max_level != LOG_RPC_LEVEL_NONE && level <= max_level && !should_filter_out(msg)) {
+	if (max_level != LOG_RPC_LEVEL_NONE && level <= max_level) {
 		/*
 		 * The "max_level != LOG_RPC_LEVEL_NONE" condition seems redundant but is in fact
 		 * needed, because a log message can be generated with the level NONE, and such
 		 * a message should also be discarded if the configured maximum level is NONE.
 		 */
-		stream_message(msg);
+		uint32_t source_id = 0;
+		bool has_source = log_msg_source_id_get(msg, &source_id);
+		const char *source_name =
+			has_source ? TYPE_SECTION_START(log_const)[source_id].name : NULL;
+
+		if (!should_filter_out(has_source, source_id, source_name)) {
+			stream_message(msg, source_name);
+		}
 	}
 
 #ifdef CONFIG_LOG_BACKEND_RPC_HISTORY
@@ -604,12 +776,27 @@ static void panic(struct log_backend const *const backend)
 	ARG_UNUSED(backend);
 
 	panic_mode = true;
+
+#ifdef CONFIG_LOG_BACKEND_RPC_BINARY
+	/* The flush work may never run again, so send the pending batch now. */
+	k_work_cancel_delayable(&batch_flush_work);
+	batch_flush();
+#endif
 }
 
 static void init(struct log_backend const *const backend)
 {
 	ARG_UNUSED(backend);
 
+	filter_init();
+
+#ifdef CONFIG_LOG_BACKEND_RPC_BINARY
+	k_work_queue_init(&batch_flush_workq);
+	k_work_queue_start(&batch_flush_workq, batch_flush_workq_stack,
+			   K_THREAD_STACK_SIZEOF(batch_flush_workq_stack),
+			   K_LOWEST_APPLICATION_THREAD_PRIO, NULL);
+#endif
+
 #ifdef CONFIG_LOG_BACKEND_RPC_HISTORY
 	log_rpc_history_init();
 	k_work_queue_init(&history_transfer_workq);
@@ -19,8 +19,12 @@
 
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/sys/cbprintf.h>
+#include <zephyr/sys/printk.h>
 #include <zephyr/sys/util.h>
 
+#include <string.h>
+
 LOG_MODULE_REGISTER(remote, LOG_LEVEL_DBG);
 
 static K_MUTEX_DEFINE(history_transfer_mtx);
@@ -28,6 +32,26 @@ static uint32_t history_transfer_id;
 static log_rpc_history_handler_t history_handler;
 static log_rpc_history_threshold_reached_handler_t history_threshold_reached_handler;
 
+static void log_remote_msg(enum log_rpc_level level, const char *message, size_t message_size)
+{
+	switch (level) {
+	case LOG_RPC_LEVEL_ERR:
+		LOG_ERR("%.*s", message_size, message);
+		break;
+	case LOG_RPC_LEVEL_WRN:
+		LOG_WRN("%.*s", message_size, message);
+		break;
+	case LOG_RPC_LEVEL_INF:
+		LOG_INF("%.*s", message_size, message);
+		break;
+	case LOG_RPC_LEVEL_DBG:
+		LOG_DBG("%.*s", message_size, message);
+		break;
+	default:
+		break;
+	}
+}
+
 static void log_rpc_msg_handler(const struct nrf_rpc_group *group, struct nrf_rpc_cbor_ctx *ctx,
 				void *handler_data)
 {
@@ -39,22 +63,7 @@ static void log_rpc_msg_handler(const struct nrf_rpc_group *group, struct nrf_rp
 	message = nrf_rpc_decode_buffer_ptr_and_size(ctx, &message_size);
 
 	if (message) {
-		switch (level) {
-		case LOG_RPC_LEVEL_ERR:
-			LOG_ERR("%.*s", message_size, message);
-			break;
-		case LOG_RPC_LEVEL_WRN:
-			LOG_WRN("%.*s", message_size, message);
-			break;
-		case LOG_RPC_LEVEL_INF:
-			LOG_INF("%.*s", message_size, message);
-			break;
-		case LOG_RPC_LEVEL_DBG:
-			LOG_DBG("%.*s", message_size, message);
-			break;
-		default:
-			break;
-		}
+		log_remote_msg(level, message, message_size);
 	}
 
 	if (!nrf_rpc_decoding_done_and_check(&log_rpc_group, ctx)) {
@@ -66,6 +75,96 @@ static void log_rpc_msg_handler(const struct nrf_rpc_group *group, struct nrf_rp
 NRF_RPC_CBOR_EVT_DECODER(log_rpc_group, log_rpc_msg_handler, LOG_RPC_EVT_MSG, log_rpc_msg_handler,
 			 NULL);
 
+struct output_buf {
+	char *buf;
+	size_t size;
+	size_t len;
+};
+
+static int output_char(int c, void *ctx)
+{
+	struct output_buf *out = ctx;
+
+	if (out->len < out->size) {
+		out->buf[out->len++] = (char)c;
+	}
+
+	return c;
+}
+
+/*
+ * Formats a message received in the binary format the same way as the RPC logging backend formats
+ * a message in the text format.
+ */
+static void log_remote_binary_msg(enum log_rpc_level level, uint64_t timestamp_us,
+				  const char *source, size_t source_len, const uint8_t *package,
+				  size_t package_len)
+{
+	uint8_t package_buf[CONFIG_LOG_FORWARDER_RPC_PACKAGE_BUFFER_SIZE]
+		__aligned(CBPRINTF_PACKAGE_ALIGNMENT);
+	char output_buf[CONFIG_LOG_FORWARDER_RPC_OUTPUT_BUFFER_SIZE];
+	struct output_buf out = {.buf = output_buf, .size = sizeof(output_buf)};
+	uint64_t ms = timestamp_us / USEC_PER_MSEC;
+	uint32_t seconds = (uint32_t)(ms / MSEC_PER_SEC);
+	int prefix_len;
+
+	if (package_len > sizeof(package_buf)) {
+		return;
+	}
+
+	/* The package is not aligned in the CBOR buffer. */
+	memcpy(package_buf, package, package_len);
+
+	prefix_len = snprintk(output_buf, sizeof(output_buf), "[%02u:%02u:%02u.%03u,%03u] ",
+			      seconds / 3600, (seconds / 60) % 60, seconds % 60,
+			      (uint32_t)(ms % MSEC_PER_SEC),
+			      (uint32_t)(timestamp_us % USEC_PER_MSEC));
+	out.len = MIN((size_t)prefix_len, sizeof(output_buf));
+
+	if (source != NULL) {
+		for (size_t i = 0; i < source_len; i++) {
+			output_char(source[i], &out);
+		}
+
+		output_char(':', &out);
+		output_char(' ', &out);
+	}
+
+	cbpprintf((cbprintf_cb)output_char, &out, package_buf);
+	log_remote_msg(level, output_buf, out.len);
+}
+
+static void log_rpc_msg_batch_handler(const struct nrf_rpc_group *group,
+				      struct nrf_rpc_cbor_ctx *ctx, void *handler_data)
+{
+	enum log_rpc_level level;
+	uint64_t timestamp_us;
+	const char *source;
+	size_t source_len = 0;
+	const uint8_t *package;
+	size_t package_len;
+
+	while (ctx->zs[0].payload < ctx->zs[0].payload_end && nrf_rpc_decode_valid(ctx)) {
+		level = nrf_rpc_decode_uint(ctx);
+		timestamp_us = nrf_rpc_decode_uint64(ctx);
+		source = nrf_rpc_decode_str_ptr_and_len(ctx, &source_len);
+		package = nrf_rpc_decode_buffer_ptr_and_size(ctx, &package_len);
+
+		if (package != NULL) {
+			log_remote_binary_msg(level, timestamp_us, source, source_len, package,
+					      package_len);
+		}
+	}
+
+	if (!nrf_rpc_decoding_done_and_check(&log_rpc_group, ctx)) {
+		nrf_rpc_err(-EBADMSG, NRF_RPC_ERR_SRC_RECV, &log_rpc_group, LOG_RPC_EVT_MSG_BATCH,
+			    NRF_RPC_PACKET_TYPE_EVT);
+	}
+}
+
+NRF_RPC_CBOR_EVT_DECODER(log_rpc_group, log_rpc_msg_batch_handler, LOG_RPC_EVT_MSG_BATCH,
+			 log_rpc_msg_batch_handler, NULL);
+
 void log_rpc_set_stream_level(enum log_rpc_level level)
 {
 	struct nrf_rpc_cbor_ctx ctx;
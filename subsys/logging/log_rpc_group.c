@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "log_rpc_group.h"
+
+#ifdef CONFIG_NRF_RPC_IPC_SERVICE
+#include <nrf_rpc/nrf_rpc_ipc.h>
+#elif defined(CONFIG_NRF_RPC_UART_TRANSPORT)
+#include <nrf_rpc/nrf_rpc_uart.h>
+#elif defined(CONFIG_MOCK_NRF_RPC_LOOPBACK_TRANSPORT)
+#include <mock_nrf_rpc_loopback.h>
+#endif
+
+#include <zephyr/device.h>
+
+#ifdef CONFIG_NRF_RPC_IPC_SERVICE
+NRF_RPC_IPC_TRANSPORT(log_rpc_tr, DEVICE_DT_GET(DT_NODELABEL(ipc0)), "log_rpc_ept");
+#elif defined(CONFIG_NRF_RPC_UART_TRANSPORT)
+#define log_rpc_tr NRF_RPC_UART_TRANSPORT(DT_CHOSEN(nordic_rpc_uart))
+#elif defined(CONFIG_MOCK_NRF_RPC_LOOPBACK_TRANSPORT)
+#define log_rpc_tr mock_nrf_rpc_loopback_tr
+#endif
+NRF_RPC_GROUP_DEFINE(log_rpc_group, "log", &log_rpc_tr, NULL, NULL, NULL);
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <nrf_rpc/nrf_rpc_buf.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/shell/shell.h>
+#include <zephyr/sys/atomic.h>
+
+LOG_MODULE_REGISTER(nrf_rpc_buf, CONFIG_NRF_RPC_TR_LOG_LEVEL);
+
+BUILD_ASSERT(CONFIG_NRF_RPC_BUF_POOL_SMALL_SIZE < CONFIG_NRF_RPC_BUF_POOL_MEDIUM_SIZE &&
+		     CONFIG_NRF_RPC_BUF_POOL_MEDIUM_SIZE < CONFIG_NRF_RPC_BUF_POOL_LARGE_SIZE,
+	     "Buffer size classes must be in ascending order");
+
+K_MEM_SLAB_DEFINE_STATIC(small_slab, CONFIG_NRF_RPC_BUF_POOL_SMALL_SIZE,
+			 CONFIG_NRF_RPC_BUF_POOL_SMALL_COUNT, sizeof(void *));
+K_MEM_SLAB_DEFINE_STATIC(medium_slab, CONFIG_NRF_RPC_BUF_POOL_MEDIUM_SIZE,
+			 CONFIG_NRF_RPC_BUF_POOL_MEDIUM_COUNT, sizeof(void *));
+K_MEM_SLAB_DEFINE_STATIC(large_slab, CONFIG_NRF_RPC_BUF_POOL_LARGE_SIZE,
+			 CONFIG_NRF_RPC_BUF_POOL_LARGE_COUNT, sizeof(void *));
+
+static struct k_mem_slab *const slabs[NRF_RPC_BUF_CLASS_COUNT] = {
+	&small_slab,
+	&medium_slab,
+	&large_slab,
+};
+
+static atomic_t class_allocs[NRF_RPC_BUF_CLASS_COUNT];
+static atomic_t class_max_used[NRF_RPC_BUF_CLASS_COUNT];
+static atomic_t heap_allocs;
+static atomic_t heap_used;
+static atomic_t failures;
+
+static bool slab_owns(const struct k_mem_slab *slab, const void *buf)
+{
+	const char *start = slab->buffer;
+	const char *end = start + slab->info.block_size * slab->info.num_blocks;
+
+	return (const char *)buf >= start && (const char *)buf < end;
+}
+
+static void max_used_update(size_t idx)
+{
+	atomic_val_t used = k_mem_slab_num_used_get(slabs[idx]);
+	atomic_val_t max_used;
+
+	do {
+		max_used = atomic_get(&class_max_used[idx]);
+		if (used <= max_used) {
+			return;
+		}
+	} while (!atomic_cas(&class_max_used[idx], max_used, used));
+}
+
+void *nrf_rpc_buf_alloc(size_t size, k_timeout_t timeout)
+{
+	size_t wait_idx = ARRAY_SIZE(slabs);
+	void *buf;
+
+	for (size_t i = 0; i < ARRAY_SIZE(slabs); i++) {
+		if (size > slabs[i]->info.block_size) {
+			continue;
+		}
+
+		if (wait_idx == ARRAY_SIZE(slabs)) {
+			wait_idx = i;
+		}
+
+		if (k_mem_slab_alloc(slabs[i], &buf, K_NO_WAIT) == 0) {
+			atomic_inc(&class_allocs[i]);
+			max_used_update(i);
+			return buf;
+		}
+	}
+
+	if (IS_ENABLED(CONFIG_NRF_RPC_BUF_POOL_HEAP_FALLBACK)) {
+		buf = k_malloc(size);
+		if (buf) {
+			atomic_inc(&heap_allocs);
+			atomic_inc(&heap_used);
+			return buf;
+		}
+	}
+
+	if (wait_idx < ARRAY_SIZE(slabs) && !K_TIMEOUT_EQ(timeout, K_NO_WAIT) &&
+	    k_mem_slab_alloc(slabs[wait_idx], &buf, timeout) == 0) {
+		atomic_inc(&class_allocs[wait_idx]);
+		max_used_update(wait_idx);
+		return buf;
+	}
+
+	atomic_inc(&failures);
+	LOG_ERR("No buffer of size %zu available", size);
+
+	return NULL;
+}
+
+void nrf_rpc_buf_free(void *buf)
+{
+	if (buf == NULL) {
+		return;
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(slabs); i++) {
+		if (slab_owns(slabs[i], buf)) {
+			k_mem_slab_free(slabs[i], buf);
+			return;
+		}
+	}
+
+	atomic_dec(&heap_used);
+	k_free(buf);
+}
+
+void nrf_rpc_buf_stats_get(struct nrf_rpc_buf_stats *stats)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(slabs); i++) {
+		stats->classes[i].size = slabs[i]->info.block_size;
+		stats->classes[i].count = slabs[i]->info.num_blocks;
+		stats->classes[i].used = k_mem_slab_num_used_get(slabs[i]);
+		stats->classes[i].max_used = atomic_get(&class_max_used[i]);
+		stats->classes[i].allocs = atomic_get(&class_allocs[i]);
+	}
+
+	stats->heap_allocs = atomic_get(&heap_allocs);
+	stats->heap_used = atomic_get(&heap_used);
+	stats->failures = atomic_get(&failures);
+}
+
+void nrf_rpc_buf_stats_reset(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(slabs); i++) {
+		atomic_clear(&class_allocs[i]);
+		atomic_set(&class_max_used[i], k_mem_slab_num_used_get(slabs[i]));
+	}
+
+	atomic_clear(&heap_allocs);
+	atomic_clear(&failures);
+}
+
+#if defined(CONFIG_NRF_RPC_BUF_POOL_SHELL)
+
+static int cmd_nrf_rpc_buf_stats(const struct shell *sh, size_t argc, char **argv)
+{
+	struct nrf_rpc_buf_stats stats;
+
+	nrf_rpc_buf_stats_get(&stats);
+
+	for (size_t i = 0; i < ARRAY_SIZE(stats.classes); i++) {
+		shell_print(sh, "%5u B: used %u/%u, max used %u, allocs %u", stats.classes[i].size,
+			    stats.classes[i].used, stats.classes[i].count,
+			    stats.classes[i].max_used, stats.classes[i].allocs);
+	}
+
+	shell_print(sh, "heap: used %u, allocs %u", stats.heap_used, stats.heap_allocs);
+	shell_print(sh, "failures: %u", stats.failures);
+
+	return 0;
+}
+
+static int cmd_nrf_rpc_buf_reset(const struct shell *sh, size_t argc, char **argv)
+{
+	nrf_rpc_buf_stats_reset();
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_nrf_rpc_buf,
+	SHELL_CMD_ARG(stats, NULL, "Print buffer usage statistics", cmd_nrf_rpc_buf_stats, 1, 0),
+	SHELL_CMD_ARG(reset, NULL, "Reset buffer usage statistics", cmd_nrf_rpc_buf_reset, 1, 0),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_ARG_REGISTER(nrf_rpc_buf, &sub_nrf_rpc_buf, "nRF RPC transport buffers",
+		       cmd_nrf_rpc_buf_stats, 1, 0);
+
+#endif /* CONFIG_NRF_RPC_BUF_POOL_SHELL */
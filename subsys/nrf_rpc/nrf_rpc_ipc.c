@@ -7,6 +7,7 @@
 #include <nrf_rpc.h>
 #include <nrf_rpc_tr.h>
 #include <nrf_rpc_errno.h>
+#include <nrf_rpc/nrf_rpc_buf.h>
 #include <nrf_rpc/nrf_rpc_ipc.h>
 
 #if CONFIG_OPENAMP
@@ -192,7 +193,7 @@ static int send(const struct nrf_rpc_tr *transport, const uint8_t *data, size_t
 		err = 0;
 	}
 
-	k_free((void *)data);
+	nrf_rpc_buf_free((void *)data);
 
 	return translate_error(err);
 }
@@ -207,7 +208,7 @@ static void *tx_buf_alloc(const struct nrf_rpc_tr *transport, size_t *size)
 		goto error;
 	}
 
-	data = k_malloc(*size);
+	data = nrf_rpc_buf_alloc(*size, NRF_RPC_BUF_TX_ALLOC_TIMEOUT);
 	if (!data) {
 		LOG_ERR("Failed to allocate Tx buffer.");
 		goto error;
@@ -231,7 +232,7 @@ static void tx_buf_free(const struct nrf_rpc_tr *transport, void *buf)
 		return;
 	}
 
-	k_free(buf);
+	nrf_rpc_buf_free(buf);
 }
 
 const struct nrf_rpc_tr_api nrf_rpc_ipc_service_api = {
@@ -8,6 +8,7 @@
 #include <nrf_rpc_log.h>
 
 #include "nrf_rpc_os.h"
+#include <nrf_rpc/nrf_rpc_thread_pool.h>
 #include <zephyr/sys/math_extras.h>
 
 /* Maximum number of remote thread that this implementation allows. */
@@ -20,15 +21,11 @@
 	(~(((atomic_val_t)1 << (8 * sizeof(atomic_val_t) -		       \
 				CONFIG_NRF_RPC_CMD_CTX_POOL_SIZE)) - 1))
 
-struct pool_start_msg {
-	const uint8_t *data;
-	size_t len;
-};
+/* Offset of the destination group ID in the nRF RPC packet header. */
+#define PACKET_DST_GROUP_ID_OFFSET 4
 
-static nrf_rpc_os_work_t thread_pool_callback;
 
-static struct pool_start_msg pool_start_msg_buf[2];
-static struct k_msgq pool_start_msg;
+static nrf_rpc_os_work_t thread_pool_callback;
 
 static struct k_sem context_reserved;
 static atomic_t context_mask;
@@ -38,6 +35,21 @@ static K_THREAD_STACK_ARRAY_DEFINE(pool_stacks,
 	CONFIG_NRF_RPC_THREAD_STACK_SIZE);
 
 static struct k_thread pool_threads[CONFIG_NRF_RPC_THREAD_POOL_SIZE];
+static char __aligned(4)
+	pool_msgq_buf[NRF_RPC_THREAD_POOL_QUEUE_LEN * sizeof(struct nrf_rpc_thread_pool_msg)];
+static struct nrf_rpc_thread_pool_data pool_data;
+
+/* Pool of the groups that do not have their own pool. */
+static const struct nrf_rpc_thread_pool default_pool = {
+	.data = &pool_data,
+	.threads = pool_threads,
+	.stacks = (k_thread_stack_t *)pool_stacks,
+	.stack_len = K_THREAD_STACK_LEN(CONFIG_NRF_RPC_THREAD_STACK_SIZE),
+	.stack_size = K_THREAD_STACK_SIZEOF(pool_stacks[0]),
+	.msgq_buf = pool_msgq_buf,
+	.msgq_len = NRF_RPC_THREAD_POOL_QUEUE_LEN,
+	.threads_num = CONFIG_NRF_RPC_THREAD_POOL_SIZE,
+};
 
 BUILD_ASSERT(CONFIG_NRF_RPC_CMD_CTX_POOL_SIZE > 0,
 	     "CONFIG_NRF_RPC_CMD_CTX_POOL_SIZE must be greaten than zero");
@@ -46,20 +58,91 @@ BUILD_ASSERT(CONFIG_NRF_RPC_CMD_CTX_POOL_SIZE <= 8 * sizeof(atomic_val_t),
 BUILD_ASSERT(sizeof(uint32_t) == sizeof(atomic_val_t),
 	     "Only atomic_val_t is implemented that is the same as uint32_t");
 
+static void pool_stats_update(const struct nrf_rpc_thread_pool *pool,
+			      const struct nrf_rpc_thread_pool_msg *msg)
+{
+#ifdef CONFIG_NRF_RPC_THREAD_POOL_STATS
+	struct nrf_rpc_thread_pool_data *data = pool->data;
+	uint32_t delay = k_cycle_get_32() - msg->timestamp;
+	k_spinlock_key_t key = k_spin_lock(&data->lock);
+
+	data->packets++;
+	data->delay_sum += delay;
+	data->delay_max = MAX(data->delay_max, delay);
+	data->busy++;
+	data->busy_max = MAX(data->busy_max, data->busy);
+
+	k_spin_unlock(&data->lock, key);
+#endif
+}
+
+static void pool_stats_done(const struct nrf_rpc_thread_pool *pool)
+{
+#ifdef CONFIG_NRF_RPC_THREAD_POOL_STATS
+	struct nrf_rpc_thread_pool_data *data = pool->data;
+	k_spinlock_key_t key = k_spin_lock(&data->lock);
+
+	data->busy--;
+
+	k_spin_unlock(&data->lock, key);
+#endif
+}
+
 static void thread_pool_entry(void *p1, void *p2, void *p3)
 {
-	struct pool_start_msg msg;
+	const struct nrf_rpc_thread_pool *pool = p1;
+	struct nrf_rpc_thread_pool_msg msg;
 
 	do {
-		k_msgq_get(&pool_start_msg, &msg, K_FOREVER);
+		k_msgq_get(&pool->data->msgq, &msg, K_FOREVER);
+		pool_stats_update(pool, &msg);
 		thread_pool_callback(msg.data, msg.len);
+		pool_stats_done(pool);
 	} while (1);
 }
 
+static void thread_pool_start(const struct nrf_rpc_thread_pool *pool)
+{
+	k_msgq_init(&pool->data->msgq, pool->msgq_buf, sizeof(struct nrf_rpc_thread_pool_msg),
+		    pool->msgq_len);
+
+	for (uint8_t i = 0; i < pool->threads_num; i++) {
+		k_thread_create(&pool->threads[i],
+			(k_thread_stack_t *)((uint8_t *)pool->stacks + i * pool->stack_len),
+			pool->stack_size,
+			thread_pool_entry,
+			(void *)pool, NULL, NULL,
+			CONFIG_NRF_RPC_THREAD_PRIORITY, 0, K_NO_WAIT);
+		k_thread_name_set(&pool->threads[i], "rpc");
+	}
+}
+
+/* Commands and events are executed by the pool of their destination group. Responses are
+ * passed by the nRF RPC core directly to the waiting thread, which is identified by the
+ * context ID in the packet header, so they never wait for a pool thread.
+ */
+static const struct nrf_rpc_thread_pool *thread_pool_get(const uint8_t *data, size_t len)
+{
+	uint8_t group_id;
+
+	if (len <= PACKET_DST_GROUP_ID_OFFSET) {
+		return &default_pool;
+	}
+
+	group_id = data[PACKET_DST_GROUP_ID_OFFSET];
+
+	STRUCT_SECTION_FOREACH(nrf_rpc_thread_pool, pool) {
+		if (pool->group->data->src_group_id == group_id) {
+			return pool;
+		}
+	}
+
+	return &default_pool;
+}
+
 int nrf_rpc_os_init(nrf_rpc_os_work_t callback)
 {
 	int err;
-	int i;
 
 	__ASSERT_NO_MSG(callback != NULL);
 
@@ -73,17 +156,10 @@ int nrf_rpc_os_init(nrf_rpc_os_work_t callback)
 
 	atomic_set(&context_mask, CONTEXT_MASK_INIT_VALUE);
 
-	k_msgq_init(&pool_start_msg, (char *)pool_start_msg_buf,
-		    sizeof(struct pool_start_msg),
-		    ARRAY_SIZE(pool_start_msg_buf));
+	thread_pool_start(&default_pool);
 
-	for (i = 0; i < CONFIG_NRF_RPC_THREAD_POOL_SIZE; i++) {
-		k_thread_create(&pool_threads[i], pool_stacks[i],
-			K_THREAD_STACK_SIZEOF(pool_stacks[i]),
-			thread_pool_entry,
-			NULL, NULL, NULL,
-			CONFIG_NRF_RPC_THREAD_PRIORITY, 0, K_NO_WAIT);
-		k_thread_name_set(&pool_threads[i], "rpc");
+	STRUCT_SECTION_FOREACH(nrf_rpc_thread_pool, pool) {
+		thread_pool_start(pool);
 	}
 
 	return 0;
@@ -91,11 +167,21 @@ int nrf_rpc_os_init(nrf_rpc_os_work_t callback)
 
 void nrf_rpc_os_thread_pool_send(const uint8_t *data, size_t len)
 {
-	struct pool_start_msg msg;
+	const struct nrf_rpc_thread_pool *pool = thread_pool_get(data, len);
+	struct nrf_rpc_thread_pool_msg msg;
 
 	msg.data = data;
 	msg.len = len;
-	k_msgq_put(&pool_start_msg, &msg, K_FOREVER);
+	msg.timestamp = IS_ENABLED(CONFIG_NRF_RPC_THREAD_POOL_STATS) ? k_cycle_get_32() : 0;
+
+	/* Called by the receiving thread of a transport, which must not wait for a pool thread,
+	 * as the responses that the pool threads wait for would not be received either.
+	 */
+	if (k_msgq_put(&pool->data->msgq, &msg, K_NO_WAIT) != 0) {
+		NRF_RPC_ERR("Thread pool queue full, packet dropped");
+		nrf_rpc_err(-NRF_ENOMEM, NRF_RPC_ERR_SRC_RECV, pool->group, NRF_RPC_ID_UNKNOWN,
+			    NRF_RPC_PACKET_TYPE_CMD);
+	}
 }
 
 void nrf_rpc_os_msg_set(struct nrf_rpc_os_msg *msg, const uint8_t *data,
@@ -154,3 +240,56 @@ void nrf_rpc_os_ctx_pool_release(uint32_t number)
 	atomic_or(&context_mask, 0x80000000u >> number);
 	k_sem_give(&context_reserved);
 }
+
+#ifdef CONFIG_NRF_RPC_THREAD_POOL_STATS
+
+static const struct nrf_rpc_thread_pool *thread_pool_find(const struct nrf_rpc_group *group)
+{
+	STRUCT_SECTION_FOREACH(nrf_rpc_thread_pool, pool) {
+		if (pool->group == group) {
+			return pool;
+		}
+	}
+
+	return &default_pool;
+}
+
+void nrf_rpc_thread_pool_stats_get(const struct nrf_rpc_group *group,
+				   struct nrf_rpc_thread_pool_stats *stats)
+{
+	const struct nrf_rpc_thread_pool *pool = thread_pool_find(group);
+	struct nrf_rpc_thread_pool_data *data = pool->data;
+	k_spinlock_key_t key = k_spin_lock(&data->lock);
+
+	stats->packets = data->packets;
+	stats->delay_avg_us = data->packets ? k_cyc_to_us_floor32(data->delay_sum / data->packets)
+					    : 0;
+	stats->delay_max_us = k_cyc_to_us_floor32(data->delay_max);
+	stats->busy_max = data->busy_max;
+
+	k_spin_unlock(&data->lock, key);
+}
+
+static void pool_stats_reset(const struct nrf_rpc_thread_pool *pool)
+{
+	struct nrf_rpc_thread_pool_data *data = pool->data;
+	k_spinlock_key_t key = k_spin_lock(&data->lock);
+
+	data->packets = 0;
+	data->delay_sum = 0;
+	data->delay_max = 0;
+	data->busy_max = data->busy;
+
+	k_spin_unlock(&data->lock, key);
+}
+
+void nrf_rpc_thread_pool_stats_reset(void)
+{
+	pool_stats_reset(&default_pool);
+
+	STRUCT_SECTION_FOREACH(nrf_rpc_thread_pool, pool) {
+		pool_stats_reset(pool);
+	}
+}
+
+#endif /* CONFIG_NRF_RPC_THREAD_POOL_STATS */
@@ -8,6 +8,7 @@
 #include <nrf_rpc_tr.h>
 #include <nrf_rpc/nrf_rpc_uart.h>
 #include <nrf_rpc_errno.h>
+#include <nrf_rpc/nrf_rpc_buf.h>
 
 #include <zephyr/drivers/uart.h>
 #include <zephyr/logging/log.h>
@@ -19,6 +20,16 @@ LOG_MODULE_REGISTER(nrf_rpc_uart, CONFIG_NRF_RPC_TR_LOG_LEVEL);
 
 #define CRC_SIZE sizeof(uint16_t)
 
+#if CONFIG_NRF_RPC_UART_RELIABLE_WINDOW
+#define WINDOW_SIZE   CONFIG_NRF_RPC_UART_WINDOW_SIZE
+#define SEQ_MASK      0x7fu
+#define SEQ_RANGE     (SEQ_MASK + 1)
+#define SEQ_SYNC      0x80u
+#define SEQ_SIZE      sizeof(uint8_t)
+
+BUILD_ASSERT(IS_POWER_OF_TWO(WINDOW_SIZE), "Window size must be a power of two");
+#endif
+
 enum {
 	HDLC_CHAR_ESCAPE = 0x7d,
 	HDLC_CHAR_DELIMITER = 0x7e,
@@ -54,6 +65,25 @@ struct hdlc_decode_ctx {
 	uint16_t capacity;
 };
 
+#if CONFIG_NRF_RPC_UART_RELIABLE_WINDOW
+/* A frame that has been sent and is kept until it is acknowledged. */
+struct tx_frame {
+	const uint8_t *data;
+	size_t length;
+	uint16_t crc;
+	/* Sequence number, and SEQ_SYNC for a frame that restarts the receiver window. */
+	uint8_t header;
+	uint8_t attempts;
+	k_timepoint_t deadline;
+};
+
+/* A frame received after a missing one and kept until the missing one is received. */
+struct rx_frame {
+	uint8_t *data;
+	size_t length;
+};
+#endif
+
 struct nrf_rpc_uart {
 	const struct device *uart;
 	nrf_rpc_tr_receive_handler_t receive_callback;
@@ -86,6 +116,35 @@ struct nrf_rpc_uart {
 
 	/* TX lock */
 	struct k_mutex tx_lock;
+
+#if CONFIG_NRF_RPC_UART_TX_BUFFERED
+	/* TX ring buffer drained by UART ISR */
+	uint8_t tx_buffer[CONFIG_NRF_RPC_UART_TX_RINGBUF_SIZE];
+	struct ring_buf tx_ringbuf;
+	struct k_sem tx_space_sem;
+#endif
+
+#if CONFIG_NRF_RPC_UART_RELIABLE_WINDOW
+	/* Unacknowledged frames, indexed by the sequence number modulo the window size */
+	struct tx_frame tx_window[WINDOW_SIZE];
+	/* Protects the sequence numbers and the ack bitmap below, which are used by UART ISR */
+	struct k_spinlock window_lock;
+	uint8_t tx_seq_first;
+	uint8_t tx_seq_next;
+	uint32_t tx_acked;
+	bool tx_sync;
+	/* Error to be returned by the next send() call */
+	int tx_err;
+	struct k_work_delayable retx_work;
+	struct k_work_q retx_workq;
+
+	K_KERNEL_STACK_MEMBER(retx_workq_stack, CONFIG_NRF_RPC_UART_RETX_THREAD_STACK_SIZE);
+
+	/* Receiver state */
+	struct rx_frame rx_window[WINDOW_SIZE];
+	bool rx_synced;
+	uint8_t rx_seq_next;
+#endif
 };
 
 static void log_hexdump_dbg(const uint8_t *data, size_t length, const char *fmt, ...)
@@ -102,10 +161,127 @@ static void log_hexdump_dbg(const uint8_t *data, size_t length, const char *fmt,
 	}
 }
 
-static void send_byte(const struct device *dev, uint8_t byte);
+#if CONFIG_NRF_RPC_UART_TX_BUFFERED
+
+/* Queue bytes as they are and let UART ISR transmit them. */
+static void tx_raw(struct nrf_rpc_uart *uart_tr, const uint8_t *data, size_t length)
+{
+	uint32_t written;
+
+	while (length > 0) {
+		written = ring_buf_put(&uart_tr->tx_ringbuf, data, length);
+		data += written;
+		length -= written;
+
+		uart_irq_tx_enable(uart_tr->uart);
+
+		if (length > 0) {
+			k_sem_take(&uart_tr->tx_space_sem, K_FOREVER);
+		}
+	}
+}
+
+/* Escape bytes into a chunk on the stack and queue a full chunk at a time. */
+static void tx_escaped(struct nrf_rpc_uart *uart_tr, const uint8_t *data, size_t length)
+{
+	uint8_t chunk[CONFIG_NRF_RPC_UART_TX_CHUNK_SIZE];
+	size_t chunk_len = 0;
+	uint8_t byte;
+
+	for (size_t i = 0; i < length; i++) {
+		if (chunk_len > sizeof(chunk) - 2) {
+			tx_raw(uart_tr, chunk, chunk_len);
+			chunk_len = 0;
+		}
+
+		byte = data[i];
+
+		if (byte == HDLC_CHAR_DELIMITER || byte == HDLC_CHAR_ESCAPE) {
+			chunk[chunk_len++] = HDLC_CHAR_ESCAPE;
+			byte ^= 0x20;
+		}
+
+		chunk[chunk_len++] = byte;
+	}
+
+	tx_raw(uart_tr, chunk, chunk_len);
+}
+
+static void tx_isr(struct nrf_rpc_uart *uart_tr)
+{
+	uint8_t *data;
+	uint32_t len;
+	int sent;
+
+	len = ring_buf_get_claim(&uart_tr->tx_ringbuf, &data, uart_tr->tx_ringbuf.size);
+	if (len == 0) {
+		uart_irq_tx_disable(uart_tr->uart);
+
+		/* Bytes may have been queued after the ring buffer was found empty. */
+		if (!ring_buf_is_empty(&uart_tr->tx_ringbuf)) {
+			uart_irq_tx_enable(uart_tr->uart);
+		}
+
+		return;
+	}
+
+	sent = uart_fifo_fill(uart_tr->uart, data, len);
+	ring_buf_get_finish(&uart_tr->tx_ringbuf, MAX(sent, 0));
+	k_sem_give(&uart_tr->tx_space_sem);
+}
+
+#else /* CONFIG_NRF_RPC_UART_TX_BUFFERED */
+
+static void tx_raw(struct nrf_rpc_uart *uart_tr, const uint8_t *data, size_t length)
+{
+	for (size_t i = 0; i < length; i++) {
+		uart_poll_out(uart_tr->uart, data[i]);
+	}
+}
+
+static void tx_escaped(struct nrf_rpc_uart *uart_tr, const uint8_t *data, size_t length)
+{
+	uint8_t byte;
+
+	for (size_t i = 0; i < length; i++) {
+		byte = data[i];
+
+		if (byte == HDLC_CHAR_DELIMITER || byte == HDLC_CHAR_ESCAPE) {
+			uart_poll_out(uart_tr->uart, HDLC_CHAR_ESCAPE);
+			byte ^= 0x20;
+		}
+
+		uart_poll_out(uart_tr->uart, byte);
+	}
+}
+
+#endif /* CONFIG_NRF_RPC_UART_TX_BUFFERED */
+
+/* Write a complete frame. The caller must prevent other frames from being interleaved. */
+static void frame_tx(struct nrf_rpc_uart *uart_tr, const uint8_t *header, size_t header_len,
+		     const uint8_t *data, size_t length, uint16_t crc_val)
+{
+	static const uint8_t delimiter = HDLC_CHAR_DELIMITER;
+	uint8_t crc[CRC_SIZE];
+
+	sys_put_le16(crc_val, crc);
+
+	tx_raw(uart_tr, &delimiter, 1);
+	tx_escaped(uart_tr, header, header_len);
+	tx_escaped(uart_tr, data, length);
+	tx_escaped(uart_tr, crc, sizeof(crc));
+	tx_raw(uart_tr, &delimiter, 1);
+}
+
+#if CONFIG_NRF_RPC_UART_RELIABLE_WINDOW
+static void window_ack_rx(struct nrf_rpc_uart *uart_tr);
+#endif
 
 static void ack_rx(struct nrf_rpc_uart *uart_tr)
 {
+#if CONFIG_NRF_RPC_UART_RELIABLE_WINDOW
+	window_ack_rx(uart_tr);
+#else
 	if (!IS_ENABLED(CONFIG_NRF_RPC_UART_RELIABLE) || uart_tr->rx_ack_ctx.len != CRC_SIZE) {
 		log_hexdump_dbg(uart_tr->rx_ack, uart_tr->rx_ack_ctx.len, ">>> RX invalid frame");
 		return;
@@ -121,6 +297,7 @@ static void ack_rx(struct nrf_rpc_uart *uart_tr)
 	}
 
 	k_sem_give(&uart_tr->ack_sem);
+#endif /* CONFIG_NRF_RPC_UART_RELIABLE_WINDOW */
 }
 
 static void ack_tx(struct nrf_rpc_uart *uart_tr, uint16_t ack_pld)
@@ -131,20 +308,20 @@ static void ack_tx(struct nrf_rpc_uart *uart_tr, uint16_t ack_pld)
 		return;
 	}
 
+	static const uint8_t delimiter = HDLC_CHAR_DELIMITER;
+
 	sys_put_le16(ack_pld, ack);
 	k_mutex_lock(&uart_tr->ack_tx_lock, K_FOREVER);
 	LOG_DBG("<<< TX ack %04x", ack_pld);
 
-	uart_poll_out(uart_tr->uart, HDLC_CHAR_DELIMITER);
-
-	send_byte(uart_tr->uart, ack[0]);
-	send_byte(uart_tr->uart, ack[1]);
-
-	uart_poll_out(uart_tr->uart, HDLC_CHAR_DELIMITER);
+	tx_raw(uart_tr, &delimiter, 1);
+	tx_escaped(uart_tr, ack, sizeof(ack));
+	tx_raw(uart_tr, &delimiter, 1);
 
 	k_mutex_unlock(&uart_tr->ack_tx_lock);
 }
 
+#if !CONFIG_NRF_RPC_UART_RELIABLE_WINDOW
 static uint16_t tx_flip(struct nrf_rpc_uart *uart_tr, uint16_t crc_val)
 {
 	if (!IS_ENABLED(CONFIG_NRF_RPC_UART_RELIABLE)) {
@@ -180,16 +357,395 @@ static bool rx_flip_check(struct nrf_rpc_uart *uart_tr, uint16_t crc_val)
 
 	return true;
 }
+#endif /* !CONFIG_NRF_RPC_UART_RELIABLE_WINDOW */
 
 static bool crc_compare(uint16_t rx_crc, uint16_t calc_crc)
 {
-	if (IS_ENABLED(CONFIG_NRF_RPC_UART_RELIABLE)) {
+	if (IS_ENABLED(CONFIG_NRF_RPC_UART_RELIABLE) &&
+	    !IS_ENABLED(CONFIG_NRF_RPC_UART_RELIABLE_WINDOW)) {
 		return (rx_crc & 0x7fffu) == (calc_crc & 0x7fffu);
 	}
 
 	return rx_crc == calc_crc;
 }
 
+#if CONFIG_NRF_RPC_UART_RELIABLE_WINDOW
+
+/*
+ * Sliding window reliability with selective retransmission.
+ *
+ * Each frame starts with a header byte holding a 7-bit sequence number. Up to WINDOW_SIZE frames
+ * can be sent before the oldest one is acknowledged. The receiver acknowledges each frame within
+ * its window separately, keeps the frames that arrive after a missing one, and passes them to
+ * nRF RPC in sequence order once the missing frame is received. Only the frames that have not
+ * been acknowledged in time are retransmitted.
+ *
+ * If a frame is not acknowledged after CONFIG_NRF_RPC_UART_TX_ATTEMPTS attempts, all frames in
+ * the window are dropped, the error is reported to nRF RPC, and the next send() call fails with
+ * -EPROTO. Before the next packet, an empty frame carrying SEQ_SYNC is sent, which makes the
+ * receiver restart its window after the sequence number of that frame, and no other frame is sent
+ * until it is acknowledged. The first packet after initialization is also preceded by a SEQ_SYNC
+ * frame, so both peers can be restarted independently. The receiver restarts its window on every
+ * copy of a SEQ_SYNC frame, because the frame carries no packet and nothing is sent after it
+ * until it is acknowledged, so a SEQ_SYNC frame of a restarted peer is never mistaken for
+ * a retransmission.
+ */
+
+static inline uint8_t seq_add(uint8_t seq, uint8_t n)
+{
+	return (seq + n) & SEQ_MASK;
+}
+
+static inline uint32_t seq_bit(uint8_t seq)
+{
+	return BIT(seq % WINDOW_SIZE);
+}
+
+static void window_ack_rx(struct nrf_rpc_uart *uart_tr)
+{
+	k_spinlock_key_t key;
+	uint8_t seq;
+	uint8_t offset;
+	uint8_t in_flight;
+	bool progress = false;
+
+	if (uart_tr->rx_ack_ctx.len != CRC_SIZE ||
+	    uart_tr->rx_ack[1] != (uint8_t)~uart_tr->rx_ack[0]) {
+		log_hexdump_dbg(uart_tr->rx_ack, uart_tr->rx_ack_ctx.len, ">>> RX invalid frame");
+		return;
+	}
+
+	seq = uart_tr->rx_ack[0] & SEQ_MASK;
+
+	LOG_DBG(">>> RX ack %u", seq);
+
+	key = k_spin_lock(&uart_tr->window_lock);
+
+	in_flight = seq_add(uart_tr->tx_seq_next, SEQ_RANGE - uart_tr->tx_seq_first);
+	offset = seq_add(seq, SEQ_RANGE - uart_tr->tx_seq_first);
+
+	if (offset < in_flight) {
+		uart_tr->tx_acked |= seq_bit(seq);
+		progress = true;
+	}
+
+	k_spin_unlock(&uart_tr->window_lock, key);
+
+	if (progress) {
+		k_sem_give(&uart_tr->ack_sem);
+	} else {
+		LOG_DBG("Ack %u is not in the window", seq);
+	}
+}
+
+static void window_ack_tx(struct nrf_rpc_uart *uart_tr, uint8_t seq)
+{
+	ack_tx(uart_tr, seq | ((uint8_t)~seq << 8));
+}
+
+/* Free the acknowledged frames at the start of the window. Called with tx_lock held. */
+static void window_release(struct nrf_rpc_uart *uart_tr)
+{
+	const uint8_t *released[WINDOW_SIZE];
+	size_t count = 0;
+	k_spinlock_key_t key = k_spin_lock(&uart_tr->window_lock);
+
+	while (uart_tr->tx_seq_first != uart_tr->tx_seq_next &&
+	       (uart_tr->tx_acked & seq_bit(uart_tr->tx_seq_first))) {
+		uart_tr->tx_acked &= ~seq_bit(uart_tr->tx_seq_first);
+		released[count++] = uart_tr->tx_window[uart_tr->tx_seq_first % WINDOW_SIZE].data;
+		uart_tr->tx_seq_first = seq_add(uart_tr->tx_seq_first, 1);
+	}
+
+	k_spin_unlock(&uart_tr->window_lock, key);
+
+	for (size_t i = 0; i < count; i++) {
+		nrf_rpc_buf_free((void *)released[i]);
+	}
+}
+
+static uint8_t window_in_flight(struct nrf_rpc_uart *uart_tr)
+{
+	return seq_add(uart_tr->tx_seq_next, SEQ_RANGE - uart_tr->tx_seq_first);
+}
+
+/* Check if a new frame must wait. Called with tx_lock held. */
+static bool window_full(struct nrf_rpc_uart *uart_tr)
+{
+	uint8_t in_flight = window_in_flight(uart_tr);
+	const struct tx_frame *first = &uart_tr->tx_window[uart_tr->tx_seq_first % WINDOW_SIZE];
+
+	/* Frames sent after a SEQ_SYNC frame would be dropped if they overtook it. */
+	return in_flight == WINDOW_SIZE || (in_flight > 0 && (first->header & SEQ_SYNC));
+}
+
+static void window_frame_tx(struct nrf_rpc_uart *uart_tr, struct tx_frame *frame)
+{
+	log_hexdump_dbg(frame->data, frame->length, "<<< TX packet %u", frame->header);
+
+	k_mutex_lock(&uart_tr->ack_tx_lock, K_FOREVER);
+	frame_tx(uart_tr, &frame->header, SEQ_SIZE, frame->data, frame->length, frame->crc);
+	k_mutex_unlock(&uart_tr->ack_tx_lock);
+
+	frame->deadline = sys_timepoint_calc(K_MSEC(CONFIG_NRF_RPC_UART_ACK_WAITING_TIME));
+}
+
+static void retx_work_handler(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct nrf_rpc_uart *uart_tr = CONTAINER_OF(dwork, struct nrf_rpc_uart, retx_work);
+	k_timepoint_t next_deadline = sys_timepoint_calc(K_FOREVER);
+	struct tx_frame *frame;
+	k_spinlock_key_t key;
+	uint8_t in_flight;
+	uint8_t seq;
+	bool give_up = false;
+
+	k_mutex_lock(&uart_tr->tx_lock, K_FOREVER);
+
+	window_release(uart_tr);
+	in_flight = window_in_flight(uart_tr);
+
+	for (uint8_t i = 0; i < in_flight; i++) {
+		seq = seq_add(uart_tr->tx_seq_first, i);
+		frame = &uart_tr->tx_window[seq % WINDOW_SIZE];
+
+		if (uart_tr->tx_acked & seq_bit(seq)) {
+			continue;
+		}
+
+		if (sys_timepoint_expired(frame->deadline)) {
+			if (frame->attempts >= CONFIG_NRF_RPC_UART_TX_ATTEMPTS) {
+				give_up = true;
+				break;
+			}
+
+			LOG_WRN("Ack timeout, retransmitting frame %u", seq);
+
+			frame->attempts++;
+			window_frame_tx(uart_tr, frame);
+		}
+
+		if (sys_timepoint_cmp(frame->deadline, next_deadline) < 0) {
+			next_deadline = frame->deadline;
+		}
+	}
+
+	if (give_up) {
+		LOG_ERR("Frame %u not acknowledged, dropping %u frames", seq, in_flight);
+
+		key = k_spin_lock(&uart_tr->window_lock);
+		uart_tr->tx_acked = (uint32_t)BIT64_MASK(WINDOW_SIZE);
+		k_spin_unlock(&uart_tr->window_lock, key);
+
+		window_release(uart_tr);
+		uart_tr->tx_sync = true;
+		uart_tr->tx_err = -EPROTO;
+
+		/* Wake up a sender waiting for room in the window. */
+		k_sem_give(&uart_tr->ack_sem);
+	} else if (in_flight > 0) {
+		k_work_reschedule_for_queue(&uart_tr->retx_workq, &uart_tr->retx_work,
+					    sys_timepoint_timeout(next_deadline));
+	}
+
+	k_mutex_unlock(&uart_tr->tx_lock);
+
+	if (give_up) {
+		/* The transport does not know which packets were dropped. */
+		nrf_rpc_err(-EPROTO, NRF_RPC_ERR_SRC_SEND, NULL, NRF_RPC_ID_UNKNOWN,
+			    NRF_RPC_PACKET_TYPE_CMD);
+	}
+}
+
+/* Wait for room in the window. Called with tx_lock held. */
+static int window_wait(struct nrf_rpc_uart *uart_tr)
+{
+	int err;
+
+	window_release(uart_tr);
+
+	while (uart_tr->tx_err == 0 && window_full(uart_tr)) {
+		k_mutex_unlock(&uart_tr->tx_lock);
+		k_sem_take(&uart_tr->ack_sem, K_MSEC(CONFIG_NRF_RPC_UART_ACK_WAITING_TIME));
+		k_mutex_lock(&uart_tr->tx_lock, K_FOREVER);
+
+		window_release(uart_tr);
+	}
+
+	/* Report frames dropped after the previous send() returned. */
+	err = uart_tr->tx_err;
+	uart_tr->tx_err = 0;
+
+	return err;
+}
+
+/* Send a frame and keep it in the window. Called with tx_lock held. */
+static void window_frame_push(struct nrf_rpc_uart *uart_tr, const uint8_t *data, size_t length,
+			      uint8_t flags)
+{
+	uint8_t seq = uart_tr->tx_seq_next;
+	struct tx_frame *frame = &uart_tr->tx_window[seq % WINDOW_SIZE];
+	k_spinlock_key_t key;
+
+	frame->data = data;
+	frame->length = length;
+	frame->header = seq | flags;
+	frame->crc = crc16_ccitt(crc16_ccitt(0xffff, &frame->header, SEQ_SIZE), data, length);
+	frame->attempts = 1;
+
+	key = k_spin_lock(&uart_tr->window_lock);
+	uart_tr->tx_seq_next = seq_add(seq, 1);
+	k_spin_unlock(&uart_tr->window_lock, key);
+
+	window_frame_tx(uart_tr, frame);
+
+	/* Does nothing if the retransmission check is already scheduled. */
+	k_work_schedule_for_queue(&uart_tr->retx_workq, &uart_tr->retx_work,
+				  K_MSEC(CONFIG_NRF_RPC_UART_ACK_WAITING_TIME));
+}
+
+static int window_send(struct nrf_rpc_uart *uart_tr, const uint8_t *data, size_t length)
+{
+	int err;
+
+	k_mutex_lock(&uart_tr->tx_lock, K_FOREVER);
+
+	err = window_wait(uart_tr);
+
+	if (err == 0 && uart_tr->tx_sync) {
+		window_frame_push(uart_tr, NULL, 0, SEQ_SYNC);
+		uart_tr->tx_sync = false;
+
+		/* Wait until the receiver has restarted its window. */
+		err = window_wait(uart_tr);
+	}
+
+	if (err != 0) {
+		k_mutex_unlock(&uart_tr->tx_lock);
+		nrf_rpc_buf_free((void *)data);
+
+		return err;
+	}
+
+	window_frame_push(uart_tr, data, length, 0);
+
+	k_mutex_unlock(&uart_tr->tx_lock);
+
+	return 0;
+}
+
+/* Free the frames received after a missing one. */
+static void window_rx_reset(struct nrf_rpc_uart *uart_tr)
+{
+	for (size_t i = 0; i < WINDOW_SIZE; i++) {
+		if (uart_tr->rx_window[i].data != NULL) {
+			nrf_rpc_buf_free(uart_tr->rx_window[i].data);
+			uart_tr->rx_window[i].data = NULL;
+		}
+	}
+}
+
+/* Keep a frame received after a missing one. Returns false if there is no memory for it. */
+static bool window_rx_store(struct nrf_rpc_uart *uart_tr, uint8_t seq, const uint8_t *data,
+			    size_t length)
+{
+	struct rx_frame *frame = &uart_tr->rx_window[seq % WINDOW_SIZE];
+
+	if (frame->data != NULL) {
+		/* Retransmitted because the acknowledgment was lost. */
+		return true;
+	}
+
+	frame->data = nrf_rpc_buf_alloc(length, K_NO_WAIT);
+	if (frame->data == NULL) {
+		return false;
+	}
+
+	memcpy(frame->data, data, length);
+	frame->length = length;
+
+	return true;
+}
+
+/* Pass the frames that were kept until the missing ones were received. */
+static void window_rx_deliver(struct nrf_rpc_uart *uart_tr)
+{
+	struct rx_frame *frame = &uart_tr->rx_window[uart_tr->rx_seq_next % WINDOW_SIZE];
+	uint8_t *data;
+
+	while (frame->data != NULL) {
+		data = frame->data;
+		frame->data = NULL;
+		uart_tr->rx_seq_next = seq_add(uart_tr->rx_seq_next, 1);
+
+		uart_tr->receive_callback(uart_tr->transport, data, frame->length,
+					  uart_tr->receive_ctx);
+		nrf_rpc_buf_free(data);
+
+		frame = &uart_tr->rx_window[uart_tr->rx_seq_next % WINDOW_SIZE];
+	}
+}
+
+/* Handle a received frame with a valid CRC. */
+static void window_packet_rx(struct nrf_rpc_uart *uart_tr)
+{
+	uint8_t header = uart_tr->rx_pkt[0];
+	uint8_t seq = header & SEQ_MASK;
+	const uint8_t *data = uart_tr->rx_pkt + SEQ_SIZE;
+	size_t length = uart_tr->rx_pkt_ctx.len - SEQ_SIZE;
+	uint8_t offset;
+
+	if (header & SEQ_SYNC) {
+		LOG_DBG("Sync %u", seq);
+
+		window_rx_reset(uart_tr);
+		uart_tr->rx_synced = true;
+		uart_tr->rx_seq_next = seq_add(seq, 1);
+		window_ack_tx(uart_tr, seq);
+		return;
+	}
+
+	if (!uart_tr->rx_synced) {
+		LOG_DBG("Frame %u dropped, waiting for sync", seq);
+		return;
+	}
+
+	offset = seq_add(seq, SEQ_RANGE - uart_tr->rx_seq_next);
+
+	if (offset >= SEQ_RANGE - WINDOW_SIZE) {
+		LOG_WRN("Duplicate packet %u", seq);
+		window_ack_tx(uart_tr, seq);
+		return;
+	}
+
+	if (offset >= WINDOW_SIZE) {
+		LOG_DBG("Frame %u is not in the window, expected %u", seq, uart_tr->rx_seq_next);
+		return;
+	}
+
+	if (offset != 0) {
+		LOG_DBG("Frame %u out of order, expected %u", seq, uart_tr->rx_seq_next);
+
+		if (!window_rx_store(uart_tr, seq, data, length)) {
+			/* Not acknowledged, so the sender retransmits it. */
+			LOG_WRN("No memory for frame %u", seq);
+			return;
+		}
+
+		window_ack_tx(uart_tr, seq);
+		return;
+	}
+
+	uart_tr->rx_seq_next = seq_add(seq, 1);
+	window_ack_tx(uart_tr, seq);
+
+	uart_tr->receive_callback(uart_tr->transport, data, length, uart_tr->receive_ctx);
+	window_rx_deliver(uart_tr);
+}
+
+#endif /* CONFIG_NRF_RPC_UART_RELIABLE_WINDOW */
+
 static void hdlc_decode_byte(struct hdlc_decode_ctx *ctx, uint8_t *out, uint8_t in)
 {
 	switch (ctx->state) {
@@ -267,6 +823,9 @@ static void work_handler(struct k_work *work)
 				continue;
 			}
 
+#if CONFIG_NRF_RPC_UART_RELIABLE_WINDOW
+			window_packet_rx(uart_tr);
+#else
 			ack_tx(uart_tr, crc_received);
 
 			if (rx_flip_check(uart_tr, crc_received)) {
@@ -276,6 +835,7 @@ static void work_handler(struct k_work *work)
 							  uart_tr->rx_pkt_ctx.len,
 							  uart_tr->receive_ctx);
 			}
+#endif /* CONFIG_NRF_RPC_UART_RELIABLE_WINDOW */
 		}
 
 		ret = ring_buf_get_finish(&uart_tr->rx_ringbuf, len);
@@ -330,6 +890,12 @@ static void serial_cb(const struct device *uart, void *user_data)
 	if (new_data) {
 		k_work_submit_to_queue(&uart_tr->rx_workq, &uart_tr->rx_work);
 	}
+
+#if CONFIG_NRF_RPC_UART_TX_BUFFERED
+	if (uart_irq_tx_ready(uart)) {
+		tx_isr(uart_tr);
+	}
+#endif
 }
 
 static int init(const struct nrf_rpc_tr *transport, nrf_rpc_tr_receive_handler_t receive_cb,
@@ -380,6 +946,26 @@ static int init(const struct nrf_rpc_tr *transport, nrf_rpc_tr_receive_handler_t
 		uart_tr->flips.rx_flip_any = 1;
 	}
 
+#if CONFIG_NRF_RPC_UART_TX_BUFFERED
+	ring_buf_init(&uart_tr->tx_ringbuf, sizeof(uart_tr->tx_buffer), uart_tr->tx_buffer);
+	k_sem_init(&uart_tr->tx_space_sem, 0, 1);
+#endif
+
+#if CONFIG_NRF_RPC_UART_RELIABLE_WINDOW
+	const struct k_work_queue_config retx_workq_cfg = {.name = "rpc uart retx"};
+
+	/* Retransmissions must not wait for a sender blocked in the RX work queue. */
+	k_work_queue_init(&uart_tr->retx_workq);
+	k_work_queue_start(&uart_tr->retx_workq, uart_tr->retx_workq_stack,
+			   K_THREAD_STACK_SIZEOF(uart_tr->retx_workq_stack), K_PRIO_PREEMPT(0),
+			   &retx_workq_cfg);
+
+	k_work_init_delayable(&uart_tr->retx_work, retx_work_handler);
+	uart_tr->tx_sync = true;
+	uart_tr->tx_err = 0;
+	uart_tr->rx_synced = false;
+#endif
+
 	k_work_queue_init(&uart_tr->rx_workq);
 	k_work_queue_start(&uart_tr->rx_workq, uart_tr->rx_workq_stack,
 			   K_THREAD_STACK_SIZEOF(uart_tr->rx_workq_stack), K_PRIO_PREEMPT(0),
@@ -398,22 +984,15 @@ static int init(const struct nrf_rpc_tr *transport, nrf_rpc_tr_receive_handler_t
 	return 0;
 }
 
-static void send_byte(const struct device *dev, uint8_t byte)
-{
-	if (byte == HDLC_CHAR_DELIMITER || byte == HDLC_CHAR_ESCAPE) {
-		uart_poll_out(dev, HDLC_CHAR_ESCAPE);
-		byte ^= 0x20;
-	}
-
-	uart_poll_out(dev, byte);
-}
-
 static int send(const struct nrf_rpc_tr *transport, const uint8_t *data, size_t length)
 {
-	uint8_t crc[2];
+	struct nrf_rpc_uart *uart_tr = transport->ctx;
+
+#if CONFIG_NRF_RPC_UART_RELIABLE_WINDOW
+	return window_send(uart_tr, data, length);
+#else
 	uint16_t crc_val;
 	bool acked = true;
-	struct nrf_rpc_uart *uart_tr = transport->ctx;
 
 	k_mutex_lock(&uart_tr->tx_lock, K_FOREVER);
 
@@ -433,17 +1012,7 @@ static int send(const struct nrf_rpc_tr *transport, const uint8_t *data, size_t
 		k_sem_reset(&uart_tr->ack_sem);
 #endif /* CONFIG_NRF_RPC_UART_RELIABLE */
 
-		uart_poll_out(uart_tr->uart, HDLC_CHAR_DELIMITER);
-
-		for (size_t i = 0; i < length; i++) {
-			send_byte(uart_tr->uart, data[i]);
-		}
-
-		sys_put_le16(crc_val, crc);
-		send_byte(uart_tr->uart, crc[0]);
-		send_byte(uart_tr->uart, crc[1]);
-
-		uart_poll_out(uart_tr->uart, HDLC_CHAR_DELIMITER);
+		frame_tx(uart_tr, NULL, 0, data, length, crc_val);
 
 #if CONFIG_NRF_RPC_UART_RELIABLE
 		k_mutex_unlock(&uart_tr->ack_tx_lock);
@@ -457,37 +1026,34 @@ static int send(const struct nrf_rpc_tr *transport, const uint8_t *data, size_t
 	} while (!acked && attempts < CONFIG_NRF_RPC_UART_TX_ATTEMPTS);
 #endif /* CONFIG_NRF_RPC_UART_RELIABLE */
 
-	k_free((void *)data);
+	nrf_rpc_buf_free((void *)data);
 
 	k_mutex_unlock(&uart_tr->tx_lock);
 
 	return acked ? 0 : -EPROTO;
+#endif /* CONFIG_NRF_RPC_UART_RELIABLE_WINDOW */
 }
 
 static void *tx_buf_alloc(const struct nrf_rpc_tr *transport, size_t *size)
 {
 	void *data = NULL;
 
-	data = k_malloc(*size);
+	data = nrf_rpc_buf_alloc(*size, NRF_RPC_BUF_TX_ALLOC_TIMEOUT);
 	if (!data) {
 		LOG_ERR("Failed to allocate TX buffer");
-		goto error;
+		/* It should fail to avoid writing to NULL buffer. */
+		k_oops();
+		*size = 0;
 	}
 
 	return data;
-
-error:
-	/* It should fail to avoid writing to NULL buffer. */
-	k_oops();
-	*size = 0;
-	return NULL;
 }
 
 static void tx_buf_free(const struct nrf_rpc_tr *transport, void *buf)
 {
 	ARG_UNUSED(transport);
 
-	k_free(buf);
+	nrf_rpc_buf_free(buf);
 }
 
 __weak void nrf_rpc_uart_initialized_hook(const struct device *uart_dev)
@@ -515,3 +1081,4 @@ const struct nrf_rpc_tr_api nrf_rpc_uart_service_api = {
 	};
 
 DT_FOREACH_STATUS_OKAY(nordic_nrf_uarte, NRF_RPC_UART_TRANSPORT_DEFINE);
+DT_FOREACH_STATUS_OKAY(zephyr_uart_emul, NRF_RPC_UART_TRANSPORT_DEFINE);
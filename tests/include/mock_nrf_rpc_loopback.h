@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef MOCK_NRF_RPC_LOOPBACK_H_
+#define MOCK_NRF_RPC_LOOPBACK_H_
+
+#include <nrf_rpc.h>
+#include <nrf_rpc_tr.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup mock_nrf_rpc_loopback Loopback nRF RPC transport
+ * @brief nRF RPC transport that delivers sent packets back to the local nRF RPC core.
+ *
+ * Packets are delivered asynchronously, in the order they were sent, from a dedicated thread.
+ * This makes the image act as both the client and the server of each nRF RPC group that uses
+ * the transport.
+ *
+ * @{
+ */
+
+/** @brief Loopback nRF RPC transport object. */
+extern const struct nrf_rpc_tr mock_nrf_rpc_loopback_tr;
+
+/** @brief Loopback nRF RPC transport statistics. */
+struct mock_nrf_rpc_loopback_stats {
+	/** Number of sent packets. */
+	uint32_t packets;
+
+	/** Total length of sent packets. */
+	uint32_t bytes;
+
+	/** Number of allocated packet buffers. */
+	uint32_t allocs;
+
+	/** Total size requested for allocated packet buffers. */
+	uint32_t alloc_bytes;
+};
+
+/**
+ * @brief Gets the loopback transport statistics.
+ *
+ * @param[out] stats Statistics.
+ */
+void mock_nrf_rpc_loopback_stats_get(struct mock_nrf_rpc_loopback_stats *stats);
+
+/**
+ * @brief Resets the loopback transport statistics.
+ */
+void mock_nrf_rpc_loopback_stats_reset(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MOCK_NRF_RPC_LOOPBACK_H_ */
@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <errno.h>
+#include <data_fifo.h>
+
+#define STRESS_ELEMENTS_NUM   8
+#define STRESS_BLOCK_SIZE_MAX 64
+#define STRESS_BLOCKS_NUM     10000
+#define STRESS_STACK_SIZE     1024
+#define STRESS_THREAD_PRIO    K_PRIO_PREEMPT(5)
+
+DATA_FIFO_DEFINE(fifo_msgq_slab, STRESS_ELEMENTS_NUM, STRESS_BLOCK_SIZE_MAX);
+DATA_FIFO_SPSC_DEFINE(fifo_spsc, STRESS_ELEMENTS_NUM, STRESS_BLOCK_SIZE_MAX);
+
+K_THREAD_STACK_DEFINE(producer_stack, STRESS_STACK_SIZE);
+K_THREAD_STACK_DEFINE(consumer_stack, STRESS_STACK_SIZE);
+static struct k_thread producer_thread;
+static struct k_thread consumer_thread;
+
+static uint32_t consumer_errors;
+
+/* Vary the block size with the sequence number, so sizes are checked as well as order */
+static size_t stress_size_get(uint32_t seq)
+{
+	return sizeof(uint32_t) + (seq % (STRESS_BLOCK_SIZE_MAX - sizeof(uint32_t) + 1));
+}
+
+static void producer(void *p1, void *p2, void *p3)
+{
+	struct data_fifo *data_fifo = p1;
+	uint8_t *data;
+	int ret;
+
+	for (uint32_t seq = 0; seq < STRESS_BLOCKS_NUM; seq++) {
+		size_t size = stress_size_get(seq);
+
+		ret = data_fifo_pointer_first_vacant_get(data_fifo, (void **)&data, K_FOREVER);
+		__ASSERT_NO_MSG(ret == 0);
+
+		memcpy(data, &seq, sizeof(seq));
+		memset(&data[sizeof(seq)], (uint8_t)seq, size - sizeof(seq));
+
+		ret = data_fifo_block_lock(data_fifo, (void **)&data, size);
+		__ASSERT_NO_MSG(ret == 0);
+	}
+}
+
+static void consumer(void *p1, void *p2, void *p3)
+{
+	struct data_fifo *data_fifo = p1;
+	uint8_t *data;
+	size_t size;
+	uint32_t seq_rx;
+	int ret;
+
+	for (uint32_t seq = 0; seq < STRESS_BLOCKS_NUM; seq++) {
+		ret = data_fifo_pointer_last_filled_get(data_fifo, (void **)&data, &size,
+							K_FOREVER);
+		__ASSERT_NO_MSG(ret == 0);
+
+		memcpy(&seq_rx, data, sizeof(seq_rx));
+		if (seq_rx != seq || size != stress_size_get(seq)) {
+			consumer_errors++;
+		} else if (size > sizeof(seq) && data[size - 1] != (uint8_t)seq) {
+			consumer_errors++;
+		}
+
+		data_fifo_block_free(data_fifo, data);
+	}
+}
+
+static uint32_t stress_run(struct data_fifo *data_fifo)
+{
+	uint32_t start;
+	uint32_t cycles;
+	int ret;
+
+	consumer_errors = 0;
+
+	ret = data_fifo_init(data_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	start = k_cycle_get_32();
+
+	k_thread_create(&consumer_thread, consumer_stack, K_THREAD_STACK_SIZEOF(consumer_stack),
+			consumer, data_fifo, NULL, NULL, STRESS_THREAD_PRIO, 0, K_NO_WAIT);
+	k_thread_create(&producer_thread, producer_stack, K_THREAD_STACK_SIZEOF(producer_stack),
+			producer, data_fifo, NULL, NULL, STRESS_THREAD_PRIO, 0, K_NO_WAIT);
+
+	ret = k_thread_join(&producer_thread, K_SECONDS(60));
+	zassert_equal(ret, 0, "producer did not finish");
+	ret = k_thread_join(&consumer_thread, K_SECONDS(60));
+	zassert_equal(ret, 0, "consumer did not finish");
+
+	cycles = k_cycle_get_32() - start;
+
+	zassert_equal(consumer_errors, 0, "%d blocks out of order or corrupted", consumer_errors);
+
+#if defined(CONFIG_DATA_FIFO_STATS)
+	struct data_fifo_stats stats;
+
+	data_fifo_stats_get(data_fifo, &stats);
+	zassert_equal(stats.alloc_cnt, STRESS_BLOCKS_NUM, "alloc_cnt %d", stats.alloc_cnt);
+	zassert_equal(stats.lock_cnt, STRESS_BLOCKS_NUM, "lock_cnt %d", stats.lock_cnt);
+	zassert_equal(stats.get_cnt, STRESS_BLOCKS_NUM, "get_cnt %d", stats.get_cnt);
+	zassert_true(stats.locked_max >= 1 && stats.locked_max <= STRESS_ELEMENTS_NUM,
+		     "locked_max %d", stats.locked_max);
+#endif /* CONFIG_DATA_FIFO_STATS */
+
+	ret = data_fifo_uninit(data_fifo);
+	zassert_equal(ret, 0, "uninit did not return 0");
+
+	return cycles;
+}
+
+ZTEST(suite_data_fifo_spsc, test_spsc_stress)
+{
+	uint32_t cycles_msgq_slab = stress_run(&fifo_msgq_slab);
+	uint32_t cycles_spsc = stress_run(&fifo_spsc);
+
+	TC_PRINT("Cycles per block, msgq/slab: %u, spsc: %u\n",
+		 cycles_msgq_slab / STRESS_BLOCKS_NUM, cycles_spsc / STRESS_BLOCKS_NUM);
+}
+
+ZTEST(suite_data_fifo_spsc, test_spsc_put_get_ok)
+{
+	DATA_FIFO_SPSC_DEFINE(data_fifo, 4, 32);
+
+	int ret;
+	uint8_t *data_ptr;
+	void *data_ptr_read;
+	size_t data_size;
+	uint32_t num_alloced;
+	uint32_t num_locked;
+
+	ret = data_fifo_init(&data_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	/* Wrap the ring several times */
+	for (uint8_t i = 0; i < 10; i++) {
+		ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr,
+							 K_NO_WAIT);
+		zassert_equal(ret, 0, "first_vacant_get did not return 0");
+		data_ptr[0] = i;
+
+		ret = data_fifo_num_used_get(&data_fifo, &num_alloced, &num_locked);
+		zassert_equal(ret, 0, "data_fifo_num_used_get did not return 0");
+		zassert_equal(num_alloced, 1, "num_alloced %d", num_alloced);
+		zassert_equal(num_locked, 0, "num_locked %d", num_locked);
+
+		ret = data_fifo_block_lock(&data_fifo, (void **)&data_ptr, i + 1);
+		zassert_equal(ret, 0, "block_lock did not return 0");
+
+		ret = data_fifo_num_used_get(&data_fifo, &num_alloced, &num_locked);
+		zassert_equal(ret, 0, "data_fifo_num_used_get did not return 0");
+		zassert_equal(num_alloced, 1, "num_alloced %d", num_alloced);
+		zassert_equal(num_locked, 1, "num_locked %d", num_locked);
+
+		ret = data_fifo_pointer_last_filled_get(&data_fifo, &data_ptr_read, &data_size,
+							K_NO_WAIT);
+		zassert_equal(ret, 0, "last_filled_get did not return 0");
+		zassert_equal(data_ptr_read, data_ptr, "wrong block");
+		zassert_equal(((uint8_t *)data_ptr_read)[0], i, "data contents are not identical");
+		zassert_equal(data_size, i + 1, "data size incorrect");
+
+		data_fifo_block_free(&data_fifo, data_ptr_read);
+
+		ret = data_fifo_num_used_get(&data_fifo, &num_alloced, &num_locked);
+		zassert_equal(ret, 0, "data_fifo_num_used_get did not return 0");
+		zassert_equal(num_alloced, 0, "num_alloced %d", num_alloced);
+		zassert_equal(num_locked, 0, "num_locked %d", num_locked);
+	}
+}
+
+ZTEST(suite_data_fifo_spsc, test_spsc_full_empty)
+{
+	DATA_FIFO_SPSC_DEFINE(data_fifo, 4, 32);
+
+	int ret;
+	void *data_ptr;
+	size_t data_size;
+
+	ret = data_fifo_init(&data_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	ret = data_fifo_pointer_last_filled_get(&data_fifo, &data_ptr, &data_size, K_NO_WAIT);
+	zassert_equal(ret, -ENOMSG, "last_filled_get did not return -ENOMSG");
+
+	ret = data_fifo_pointer_last_filled_get(&data_fifo, &data_ptr, &data_size,
+						K_MSEC(10));
+	zassert_equal(ret, -EAGAIN, "last_filled_get did not return -EAGAIN");
+
+	for (uint32_t i = 0; i < 4; i++) {
+		ret = data_fifo_pointer_first_vacant_get(&data_fifo, &data_ptr, K_NO_WAIT);
+		zassert_equal(ret, 0, "first_vacant_get did not return 0");
+
+		ret = data_fifo_block_lock(&data_fifo, &data_ptr, 1);
+		zassert_equal(ret, 0, "block_lock did not return 0");
+	}
+
+	ret = data_fifo_pointer_first_vacant_get(&data_fifo, &data_ptr, K_NO_WAIT);
+	zassert_equal(ret, -ENOMEM, "first_vacant_get did not return -ENOMEM");
+
+	ret = data_fifo_pointer_first_vacant_get(&data_fifo, &data_ptr, K_MSEC(10));
+	zassert_equal(ret, -EAGAIN, "first_vacant_get did not return -EAGAIN");
+
+#if defined(CONFIG_DATA_FIFO_STATS)
+	struct data_fifo_stats stats;
+
+	data_fifo_stats_get(&data_fifo, &stats);
+	zassert_equal(stats.alloc_fail_cnt, 2, "alloc_fail_cnt %d", stats.alloc_fail_cnt);
+	zassert_equal(stats.get_fail_cnt, 2, "get_fail_cnt %d", stats.get_fail_cnt);
+	zassert_equal(stats.locked_max, 4, "locked_max %d", stats.locked_max);
+
+	data_fifo_stats_reset(&data_fifo);
+	data_fifo_stats_get(&data_fifo, &stats);
+	zassert_equal(stats.alloc_cnt, 0, "alloc_cnt %d", stats.alloc_cnt);
+#endif /* CONFIG_DATA_FIFO_STATS */
+
+	ret = data_fifo_empty(&data_fifo);
+	zassert_equal(ret, 0, "empty did not return 0");
+
+	ret = data_fifo_pointer_first_vacant_get(&data_fifo, &data_ptr, K_NO_WAIT);
+	zassert_equal(ret, 0, "first_vacant_get did not return 0");
+}
+
+ZTEST(suite_data_fifo_spsc, test_spsc_lock_out_of_order)
+{
+	DATA_FIFO_SPSC_DEFINE(data_fifo, 4, 32);
+
+	int ret;
+	void *data_ptr_1;
+	void *data_ptr_2;
+
+	ret = data_fifo_init(&data_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	ret = data_fifo_pointer_first_vacant_get(&data_fifo, &data_ptr_1, K_NO_WAIT);
+	zassert_equal(ret, 0, "first_vacant_get did not return 0");
+	ret = data_fifo_pointer_first_vacant_get(&data_fifo, &data_ptr_2, K_NO_WAIT);
+	zassert_equal(ret, 0, "first_vacant_get did not return 0");
+
+	ret = data_fifo_block_lock(&data_fifo, &data_ptr_2, 1);
+	zassert_equal(ret, -EINVAL, "block_lock did not return -EINVAL");
+
+	ret = data_fifo_block_lock(&data_fifo, &data_ptr_1, 1);
+	zassert_equal(ret, 0, "block_lock did not return 0");
+	ret = data_fifo_block_lock(&data_fifo, &data_ptr_2, 1);
+	zassert_equal(ret, 0, "block_lock did not return 0");
+}
+
+ZTEST_SUITE(suite_data_fifo_spsc, NULL, NULL, NULL, NULL, NULL);
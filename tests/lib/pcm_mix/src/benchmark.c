@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <pcm_mix.h>
+
+/* One 10 ms frame at 48 kHz */
+#define BENCHMARK_SAMPLES_PER_CH 480
+#define BENCHMARK_ITERATIONS	 100
+
+static int32_t buf_a[BENCHMARK_SAMPLES_PER_CH * 2];
+static int32_t buf_b[BENCHMARK_SAMPLES_PER_CH * 2];
+
+static void buf_fill(int32_t *buf, size_t size, uint8_t carrier_bit_depth)
+{
+	for (size_t i = 0; i < size / (carrier_bit_depth / 8); i++) {
+		if (carrier_bit_depth == 16) {
+			((int16_t *)buf)[i] = (int16_t)(i * 997);
+		} else {
+			((int32_t *)buf)[i] = (int32_t)(i * 997);
+		}
+	}
+}
+
+static void mix_benchmark(const char *name, enum pcm_mix_mode mix_mode, uint8_t pcm_bit_depth,
+			  uint8_t carrier_bit_depth)
+{
+	int ret;
+	bool b_mono = (mix_mode != B_STEREO_INTO_A_STEREO) && (mix_mode != B_MONO_INTO_A_MONO);
+	bool a_stereo = (mix_mode != B_MONO_INTO_A_MONO);
+	size_t size_a = BENCHMARK_SAMPLES_PER_CH * (a_stereo ? 2 : 1) * (carrier_bit_depth / 8);
+	size_t size_b = b_mono ? (size_a / 2) : size_a;
+	uint32_t cycles = 0;
+
+	buf_fill(buf_b, size_b, carrier_bit_depth);
+
+	for (size_t i = 0; i < BENCHMARK_ITERATIONS; i++) {
+		uint32_t start;
+
+		buf_fill(buf_a, size_a, carrier_bit_depth);
+
+		start = k_cycle_get_32();
+		ret = pcm_mix_ext(buf_a, size_a, buf_b, size_b, mix_mode, pcm_bit_depth,
+				  carrier_bit_depth);
+		cycles += k_cycle_get_32() - start;
+		zassert_equal(ret, 0, "Mix failed (%d)", ret);
+	}
+
+	TC_PRINT("%-12s %2d in %2d bit: %u cycles per 10 ms frame\n", name, pcm_bit_depth,
+		 carrier_bit_depth, cycles / BENCHMARK_ITERATIONS);
+}
+
+ZTEST(suite_pcm_mix_benchmark, test_benchmark)
+{
+	TC_PRINT("SIMD: %s\n", IS_ENABLED(CONFIG_PCM_MIX_SIMD) ? "enabled" : "disabled");
+
+	mix_benchmark("stereo", B_STEREO_INTO_A_STEREO, 16, 16);
+	mix_benchmark("mono", B_MONO_INTO_A_MONO, 16, 16);
+	mix_benchmark("mono to LR", B_MONO_INTO_A_STEREO_LR, 16, 16);
+	mix_benchmark("mono to L", B_MONO_INTO_A_STEREO_L, 16, 16);
+	mix_benchmark("mono to R", B_MONO_INTO_A_STEREO_R, 16, 16);
+
+	mix_benchmark("stereo", B_STEREO_INTO_A_STEREO, 24, 32);
+	mix_benchmark("mono to LR", B_MONO_INTO_A_STEREO_LR, 24, 32);
+	mix_benchmark("mono to L", B_MONO_INTO_A_STEREO_L, 24, 32);
+
+	mix_benchmark("stereo", B_STEREO_INTO_A_STEREO, 32, 32);
+	mix_benchmark("mono to LR", B_MONO_INTO_A_STEREO_LR, 32, 32);
+	mix_benchmark("mono to L", B_MONO_INTO_A_STEREO_L, 32, 32);
+}
+
+ZTEST_SUITE(suite_pcm_mix_benchmark, NULL, NULL, NULL, NULL, NULL);
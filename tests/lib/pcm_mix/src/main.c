@@ -127,4 +127,99 @@ ZTEST(suite_pcm_mix, test_mono_into_stereo_r)
 	verify_array_eq(sample_a, sample_r, ARRAY_SIZE(sample_r));
 }
 
+ZTEST(suite_pcm_mix, test_odd_length_high_values)
+{
+	int ret;
+	int16_t sample_a[] = { INT16_MAX, 10, INT16_MIN, -10, 100, INT16_MAX };
+	int16_t sample_b[] = { 1, -20, INT16_MIN };
+	int16_t sample_r[] = { INT16_MAX, 11, INT16_MIN, -30, INT16_MIN + 100, -1 };
+
+	ret = pcm_mix(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b),
+		      B_MONO_INTO_A_STEREO_LR);
+	ZEQ(ret, 0);
+
+	verify_array_eq(sample_a, sample_r, ARRAY_SIZE(sample_r));
+}
+
+ZTEST(suite_pcm_mix, test_mix_24_bit_high_values)
+{
+	int ret;
+	int32_t sample_a[] = { 0x7FFFFF, -0x800000, 0x7FFFF0, -0x7FFFF0, 1000 };
+	int32_t sample_b[] = { 1, -1, 0x10, -0x20, -3000 };
+	int32_t sample_r[] = { 0x7FFFFF, -0x800000, 0x7FFFFF, -0x800000, -2000 };
+
+	ret = pcm_mix_ext(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b),
+			  B_MONO_INTO_A_MONO, 24, 32);
+	ZEQ(ret, 0);
+
+	for (size_t i = 0; i < ARRAY_SIZE(sample_r); i++) {
+		ZEQ(sample_a[i], sample_r[i]);
+	}
+}
+
+ZTEST(suite_pcm_mix, test_mix_32_bit_high_values)
+{
+	int ret;
+	int32_t sample_a[] = { INT32_MAX, INT32_MIN, INT32_MAX - 5, 0x800000, 10 };
+	int32_t sample_b[] = { 1, -1, 10, 0x800000, -20 };
+	int32_t sample_r[] = { INT32_MAX, INT32_MIN, INT32_MAX, 0x1000000, -10 };
+
+	ret = pcm_mix_ext(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b),
+			  B_MONO_INTO_A_MONO, 32, 32);
+	ZEQ(ret, 0);
+
+	for (size_t i = 0; i < ARRAY_SIZE(sample_r); i++) {
+		ZEQ(sample_a[i], sample_r[i]);
+	}
+}
+
+ZTEST(suite_pcm_mix, test_mono_into_stereo_32_bit)
+{
+	int ret;
+	int32_t sample_a[] = { 10, 10, INT32_MAX, 10 };
+	int32_t sample_b[] = { -5, 5 };
+	int32_t sample_r_lr[] = { 5, 5, INT32_MAX, 15 };
+	int32_t sample_r_l[] = { 0, 5, INT32_MAX, 15 };
+	int32_t sample_r_r[] = { 0, 0, INT32_MAX, 20 };
+
+	ret = pcm_mix_ext(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b),
+			  B_MONO_INTO_A_STEREO_LR, 32, 32);
+	ZEQ(ret, 0);
+
+	for (size_t i = 0; i < ARRAY_SIZE(sample_r_lr); i++) {
+		ZEQ(sample_a[i], sample_r_lr[i]);
+	}
+
+	ret = pcm_mix_ext(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b),
+			  B_MONO_INTO_A_STEREO_L, 32, 32);
+	ZEQ(ret, 0);
+
+	for (size_t i = 0; i < ARRAY_SIZE(sample_r_l); i++) {
+		ZEQ(sample_a[i], sample_r_l[i]);
+	}
+
+	ret = pcm_mix_ext(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b),
+			  B_MONO_INTO_A_STEREO_R, 32, 32);
+	ZEQ(ret, 0);
+
+	for (size_t i = 0; i < ARRAY_SIZE(sample_r_r); i++) {
+		ZEQ(sample_a[i], sample_r_r[i]);
+	}
+}
+
+ZTEST(suite_pcm_mix, test_illegal_bit_depth)
+{
+	int ret;
+	int32_t sample_a[] = { 0, 1, 2 };
+	int32_t sample_b[] = { 0, 1, 2 };
+
+	ret = pcm_mix_ext(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b),
+			  B_MONO_INTO_A_MONO, 24, 24);
+	ZEQ(ret, -EINVAL);
+
+	ret = pcm_mix_ext(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b),
+			  B_MONO_INTO_A_MONO, 16, 32);
+	ZEQ(ret, -EINVAL);
+}
+
 ZTEST_SUITE(suite_pcm_mix, NULL, NULL, NULL, NULL, NULL);
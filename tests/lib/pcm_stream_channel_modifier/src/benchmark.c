@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <audio_defines.h>
+#include <pcm_stream_channel_modifier.h>
+
+/* One 10 ms stereo frame at 48 kHz, with 32-bit carrier */
+#define BENCHMARK_SAMPLES_PER_CH 480
+#define BENCHMARK_MONO_SIZE_MAX	 (BENCHMARK_SAMPLES_PER_CH * 4)
+#define BENCHMARK_ITERATIONS	 100
+
+/* One extra byte is allocated, so the buffers can be offset to force the byte-wise copy */
+static uint8_t mono_left[BENCHMARK_MONO_SIZE_MAX + 1] __aligned(4);
+static uint8_t mono_right[BENCHMARK_MONO_SIZE_MAX + 1] __aligned(4);
+static uint8_t stereo[BENCHMARK_MONO_SIZE_MAX * 2 + 1] __aligned(4);
+
+enum benchmark_op {
+	BENCHMARK_ZERO_PAD,
+	BENCHMARK_COPY_PAD,
+	BENCHMARK_COMBINE,
+	BENCHMARK_ONE_CHANNEL_SPLIT,
+	BENCHMARK_TWO_CHANNEL_SPLIT,
+	BENCHMARK_INTERLEAVE,
+	BENCHMARK_DEINTERLEAVE,
+};
+
+static const char *const op_names[] = {
+	[BENCHMARK_ZERO_PAD] = "zero_pad",
+	[BENCHMARK_COPY_PAD] = "copy_pad",
+	[BENCHMARK_COMBINE] = "combine",
+	[BENCHMARK_ONE_CHANNEL_SPLIT] = "one_channel_split",
+	[BENCHMARK_TWO_CHANNEL_SPLIT] = "two_channel_split",
+	[BENCHMARK_INTERLEAVE] = "interleave",
+	[BENCHMARK_DEINTERLEAVE] = "deinterleave",
+};
+
+static uint32_t op_run(enum benchmark_op op, uint8_t pcm_bit_depth, size_t offset)
+{
+	size_t mono_size = BENCHMARK_SAMPLES_PER_CH * pcm_bit_depth / 8;
+	size_t stereo_size = mono_size * 2;
+	uint8_t *left = &mono_left[offset];
+	uint8_t *right = &mono_right[offset];
+	uint8_t *lr = &stereo[offset];
+	size_t output_size;
+	uint32_t start;
+	int ret;
+
+	start = k_cycle_get_32();
+
+	switch (op) {
+	case BENCHMARK_ZERO_PAD:
+		ret = pscm_zero_pad(left, mono_size, AUDIO_CH_L, pcm_bit_depth, lr, &output_size);
+		break;
+	case BENCHMARK_COPY_PAD:
+		ret = pscm_copy_pad(left, mono_size, pcm_bit_depth, lr, &output_size);
+		break;
+	case BENCHMARK_COMBINE:
+		ret = pscm_combine(left, right, mono_size, pcm_bit_depth, lr, &output_size);
+		break;
+	case BENCHMARK_ONE_CHANNEL_SPLIT:
+		ret = pscm_one_channel_split(lr, stereo_size, AUDIO_CH_R, pcm_bit_depth, left,
+					     &output_size);
+		break;
+	case BENCHMARK_TWO_CHANNEL_SPLIT:
+		ret = pscm_two_channel_split(lr, stereo_size, pcm_bit_depth, left, right,
+					     &output_size);
+		break;
+	case BENCHMARK_INTERLEAVE:
+		ret = pscm_interleave(left, mono_size, AUDIO_CH_R, pcm_bit_depth, lr, stereo_size,
+				      2);
+		break;
+	case BENCHMARK_DEINTERLEAVE:
+		ret = pscm_deinterleave(lr, stereo_size, 2, AUDIO_CH_R, pcm_bit_depth, left,
+					mono_size);
+		break;
+	default:
+		ret = -EINVAL;
+		break;
+	}
+
+	zassert_equal(ret, 0, "%s failed (%d)", op_names[op], ret);
+
+	return k_cycle_get_32() - start;
+}
+
+ZTEST(suite_pscm_benchmark, test_benchmark)
+{
+	static const uint8_t bit_depths[] = {16, 24, 32};
+
+	for (size_t i = 0; i < ARRAY_SIZE(bit_depths); i++) {
+		for (enum benchmark_op op = BENCHMARK_ZERO_PAD; op <= BENCHMARK_DEINTERLEAVE;
+		     op++) {
+			uint32_t aligned = 0;
+			uint32_t unaligned = 0;
+
+			for (size_t j = 0; j < BENCHMARK_ITERATIONS; j++) {
+				aligned += op_run(op, bit_depths[i], 0);
+				unaligned += op_run(op, bit_depths[i], 1);
+			}
+
+			TC_PRINT("%-18s %2d bit: %6u cycles aligned, %6u cycles byte-wise per "
+				 "10 ms frame\n",
+				 op_names[op], bit_depths[i], aligned / BENCHMARK_ITERATIONS,
+				 unaligned / BENCHMARK_ITERATIONS);
+		}
+	}
+}
+
+ZTEST_SUITE(suite_pscm_benchmark, NULL, NULL, NULL, NULL, NULL);
@@ -636,6 +636,121 @@ ZTEST(suite_pscm, test_pscm_two_channel_split_32)
 	verify_array_eq(right_test_list, stereo_split_right_32, output_size);
 }
 
+#define TEST_FAST_PATH_SIZE 48
+
+/* Word-aligned buffers take the 16- and 32-bit paths, while the same data at an odd address
+ * takes the byte-wise path. Both must give the same result.
+ */
+static uint8_t fast_in_a[TEST_FAST_PATH_SIZE] __aligned(4);
+static uint8_t fast_in_b[TEST_FAST_PATH_SIZE] __aligned(4);
+static uint8_t fast_out_a[TEST_FAST_PATH_SIZE * 2] __aligned(4);
+static uint8_t fast_out_b[TEST_FAST_PATH_SIZE * 2] __aligned(4);
+static uint8_t slow_in_a[TEST_FAST_PATH_SIZE + 1];
+static uint8_t slow_in_b[TEST_FAST_PATH_SIZE + 1];
+static uint8_t slow_out_a[TEST_FAST_PATH_SIZE * 2 + 1];
+static uint8_t slow_out_b[TEST_FAST_PATH_SIZE * 2 + 1];
+
+static void fast_path_setup(void)
+{
+	for (size_t i = 0; i < TEST_FAST_PATH_SIZE; i++) {
+		fast_in_a[i] = i + 1;
+		fast_in_b[i] = i + 101;
+	}
+
+	memcpy(&slow_in_a[1], fast_in_a, TEST_FAST_PATH_SIZE);
+	memcpy(&slow_in_b[1], fast_in_b, TEST_FAST_PATH_SIZE);
+	memset(fast_out_a, 0xAA, sizeof(fast_out_a));
+	memset(fast_out_b, 0xAA, sizeof(fast_out_b));
+	memset(slow_out_a, 0xAA, sizeof(slow_out_a));
+	memset(slow_out_b, 0xAA, sizeof(slow_out_b));
+}
+
+static void fast_path_verify(size_t fast_size, size_t slow_size)
+{
+	ZEQ(fast_size, slow_size);
+	verify_array_eq(fast_out_a, &slow_out_a[1], sizeof(fast_out_a));
+	verify_array_eq(fast_out_b, &slow_out_b[1], sizeof(fast_out_b));
+}
+
+ZTEST(suite_pscm, test_pscm_fast_path)
+{
+	static const uint8_t bit_depths[] = {16, 32};
+	size_t fast_size;
+	size_t slow_size;
+	int ret;
+
+	for (size_t i = 0; i < ARRAY_SIZE(bit_depths); i++) {
+		uint8_t bits = bit_depths[i];
+
+		for (enum audio_channel ch = AUDIO_CH_L; ch <= AUDIO_CH_R; ch++) {
+			fast_path_setup();
+			ret = pscm_zero_pad(fast_in_a, TEST_FAST_PATH_SIZE, ch, bits, fast_out_a,
+					    &fast_size);
+			ZEQ(ret, 0);
+			ret = pscm_zero_pad(&slow_in_a[1], TEST_FAST_PATH_SIZE, ch, bits,
+					    &slow_out_a[1], &slow_size);
+			ZEQ(ret, 0);
+			fast_path_verify(fast_size, slow_size);
+
+			fast_path_setup();
+			ret = pscm_one_channel_split(fast_in_a, TEST_FAST_PATH_SIZE, ch, bits,
+						     fast_out_a, &fast_size);
+			ZEQ(ret, 0);
+			ret = pscm_one_channel_split(&slow_in_a[1], TEST_FAST_PATH_SIZE, ch, bits,
+						     &slow_out_a[1], &slow_size);
+			ZEQ(ret, 0);
+			fast_path_verify(fast_size, slow_size);
+		}
+
+		fast_path_setup();
+		ret = pscm_copy_pad(fast_in_a, TEST_FAST_PATH_SIZE, bits, fast_out_a, &fast_size);
+		ZEQ(ret, 0);
+		ret = pscm_copy_pad(&slow_in_a[1], TEST_FAST_PATH_SIZE, bits, &slow_out_a[1],
+				    &slow_size);
+		ZEQ(ret, 0);
+		fast_path_verify(fast_size, slow_size);
+
+		fast_path_setup();
+		ret = pscm_combine(fast_in_a, fast_in_b, TEST_FAST_PATH_SIZE, bits, fast_out_a,
+				   &fast_size);
+		ZEQ(ret, 0);
+		ret = pscm_combine(&slow_in_a[1], &slow_in_b[1], TEST_FAST_PATH_SIZE, bits,
+				   &slow_out_a[1], &slow_size);
+		ZEQ(ret, 0);
+		fast_path_verify(fast_size, slow_size);
+
+		fast_path_setup();
+		ret = pscm_two_channel_split(fast_in_a, TEST_FAST_PATH_SIZE, bits, fast_out_a,
+					     fast_out_b, &fast_size);
+		ZEQ(ret, 0);
+		ret = pscm_two_channel_split(&slow_in_a[1], TEST_FAST_PATH_SIZE, bits,
+					     &slow_out_a[1], &slow_out_b[1], &slow_size);
+		ZEQ(ret, 0);
+		fast_path_verify(fast_size, slow_size);
+
+		for (uint8_t ch = 0; ch < TEST_CHANNELS_3; ch++) {
+			fast_path_setup();
+			ret = pscm_interleave(fast_in_a, TEST_FAST_PATH_SIZE / 3, ch, bits,
+					      fast_out_a, sizeof(fast_out_a), TEST_CHANNELS_3);
+			ZEQ(ret, 0);
+			ret = pscm_interleave(&slow_in_a[1], TEST_FAST_PATH_SIZE / 3, ch, bits,
+					      &slow_out_a[1], sizeof(fast_out_a), TEST_CHANNELS_3);
+			ZEQ(ret, 0);
+			fast_path_verify(0, 0);
+
+			fast_path_setup();
+			ret = pscm_deinterleave(fast_in_a, TEST_FAST_PATH_SIZE, TEST_CHANNELS_3, ch,
+						bits, fast_out_a, sizeof(fast_out_a));
+			ZEQ(ret, 0);
+			ret = pscm_deinterleave(&slow_in_a[1], TEST_FAST_PATH_SIZE,
+						TEST_CHANNELS_3, ch, bits, &slow_out_a[1],
+						sizeof(fast_out_a));
+			ZEQ(ret, 0);
+			fast_path_verify(0, 0);
+		}
+	}
+}
+
 ZTEST_SUITE(suite_pscm, NULL, NULL, NULL, NULL, NULL);
 ZTEST_SUITE(suite_pscm_int, NULL, NULL, NULL, NULL, NULL);
 ZTEST_SUITE(suite_pscm_deint, NULL, NULL, NULL, NULL, NULL);
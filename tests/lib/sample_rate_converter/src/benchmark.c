@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/tc_util.h>
+#include <sample_rate_converter.h>
+
+#define BENCHMARK_BLOCKS_NUM 100
+
+#if defined(CONFIG_ARCH_POSIX)
+/* Simulated time does not advance while code executes on native_sim,
+ * so the benchmark reads the host clock provided by the native simulator runner.
+ */
+#define BENCH_UNIT "ns"
+
+typedef uint64_t bench_time_t;
+
+uint64_t host_clock_ns(void);
+
+static bench_time_t bench_now(void)
+{
+	return host_clock_ns();
+}
+#else
+#define BENCH_UNIT "cycles"
+
+typedef uint32_t bench_time_t;
+
+static bench_time_t bench_now(void)
+{
+	return k_cycle_get_32();
+}
+#endif /* defined(CONFIG_ARCH_POSIX) */
+
+static uint64_t bench_elapsed(bench_time_t start)
+{
+	return (bench_time_t)(bench_now() - start);
+}
+
+#if CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+typedef int16_t sample_t;
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+typedef int32_t sample_t;
+#endif
+
+static struct sample_rate_converter_ctx fir_ctx;
+static struct sample_rate_converter_frac_ctx frac_ctx;
+static struct sample_rate_converter_ctx channel_ctx[CONFIG_SAMPLE_RATE_CONVERTER_CHANNELS_MAX];
+static struct sample_rate_converter_mc_ctx mc_ctx;
+static sample_t input_samples[CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX];
+static sample_t output_samples[CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX * 3];
+static sample_t input_frames[CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX *
+			     CONFIG_SAMPLE_RATE_CONVERTER_CHANNELS_MAX];
+static sample_t output_frames[CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX *
+			      CONFIG_SAMPLE_RATE_CONVERTER_CHANNELS_MAX];
+
+static void input_generate(size_t samples_num)
+{
+	for (size_t i = 0; i < samples_num; i++) {
+		input_samples[i] = (sample_t)(i * 997);
+	}
+}
+
+static void fir_benchmark(uint32_t input_sample_rate, uint32_t output_sample_rate)
+{
+	int ret;
+	size_t samples_per_block = input_sample_rate / 100;
+	size_t output_samples_total = 0;
+	uint64_t elapsed = 0;
+
+	sample_rate_converter_open(&fir_ctx);
+	input_generate(samples_per_block);
+
+	for (size_t i = 0; i < BENCHMARK_BLOCKS_NUM; i++) {
+		size_t output_written;
+		bench_time_t start = bench_now();
+
+		ret = sample_rate_converter_process(
+			&fir_ctx, SAMPLE_RATE_FILTER_SIMPLE, input_samples,
+			samples_per_block * sizeof(sample_t), input_sample_rate, output_samples,
+			sizeof(output_samples), &output_written, output_sample_rate);
+		elapsed += bench_elapsed(start);
+		zassert_equal(ret, 0, "Process failed (%d)", ret);
+
+		output_samples_total += output_written / sizeof(sample_t);
+	}
+
+	TC_PRINT("FIR %6d -> %6d Hz: %u " BENCH_UNIT " per output sample\n", input_sample_rate,
+		 output_sample_rate, (uint32_t)(elapsed / output_samples_total));
+}
+
+static void frac_benchmark(uint32_t input_sample_rate, uint32_t output_sample_rate)
+{
+	int ret;
+	size_t samples_per_block = input_sample_rate / 100;
+	size_t output_samples_total = 0;
+	uint64_t elapsed = 0;
+
+	ret = sample_rate_converter_frac_open(&frac_ctx, input_sample_rate, output_sample_rate);
+	zassert_equal(ret, 0, "Open failed (%d)", ret);
+	input_generate(samples_per_block);
+
+	for (size_t i = 0; i < BENCHMARK_BLOCKS_NUM; i++) {
+		size_t output_written;
+		bench_time_t start = bench_now();
+
+		ret = sample_rate_converter_frac_process(
+			&frac_ctx, input_samples, samples_per_block * sizeof(sample_t),
+			output_samples, sizeof(output_samples), &output_written);
+		elapsed += bench_elapsed(start);
+		zassert_equal(ret, 0, "Process failed (%d)", ret);
+
+		output_samples_total += output_written / sizeof(sample_t);
+	}
+
+	TC_PRINT("Fractional %6d -> %6d Hz: %u " BENCH_UNIT " per output sample\n",
+		 input_sample_rate, output_sample_rate, (uint32_t)(elapsed / output_samples_total));
+}
+
+/* Convert an interleaved stream with one single-channel context per channel, including the
+ * deinterleave and interleave passes.
+ */
+static void per_channel_benchmark(uint8_t channels, uint32_t input_sample_rate,
+				  uint32_t output_sample_rate)
+{
+	int ret;
+	size_t frames_per_block = input_sample_rate / 100;
+	size_t output_frames_total = 0;
+	uint64_t elapsed = 0;
+
+	for (size_t channel = 0; channel < channels; channel++) {
+		sample_rate_converter_open(&channel_ctx[channel]);
+	}
+
+	for (size_t i = 0; i < BENCHMARK_BLOCKS_NUM; i++) {
+		size_t output_written = 0;
+		bench_time_t start = bench_now();
+
+		for (size_t channel = 0; channel < channels; channel++) {
+			for (size_t j = 0; j < frames_per_block; j++) {
+				input_samples[j] = input_frames[j * channels + channel];
+			}
+
+			ret = sample_rate_converter_process(
+				&channel_ctx[channel], SAMPLE_RATE_FILTER_SIMPLE, input_samples,
+				frames_per_block * sizeof(sample_t), input_sample_rate,
+				output_samples, sizeof(output_samples), &output_written,
+				output_sample_rate);
+			zassert_equal(ret, 0, "Process failed (%d)", ret);
+
+			for (size_t j = 0; j < output_written / sizeof(sample_t); j++) {
+				output_frames[j * channels + channel] = output_samples[j];
+			}
+		}
+		elapsed += bench_elapsed(start);
+
+		output_frames_total += output_written / sizeof(sample_t);
+	}
+
+	TC_PRINT("Per-channel %d ch %6d -> %6d Hz: %u " BENCH_UNIT " per output frame\n",
+		 channels, input_sample_rate, output_sample_rate,
+		 (uint32_t)(elapsed / output_frames_total));
+}
+
+static void mc_benchmark(uint8_t channels, uint32_t input_sample_rate,
+			 uint32_t output_sample_rate)
+{
+	int ret;
+	size_t frames_per_block = input_sample_rate / 100;
+	size_t output_frames_total = 0;
+	uint64_t elapsed = 0;
+
+	ret = sample_rate_converter_mc_open(&mc_ctx, channels);
+	zassert_equal(ret, 0, "Open failed (%d)", ret);
+
+	for (size_t i = 0; i < BENCHMARK_BLOCKS_NUM; i++) {
+		size_t output_written;
+		bench_time_t start = bench_now();
+
+		ret = sample_rate_converter_mc_process(
+			&mc_ctx, SAMPLE_RATE_FILTER_SIMPLE, input_frames,
+			frames_per_block * channels * sizeof(sample_t), input_sample_rate,
+			output_frames, sizeof(output_frames), &output_written, output_sample_rate);
+		elapsed += bench_elapsed(start);
+		zassert_equal(ret, 0, "Process failed (%d)", ret);
+
+		output_frames_total += output_written / (channels * sizeof(sample_t));
+	}
+
+	TC_PRINT("Multichannel %d ch %6d -> %6d Hz: %u " BENCH_UNIT " per output frame\n",
+		 channels, input_sample_rate, output_sample_rate,
+		 (uint32_t)(elapsed / output_frames_total));
+}
+
+ZTEST(suite_sample_rate_converter_benchmark, test_benchmark_multichannel)
+{
+	uint8_t channels = MIN(2, CONFIG_SAMPLE_RATE_CONVERTER_CHANNELS_MAX);
+
+	for (size_t i = 0; i < ARRAY_SIZE(input_frames); i++) {
+		input_frames[i] = (sample_t)(i * 997);
+	}
+
+	per_channel_benchmark(channels, 16000, 48000);
+	mc_benchmark(channels, 16000, 48000);
+	per_channel_benchmark(channels, 48000, 16000);
+	mc_benchmark(channels, 48000, 16000);
+	per_channel_benchmark(channels, 24000, 48000);
+	mc_benchmark(channels, 24000, 48000);
+	per_channel_benchmark(channels, 48000, 24000);
+	mc_benchmark(channels, 48000, 24000);
+}
+
+ZTEST(suite_sample_rate_converter_benchmark, test_benchmark)
+{
+	fir_benchmark(16000, 48000);
+	fir_benchmark(48000, 16000);
+	fir_benchmark(24000, 48000);
+	fir_benchmark(48000, 24000);
+	frac_benchmark(16000, 48000);
+	frac_benchmark(48000, 16000);
+	frac_benchmark(44100, 48000);
+	frac_benchmark(48000, 44100);
+	frac_benchmark(32000, 48000);
+	frac_benchmark(48000, 32000);
+}
+
+ZTEST_SUITE(suite_sample_rate_converter_benchmark, NULL, NULL, NULL, NULL, NULL);
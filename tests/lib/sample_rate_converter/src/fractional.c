@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/tc_util.h>
+#include <sample_rate_converter.h>
+#include <stdlib.h>
+
+#define DC_LEVEL	   10000
+#define DC_TOLERANCE	   (DC_LEVEL / 100)
+#define BLOCKS_NUM	   10
+#define SETTLE_SAMPLES_NUM CONFIG_SAMPLE_RATE_CONVERTER_FRACTIONAL_TAPS
+
+static struct sample_rate_converter_frac_ctx frac_ctx;
+
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+static int16_t input_samples[CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX];
+static int16_t output_samples[CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX * 2];
+
+/* Convert BLOCKS_NUM blocks of 10 ms with DC input and return number of output samples */
+static size_t dc_convert(uint32_t input_sample_rate, uint32_t output_sample_rate,
+			 int32_t adjust_ppb)
+{
+	int ret;
+	size_t samples_per_block = input_sample_rate / 100;
+	size_t output_samples_total = 0;
+
+	ret = sample_rate_converter_frac_open(&frac_ctx, input_sample_rate, output_sample_rate);
+	zassert_equal(ret, 0, "Open failed (%d)", ret);
+
+	ret = sample_rate_converter_frac_adjust(&frac_ctx, adjust_ppb);
+	zassert_equal(ret, 0, "Adjust failed (%d)", ret);
+
+	for (size_t i = 0; i < samples_per_block; i++) {
+		input_samples[i] = DC_LEVEL;
+	}
+
+	for (size_t block = 0; block < BLOCKS_NUM; block++) {
+		size_t output_written;
+		size_t expected_size = sample_rate_converter_frac_output_size(
+			&frac_ctx, samples_per_block * sizeof(int16_t));
+
+		ret = sample_rate_converter_frac_process(
+			&frac_ctx, input_samples, samples_per_block * sizeof(int16_t),
+			output_samples, sizeof(output_samples), &output_written);
+		zassert_equal(ret, 0, "Process failed (%d)", ret);
+		zassert_equal(output_written, expected_size, "Unexpected output size");
+
+		for (size_t i = 0; i < output_written / sizeof(int16_t); i++) {
+			if (output_samples_total + i < SETTLE_SAMPLES_NUM) {
+				continue;
+			}
+
+			zassert_within(output_samples[i], DC_LEVEL, DC_TOLERANCE,
+				       "Unexpected DC level %d", output_samples[i]);
+		}
+
+		output_samples_total += output_written / sizeof(int16_t);
+	}
+
+	return output_samples_total;
+}
+
+ZTEST(suite_sample_rate_converter_frac, test_frac_valid_44_1khz_to_48khz)
+{
+	size_t output_samples_total = dc_convert(44100, 48000, 0);
+
+	zassert_within(output_samples_total, BLOCKS_NUM * 480, 1,
+		       "Unexpected number of output samples (%d)", output_samples_total);
+}
+
+ZTEST(suite_sample_rate_converter_frac, test_frac_valid_48khz_to_44_1khz)
+{
+	size_t output_samples_total = dc_convert(48000, 44100, 0);
+
+	zassert_within(output_samples_total, BLOCKS_NUM * 441, 1,
+		       "Unexpected number of output samples (%d)", output_samples_total);
+}
+
+ZTEST(suite_sample_rate_converter_frac, test_frac_valid_32khz_to_48khz)
+{
+	size_t output_samples_total = dc_convert(32000, 48000, 0);
+
+	zassert_within(output_samples_total, BLOCKS_NUM * 480, 1,
+		       "Unexpected number of output samples (%d)", output_samples_total);
+}
+
+ZTEST(suite_sample_rate_converter_frac, test_frac_valid_48khz_to_32khz)
+{
+	size_t output_samples_total = dc_convert(48000, 32000, 0);
+
+	zassert_within(output_samples_total, BLOCKS_NUM * 320, 1,
+		       "Unexpected number of output samples (%d)", output_samples_total);
+}
+
+ZTEST(suite_sample_rate_converter_frac, test_frac_valid_adjust)
+{
+	/* 1000 ppm is about 5 samples over 100 ms at 48 kHz */
+	size_t output_samples_faster = dc_convert(44100, 48000, 1000000);
+	size_t output_samples_slower = dc_convert(44100, 48000, -1000000);
+
+	zassert_within(output_samples_faster, BLOCKS_NUM * 480 - 5, 1,
+		       "Unexpected number of output samples (%d)", output_samples_faster);
+	zassert_within(output_samples_slower, BLOCKS_NUM * 480 + 5, 1,
+		       "Unexpected number of output samples (%d)", output_samples_slower);
+}
+
+ZTEST(suite_sample_rate_converter_frac, test_frac_invalid_output_buf_too_small)
+{
+	int ret;
+	size_t output_written;
+
+	ret = sample_rate_converter_frac_open(&frac_ctx, 44100, 48000);
+	zassert_equal(ret, 0, "Open failed (%d)", ret);
+
+	ret = sample_rate_converter_frac_process(&frac_ctx, input_samples, 441 * sizeof(int16_t),
+						 output_samples, 441 * sizeof(int16_t),
+						 &output_written);
+	zassert_equal(ret, -EINVAL, "Process did not fail");
+}
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16 */
+
+ZTEST(suite_sample_rate_converter_frac, test_frac_invalid_open)
+{
+	zassert_equal(sample_rate_converter_frac_open(NULL, 44100, 48000), -EINVAL,
+		      "Open did not fail on NULL context");
+	zassert_equal(sample_rate_converter_frac_open(&frac_ctx, 0, 48000), -EINVAL,
+		      "Open did not fail on zero sample rate");
+	zassert_equal(sample_rate_converter_frac_open(&frac_ctx, 48000, 4000), -EINVAL,
+		      "Open did not fail on ratio out of range");
+}
+
+ZTEST(suite_sample_rate_converter_frac, test_frac_invalid_adjust)
+{
+	int ret;
+
+	ret = sample_rate_converter_frac_open(&frac_ctx, 44100, 48000);
+	zassert_equal(ret, 0, "Open failed (%d)", ret);
+
+	ret = sample_rate_converter_frac_adjust(&frac_ctx,
+						SAMPLE_RATE_CONVERTER_FRAC_ADJUST_PPB_MAX + 1);
+	zassert_equal(ret, -EINVAL, "Adjust did not fail");
+
+	ret = sample_rate_converter_frac_adjust(NULL, 0);
+	zassert_equal(ret, -EINVAL, "Adjust did not fail on NULL context");
+}
+
+ZTEST_SUITE(suite_sample_rate_converter_frac, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/tc_util.h>
+#include <sample_rate_converter.h>
+#include <string.h>
+
+#define CHANNELS   CONFIG_SAMPLE_RATE_CONVERTER_CHANNELS_MAX
+#define BLOCKS_NUM 5
+
+#if CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+typedef int16_t sample_t;
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+typedef int32_t sample_t;
+#endif
+
+static struct sample_rate_converter_ctx single_ctx[CHANNELS];
+static struct sample_rate_converter_mc_ctx mc_ctx;
+
+static sample_t input_frames[CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX * CHANNELS];
+static sample_t output_frames[CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX * CHANNELS];
+static sample_t input_samples[CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX];
+static sample_t output_samples[CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX];
+static sample_t expected_frames[CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX * CHANNELS];
+
+static uint32_t lcg_state;
+
+static sample_t sample_generate(void)
+{
+	lcg_state = lcg_state * 1664525 + 1013904223;
+
+	return (sample_t)lcg_state;
+}
+
+/* Convert 10 ms blocks with both the single-channel and the multichannel converter, and check
+ * that every channel of the multichannel output is bit-exact to the single-channel output.
+ */
+static void mc_compare(enum sample_rate_converter_filter filter, uint32_t input_sample_rate,
+		       uint32_t output_sample_rate)
+{
+	int ret;
+	size_t frames_per_block = input_sample_rate / 100;
+	size_t output_written;
+
+	lcg_state = input_sample_rate + output_sample_rate;
+
+	ret = sample_rate_converter_mc_open(&mc_ctx, CHANNELS);
+	zassert_equal(ret, 0, "Open failed (%d)", ret);
+
+	for (size_t channel = 0; channel < CHANNELS; channel++) {
+		sample_rate_converter_open(&single_ctx[channel]);
+	}
+
+	for (size_t block = 0; block < BLOCKS_NUM; block++) {
+		for (size_t i = 0; i < frames_per_block * CHANNELS; i++) {
+			input_frames[i] = sample_generate();
+		}
+
+		for (size_t channel = 0; channel < CHANNELS; channel++) {
+			for (size_t i = 0; i < frames_per_block; i++) {
+				input_samples[i] = input_frames[i * CHANNELS + channel];
+			}
+
+			ret = sample_rate_converter_process(
+				&single_ctx[channel], filter, input_samples,
+				frames_per_block * sizeof(sample_t), input_sample_rate,
+				output_samples, sizeof(output_samples), &output_written,
+				output_sample_rate);
+			zassert_equal(ret, 0, "Single-channel process failed (%d)", ret);
+
+			for (size_t i = 0; i < output_written / sizeof(sample_t); i++) {
+				expected_frames[i * CHANNELS + channel] = output_samples[i];
+			}
+		}
+
+		ret = sample_rate_converter_mc_process(
+			&mc_ctx, filter, input_frames, frames_per_block * CHANNELS * sizeof(sample_t),
+			input_sample_rate, output_frames, sizeof(output_frames), &output_written,
+			output_sample_rate);
+		zassert_equal(ret, 0, "Multichannel process failed (%d)", ret);
+		zassert_equal(output_written,
+			      output_sample_rate / 100 * CHANNELS * sizeof(sample_t),
+			      "Unexpected output size");
+		zassert_mem_equal(output_frames, expected_frames, output_written,
+				  "Output differs from single-channel output in block %d", block);
+	}
+}
+
+#if CONFIG_SAMPLE_RATE_CONVERTER_FILTER_TEST
+ZTEST(suite_sample_rate_converter_mc, test_mc_bit_exact_test_filter)
+{
+	mc_compare(SAMPLE_RATE_FILTER_TEST, 48000, 24000);
+	mc_compare(SAMPLE_RATE_FILTER_TEST, 48000, 16000);
+	mc_compare(SAMPLE_RATE_FILTER_TEST, 24000, 48000);
+	mc_compare(SAMPLE_RATE_FILTER_TEST, 16000, 48000);
+}
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_FILTER_TEST */
+
+#if CONFIG_SAMPLE_RATE_CONVERTER_FILTER_SIMPLE
+ZTEST(suite_sample_rate_converter_mc, test_mc_bit_exact_simple_filter)
+{
+	mc_compare(SAMPLE_RATE_FILTER_SIMPLE, 48000, 24000);
+	mc_compare(SAMPLE_RATE_FILTER_SIMPLE, 48000, 16000);
+	mc_compare(SAMPLE_RATE_FILTER_SIMPLE, 24000, 48000);
+	mc_compare(SAMPLE_RATE_FILTER_SIMPLE, 16000, 48000);
+}
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_FILTER_SIMPLE */
+
+ZTEST(suite_sample_rate_converter_mc, test_mc_invalid_open)
+{
+	zassert_equal(sample_rate_converter_mc_open(NULL, CHANNELS), -EINVAL,
+		      "Open did not fail on NULL context");
+	zassert_equal(sample_rate_converter_mc_open(&mc_ctx, 0), -EINVAL,
+		      "Open did not fail on zero channels");
+	zassert_equal(sample_rate_converter_mc_open(&mc_ctx, CHANNELS + 1), -EINVAL,
+		      "Open did not fail on too many channels");
+}
+
+ZTEST(suite_sample_rate_converter_mc, test_mc_invalid_input_size)
+{
+	int ret;
+	size_t output_written;
+
+	ret = sample_rate_converter_mc_open(&mc_ctx, CHANNELS);
+	zassert_equal(ret, 0, "Open failed (%d)", ret);
+
+	/* Input must hold whole frames */
+	ret = sample_rate_converter_mc_process(&mc_ctx, SAMPLE_RATE_FILTER_TEST, input_frames,
+					       (CHANNELS * 2 + 1) * sizeof(sample_t), 24000,
+					       output_frames, sizeof(output_frames),
+					       &output_written, 48000);
+	zassert_equal(ret, -EINVAL, "Process did not fail on partial frame");
+
+	/* Downsampling needs a multiple of the conversion ratio */
+	ret = sample_rate_converter_mc_process(&mc_ctx, SAMPLE_RATE_FILTER_TEST, input_frames,
+					       CHANNELS * 4 * sizeof(sample_t), 48000,
+					       output_frames, sizeof(output_frames),
+					       &output_written, 16000);
+	zassert_equal(ret, -EINVAL, "Process did not fail on frames not multiple of ratio");
+
+	/* Output buffer too small */
+	ret = sample_rate_converter_mc_process(&mc_ctx, SAMPLE_RATE_FILTER_TEST, input_frames,
+					       CHANNELS * 4 * sizeof(sample_t), 24000,
+					       output_frames, CHANNELS * 4 * sizeof(sample_t),
+					       &output_written, 48000);
+	zassert_equal(ret, -EINVAL, "Process did not fail on too small output buffer");
+}
+
+ZTEST_SUITE(suite_sample_rate_converter_mc, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <mock_nrf_rpc_loopback.h>
+#include <nrf_rpc/nrf_rpc_buf.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+
+#include <stddef.h>
+
+/* Packet buffer. The nRF RPC core only sees the data field. */
+struct loopback_pkt {
+	void *fifo_reserved;
+	size_t len;
+	uint8_t data[];
+};
+
+struct loopback_ctx {
+	const struct nrf_rpc_tr *transport;
+	nrf_rpc_tr_receive_handler_t receive_cb;
+	void *receive_ctx;
+};
+
+static struct loopback_ctx loopback_ctx;
+static K_FIFO_DEFINE(rx_fifo);
+static K_THREAD_STACK_DEFINE(rx_thread_stack, CONFIG_MOCK_NRF_RPC_LOOPBACK_STACK_SIZE);
+static struct k_thread rx_thread_data;
+
+static atomic_t stat_packets;
+static atomic_t stat_bytes;
+static atomic_t stat_allocs;
+static atomic_t stat_alloc_bytes;
+
+static struct loopback_pkt *pkt_from_data(const void *data)
+{
+	return (struct loopback_pkt *)((uintptr_t)data - offsetof(struct loopback_pkt, data));
+}
+
+/* nRF RPC can't handle a packet received in the context of the send call, so deliver it from
+ * a separate thread.
+ */
+static void rx_thread(void *p1, void *p2, void *p3)
+{
+	struct loopback_pkt *pkt;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		pkt = k_fifo_get(&rx_fifo, K_FOREVER);
+
+		loopback_ctx.receive_cb(loopback_ctx.transport, pkt->data, pkt->len,
+					loopback_ctx.receive_ctx);
+		nrf_rpc_buf_free(pkt);
+	}
+}
+
+static int init(const struct nrf_rpc_tr *transport, nrf_rpc_tr_receive_handler_t receive_cb,
+		void *context)
+{
+	struct loopback_ctx *ctx = transport->ctx;
+
+	if (ctx->receive_cb != NULL) {
+		/* Already initialized by another group. */
+		return 0;
+	}
+
+	ctx->transport = transport;
+	ctx->receive_cb = receive_cb;
+	ctx->receive_ctx = context;
+
+	/* The nRF RPC core waits for the group initialization packets inside nrf_rpc_init(),
+	 * which runs before the statically defined threads are started.
+	 */
+	k_thread_create(&rx_thread_data, rx_thread_stack, K_THREAD_STACK_SIZEOF(rx_thread_stack),
+			rx_thread, NULL, NULL, NULL, K_PRIO_COOP(CONFIG_NUM_COOP_PRIORITIES - 1), 0,
+			K_NO_WAIT);
+	k_thread_name_set(&rx_thread_data, "nrf_rpc_loopback");
+
+	return 0;
+}
+
+static int send(const struct nrf_rpc_tr *transport, const uint8_t *data, size_t length)
+{
+	struct loopback_pkt *pkt = pkt_from_data(data);
+
+	pkt->len = length;
+
+	atomic_inc(&stat_packets);
+	atomic_add(&stat_bytes, length);
+
+	k_fifo_put(&rx_fifo, pkt);
+
+	return 0;
+}
+
+static void *tx_buf_alloc(const struct nrf_rpc_tr *transport, size_t *size)
+{
+	struct loopback_pkt *pkt = nrf_rpc_buf_alloc(sizeof(*pkt) + *size, K_NO_WAIT);
+
+	if (pkt == NULL) {
+		*size = 0;
+		return NULL;
+	}
+
+	atomic_inc(&stat_allocs);
+	atomic_add(&stat_alloc_bytes, *size);
+
+	return pkt->data;
+}
+
+static void tx_buf_free(const struct nrf_rpc_tr *transport, void *buf)
+{
+	nrf_rpc_buf_free(pkt_from_data(buf));
+}
+
+static const struct nrf_rpc_tr_api loopback_api = {
+	.init = init,
+	.send = send,
+	.tx_buf_alloc = tx_buf_alloc,
+	.tx_buf_free = tx_buf_free,
+};
+
+const struct nrf_rpc_tr mock_nrf_rpc_loopback_tr = {
+	.api = &loopback_api,
+	.ctx = &loopback_ctx,
+};
+
+void mock_nrf_rpc_loopback_stats_get(struct mock_nrf_rpc_loopback_stats *stats)
+{
+	stats->packets = atomic_get(&stat_packets);
+	stats->bytes = atomic_get(&stat_bytes);
+	stats->allocs = atomic_get(&stat_allocs);
+	stats->alloc_bytes = atomic_get(&stat_alloc_bytes);
+}
+
+void mock_nrf_rpc_loopback_stats_reset(void)
+{
+	atomic_clear(&stat_packets);
+	atomic_clear(&stat_bytes);
+	atomic_clear(&stat_allocs);
+	atomic_clear(&stat_alloc_bytes);
+}
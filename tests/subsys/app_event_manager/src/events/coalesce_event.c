@@ -0,0 +1,21 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "coalesce_event.h"
+
+APP_EVENT_TYPE_DEFINE(coalesce_event,
+		  NULL,
+		  NULL,
+		  APP_EVENT_FLAGS_CREATE(APP_EVENT_TYPE_FLAGS_COALESCE));
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_COALESCING)
+static uint32_t coalesce_event_key(const struct app_event_header *aeh)
+{
+	return cast_coalesce_event(aeh)->key;
+}
+
+APP_EVENT_COALESCE_KEY_REGISTER(coalesce_event, coalesce_event_key);
+#endif
@@ -0,0 +1,20 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "lane_event.h"
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LANES)
+APP_EVENT_TYPE_DEFINE(lane_event,
+		  NULL,
+		  NULL,
+		  APP_EVENT_FLAGS_CREATE(),
+		  LANE_EVENT_LANE);
+#else
+APP_EVENT_TYPE_DEFINE(lane_event,
+		  NULL,
+		  NULL,
+		  APP_EVENT_FLAGS_CREATE());
+#endif
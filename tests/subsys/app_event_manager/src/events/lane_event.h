@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _LANE_EVENT_H_
+#define _LANE_EVENT_H_
+
+/**
+ * @brief Lane Event
+ * @defgroup lane_event Event processed in a dedicated dispatch lane
+ * @{
+ */
+
+#include <app_event_manager.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Lane used by the lane_event if dispatch lanes are enabled. */
+#define LANE_EVENT_LANE 1
+
+struct lane_event {
+	struct app_event_header header;
+
+	int val;
+};
+
+APP_EVENT_TYPE_DECLARE(lane_event);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* _LANE_EVENT_H_ */
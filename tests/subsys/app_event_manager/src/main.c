@@ -78,6 +78,45 @@ ZTEST(suite0, test_multicontext)
 	test_start(TEST_MULTICONTEXT);
 }
 
+ZTEST(suite0, test_stats)
+{
+	if (!IS_ENABLED(CONFIG_APP_EVENT_MANAGER_STATS)) {
+		ztest_test_skip();
+		return;
+	}
+
+	const struct event_type *et = APP_EVENT_ID(test_start_event);
+	struct app_event_manager_event_stats es_stats;
+	uint64_t listener_cycles = 0;
+	uint32_t listener_calls = 0;
+
+	app_event_manager_stats_reset();
+	app_event_manager_event_stats_get(et, &es_stats);
+	zassert_equal(es_stats.dispatch_cnt, 0, "Statistics not reset");
+
+	test_start(TEST_BASIC);
+
+	app_event_manager_event_stats_get(et, &es_stats);
+	zassert_equal(es_stats.dispatch_cnt, 1, "Dispatched event not accounted");
+	zassert_true(es_stats.queue_cycles_total >= es_stats.queue_cycles_max,
+		     "Invalid queueing delay");
+
+	for (const struct event_subscriber *es = et->subs_start; es != et->subs_stop; es++) {
+		struct app_event_manager_listener_stats el_stats;
+
+		zassert_ok(app_event_manager_listener_stats_get(et, es->listener, &el_stats));
+		zassert_true(el_stats.call_cnt <= 1, "Invalid number of listener calls");
+		zassert_true(el_stats.cycles_total >= el_stats.cycles_max,
+			     "Invalid listener time");
+		listener_calls += el_stats.call_cnt;
+		listener_cycles += el_stats.cycles_total;
+	}
+
+	zassert_true(listener_calls > 0, "Listener calls not accounted");
+	zassert_equal(listener_cycles, es_stats.handler_cycles_total,
+		      "Listener time does not sum up");
+}
+
 ZTEST(suite0, test_event_size_static)
 {
 	if (!IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PROVIDE_EVENT_SIZE)) {
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include "coalesce_event.h"
+
+#define MODULE test_coalesce
+#define EXPECTED_EVENT_CNT 2
+#define EXPECTED_REPLACED_CNT 2
+
+/* Coalescing must not renumber the flags defined by the application. */
+BUILD_ASSERT(APP_EVENT_TYPE_FLAGS_USER_DEFINED_START == 2);
+
+struct received_event {
+	uint32_t key;
+	int val;
+};
+
+static K_SEM_DEFINE(coalesce_event_sem, 0, EXPECTED_EVENT_CNT);
+static struct received_event received[EXPECTED_EVENT_CNT];
+static size_t received_cnt;
+static struct received_event replaced[EXPECTED_REPLACED_CNT];
+static atomic_t replaced_cnt;
+
+static void coalesce_event_submit(uint32_t key, int val)
+{
+	struct coalesce_event *event = new_coalesce_event();
+
+	event->key = key;
+	event->val = val;
+	APP_EVENT_SUBMIT(event);
+}
+
+ZTEST(suite0, test_coalesce)
+{
+	if (!IS_ENABLED(CONFIG_APP_EVENT_MANAGER_COALESCING)) {
+		ztest_test_skip();
+		return;
+	}
+
+	uint32_t coalesced_cnt = app_event_manager_coalesced_cnt_get(APP_EVENT_ID(coalesce_event));
+
+	received_cnt = 0;
+	atomic_clear(&replaced_cnt);
+
+	/* Prevent event processing until all of the events are submitted. */
+	k_sched_lock();
+	coalesce_event_submit(1, 1);
+	coalesce_event_submit(2, 1);
+	coalesce_event_submit(1, 2);
+	coalesce_event_submit(1, 3);
+	k_sched_unlock();
+
+	for (size_t i = 0; i < EXPECTED_EVENT_CNT; i++) {
+		zassert_ok(k_sem_take(&coalesce_event_sem, K_SECONDS(1)), "Event not processed");
+	}
+
+	zassert_equal(k_sem_take(&coalesce_event_sem, K_MSEC(100)), -EAGAIN,
+		      "Coalesced event processed");
+	zassert_equal(received[0].key, 1, "Invalid event order");
+	zassert_equal(received[0].val, 3, "Event not replaced by the latest one");
+	zassert_equal(received[1].key, 2, "Invalid event order");
+	zassert_equal(received[1].val, 1, "Invalid event data");
+	zassert_equal(app_event_manager_coalesced_cnt_get(APP_EVENT_ID(coalesce_event)),
+		      coalesced_cnt + 2, "Coalesced events not accounted");
+
+	zassert_equal(atomic_get(&replaced_cnt), EXPECTED_REPLACED_CNT,
+		      "Coalesce hook not called for every replaced event");
+	zassert_equal(replaced[0].key, 1, "Invalid replaced event");
+	zassert_equal(replaced[0].val, 1, "Invalid replaced event");
+	zassert_equal(replaced[1].key, 1, "Invalid replaced event");
+	zassert_equal(replaced[1].val, 2, "Invalid replaced event");
+}
+
+static void coalesce_hook(const struct app_event_header *aeh)
+{
+	if (is_coalesce_event(aeh)) {
+		const struct coalesce_event *event = cast_coalesce_event(aeh);
+		atomic_val_t idx = atomic_inc(&replaced_cnt);
+
+		zassert_true(idx < EXPECTED_REPLACED_CNT, "Too many replaced events");
+		replaced[idx].key = event->key;
+		replaced[idx].val = event->val;
+	}
+}
+
+APP_EVENT_HOOK_ON_COALESCE_REGISTER(coalesce_hook);
+
+static bool event_handler(const struct app_event_header *aeh)
+{
+	if (is_coalesce_event(aeh)) {
+		const struct coalesce_event *event = cast_coalesce_event(aeh);
+
+		zassert_true(received_cnt < EXPECTED_EVENT_CNT, "Too many events");
+		received[received_cnt].key = event->key;
+		received[received_cnt].val = event->val;
+		received_cnt++;
+		k_sem_give(&coalesce_event_sem);
+		return false;
+	}
+
+	zassert_true(false, "Event unhandled");
+	return false;
+}
+
+APP_EVENT_LISTENER(MODULE, event_handler);
+APP_EVENT_SUBSCRIBE(MODULE, coalesce_event);
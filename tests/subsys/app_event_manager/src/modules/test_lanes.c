@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include "lane_event.h"
+
+#define MODULE test_lanes
+
+static K_SEM_DEFINE(lane_event_sem, 0, 1);
+static k_tid_t lane_event_thread;
+
+ZTEST(suite0, test_lanes)
+{
+	if (!IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LANES)) {
+		ztest_test_skip();
+		return;
+	}
+
+	struct app_event_manager_lane_stats stats_before = {0};
+	struct app_event_manager_lane_stats stats_after = {0};
+
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LANE_STATS)) {
+		zassert_ok(app_event_manager_lane_stats_get(LANE_EVENT_LANE, &stats_before));
+		zassert_equal(app_event_manager_lane_stats_get(UINT8_MAX, &stats_after),
+			      -EINVAL, "Invalid lane accepted");
+	}
+
+	struct lane_event *event = new_lane_event();
+
+	event->val = 1;
+	APP_EVENT_SUBMIT(event);
+
+	zassert_ok(k_sem_take(&lane_event_sem, K_SECONDS(1)), "Lane event not processed");
+	zassert_not_equal(lane_event_thread, k_work_queue_thread_get(&k_sys_work_q),
+			  "Lane event processed in the system workqueue");
+
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_LANE_STATS)) {
+		zassert_ok(app_event_manager_lane_stats_get(LANE_EVENT_LANE, &stats_after));
+		zassert_equal(stats_after.dispatched_cnt, stats_before.dispatched_cnt + 1,
+			      "Dispatched event not accounted");
+		zassert_true(stats_after.max_depth >= 1, "Queue depth not accounted");
+		zassert_true(stats_after.wait_cycles_total >= stats_before.wait_cycles_total,
+			     "Invalid wait time");
+	}
+}
+
+static bool event_handler(const struct app_event_header *aeh)
+{
+	if (is_lane_event(aeh)) {
+		lane_event_thread = k_current_get();
+		k_sem_give(&lane_event_sem);
+		return false;
+	}
+
+	zassert_true(false, "Event unhandled");
+	return false;
+}
+
+APP_EVENT_LISTENER(MODULE, event_handler);
+APP_EVENT_SUBSCRIBE(MODULE, lane_event);
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <app_event_manager.h>
+
+#include "sized_events.h"
+
+#define BENCHMARK_ITERATIONS 1000
+
+static const size_t benchmark_sizes[] = {
+	sizeof(struct test_size1_event),
+	sizeof(struct test_size2_event),
+	sizeof(struct test_size3_event),
+	sizeof(struct test_size_big_event),
+	sizeof(struct test_dynamic_event) + 4,
+	sizeof(struct test_dynamic_with_data_event) + 8,
+};
+
+static uint32_t alloc_benchmark_run(void *(*alloc_fn)(size_t size),
+				    void (*free_fn)(void *addr))
+{
+	void *events[ARRAY_SIZE(benchmark_sizes)];
+	uint32_t start = k_cycle_get_32();
+
+	for (size_t i = 0; i < BENCHMARK_ITERATIONS; i++) {
+		for (size_t j = 0; j < ARRAY_SIZE(events); j++) {
+			events[j] = alloc_fn(benchmark_sizes[j]);
+			zassert_not_null(events[j], "Allocation failed");
+		}
+
+		for (size_t j = 0; j < ARRAY_SIZE(events); j++) {
+			free_fn(events[j]);
+		}
+	}
+
+	return (k_cycle_get_32() - start) / (BENCHMARK_ITERATIONS * ARRAY_SIZE(events));
+}
+
+static void *heap_alloc(size_t size)
+{
+	return k_malloc(size);
+}
+
+static void heap_free(void *addr)
+{
+	k_free(addr);
+}
+
+static uint32_t used_blocks_cnt(void)
+{
+	uint32_t used = 0;
+
+	for (size_t i = 0; i < app_event_manager_mem_pool_class_cnt(); i++) {
+		struct app_event_manager_mem_pool_class_stats stats;
+
+		zassert_ok(app_event_manager_mem_pool_class_stats_get(i, &stats));
+		zassert_true(stats.max_used >= stats.used, "Invalid high-water mark");
+		used += stats.used;
+	}
+
+	return used;
+}
+
+ZTEST(suite0, test_mem_pool)
+{
+	if (!IS_ENABLED(CONFIG_APP_EVENT_MANAGER_MEM_POOL)) {
+		ztest_test_skip();
+		return;
+	}
+
+	size_t class_cnt = app_event_manager_mem_pool_class_cnt();
+	struct app_event_manager_mem_pool_class_stats stats;
+	struct app_event_manager_mem_pool_class_stats prev_stats;
+
+	zassert_true(class_cnt > 0, "No size classes");
+	zassert_equal(app_event_manager_mem_pool_class_stats_get(class_cnt, &stats), -EINVAL,
+		      "Invalid size class index accepted");
+
+	for (size_t i = 1; i < class_cnt; i++) {
+		zassert_ok(app_event_manager_mem_pool_class_stats_get(i - 1, &prev_stats));
+		zassert_ok(app_event_manager_mem_pool_class_stats_get(i, &stats));
+		zassert_true(prev_stats.block_size < stats.block_size,
+			     "Size classes not sorted");
+	}
+
+	/* Event of a defined type must be served by the pool. */
+	uint32_t fallback_cnt = app_event_manager_mem_pool_heap_fallback_cnt();
+	uint32_t used_cnt = used_blocks_cnt();
+	struct test_size_big_event *ev_sb = new_test_size_big_event();
+
+	zassert_not_null(ev_sb, "Allocation failed");
+	zassert_equal(fallback_cnt, app_event_manager_mem_pool_heap_fallback_cnt(),
+		      "Event allocated from heap");
+	zassert_equal(used_blocks_cnt(), used_cnt + 1, "Block not accounted");
+	app_event_manager_free(ev_sb);
+	zassert_equal(used_blocks_cnt(), used_cnt, "Block not released");
+
+	/* Oversized dynamic data must fall back to the heap. */
+	struct test_dynamic_event *ev_dyn =
+		new_test_dynamic_event(CONFIG_APP_EVENT_MANAGER_MEM_POOL_DYNDATA_SIZE +
+				       sizeof(struct test_size_big_event));
+
+	zassert_not_null(ev_dyn, "Allocation failed");
+	zassert_equal(fallback_cnt + 1, app_event_manager_mem_pool_heap_fallback_cnt(),
+		      "Heap fallback not accounted");
+	app_event_manager_free(ev_dyn);
+}
+
+ZTEST(suite0, test_alloc_benchmark)
+{
+	TC_PRINT("heap: %u cycles per allocation\n",
+		 alloc_benchmark_run(heap_alloc, heap_free));
+
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_MEM_POOL)) {
+		uint32_t fallback_cnt = app_event_manager_mem_pool_heap_fallback_cnt();
+
+		TC_PRINT("mem pool: %u cycles per allocation\n",
+			 alloc_benchmark_run(app_event_manager_mem_pool_alloc,
+					     app_event_manager_mem_pool_free));
+		zassert_equal(fallback_cnt, app_event_manager_mem_pool_heap_fallback_cnt(),
+			      "Benchmark events allocated from heap");
+	}
+}
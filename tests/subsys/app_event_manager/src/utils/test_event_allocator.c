@@ -6,6 +6,7 @@
 
 #include <zephyr/ztest.h>
 #include <zephyr/kernel.h>
+#include <app_event_manager.h>
 
 #include "test_event_allocator.h"
 
@@ -19,7 +20,13 @@ void test_event_allocator_oom_expect(bool expected)
 
 void *app_event_manager_alloc(size_t size)
 {
-	void *event = k_malloc(size);
+	void *event;
+
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_MEM_POOL)) {
+		event = app_event_manager_mem_pool_alloc(size);
+	} else {
+		event = k_malloc(size);
+	}
 
 	if (unlikely(!event)) {
 		zassert_true(oom_expected, "Unexpected OOM error");
@@ -30,5 +37,9 @@ void *app_event_manager_alloc(size_t size)
 
 void app_event_manager_free(void *addr)
 {
-	k_free(addr);
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_MEM_POOL)) {
+		app_event_manager_mem_pool_free(addr);
+	} else {
+		k_free(addr);
+	}
 }
@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <stdio.h>
+#include <zephyr/ztest.h>
+#include <errno.h>
+
+#include "audio_module.h"
+#include "audio_module_template.h"
+
+/* Graph: source -> N branch modules -> sink. The source and the branches are template
+ * modules, so every audio data item is copied once per module. The sink counts the copies
+ * of each audio data item and measures the latency once the last copy has arrived.
+ */
+#define BENCH_BRANCHES_MAX	   (3)
+#define BENCH_MODULES_NUM	   (BENCH_BRANCHES_MAX + 2)
+#define BENCH_SOURCE_IDX	   (0)
+#define BENCH_SINK_IDX		   (BENCH_MODULES_NUM - 1)
+#define BENCH_MOD_THREAD_STACK_SIZE (1024)
+#define BENCH_MOD_THREAD_PRIORITY   (4)
+#define BENCH_MSG_QUEUE_SIZE	   (8)
+#define BENCH_MSG_SIZE		   (sizeof(struct audio_module_message))
+#define BENCH_MOD_DATA_SIZE	   (40)
+#define BENCH_DATA_BLOCKS_NUM	   (CONFIG_AUDIO_MODULE_DATA_BLOCKS_MAX)
+/* Number of audio data items in flight in the graph at a time */
+#define BENCH_WINDOW		   (2)
+#define BENCH_AUDIO_DATA_ITEMS_NUM (200)
+#define BENCH_TIMEOUT		   (K_SECONDS(1))
+
+BUILD_ASSERT(BENCH_DATA_BLOCKS_NUM >= BENCH_WINDOW * (BENCH_BRANCHES_MAX + 1),
+	     "Not enough data blocks for the audio data items in flight");
+BUILD_ASSERT(BENCH_MSG_QUEUE_SIZE >= BENCH_WINDOW * BENCH_BRANCHES_MAX,
+	     "Sink message queue too small for the audio data items in flight");
+
+struct bench_stamp {
+	uint32_t seq;
+	uint32_t cycles;
+};
+
+K_THREAD_STACK_ARRAY_DEFINE(bench_stack, BENCH_MODULES_NUM, BENCH_MOD_THREAD_STACK_SIZE);
+DATA_FIFO_DEFINE(bench_fifo_rx0, BENCH_MSG_QUEUE_SIZE, BENCH_MSG_SIZE);
+DATA_FIFO_DEFINE(bench_fifo_rx1, BENCH_MSG_QUEUE_SIZE, BENCH_MSG_SIZE);
+DATA_FIFO_DEFINE(bench_fifo_rx2, BENCH_MSG_QUEUE_SIZE, BENCH_MSG_SIZE);
+DATA_FIFO_DEFINE(bench_fifo_rx3, BENCH_MSG_QUEUE_SIZE, BENCH_MSG_SIZE);
+DATA_FIFO_DEFINE(bench_fifo_rx4, BENCH_MSG_QUEUE_SIZE, BENCH_MSG_SIZE);
+K_MEM_SLAB_DEFINE(bench_data_slab, BENCH_MOD_DATA_SIZE, BENCH_DATA_BLOCKS_NUM, 4);
+
+static struct data_fifo *bench_fifo_rx_array[BENCH_MODULES_NUM] = {
+	&bench_fifo_rx0, &bench_fifo_rx1, &bench_fifo_rx2, &bench_fifo_rx3, &bench_fifo_rx4};
+
+static struct audio_module_handle bench_handle[BENCH_MODULES_NUM];
+static struct audio_module_template_context bench_context[BENCH_MODULES_NUM - 1];
+
+static K_SEM_DEFINE(bench_credit, 0, BENCH_WINDOW);
+static atomic_t bench_copies[BENCH_WINDOW];
+static int bench_branches;
+static uint64_t bench_latency_sum;
+static uint32_t bench_latency_max;
+
+static int bench_sink_configuration_set(struct audio_module_handle_private *handle,
+					struct audio_module_configuration const *const configuration)
+{
+	return 0;
+}
+
+static int bench_sink_configuration_get(struct audio_module_handle_private const *const handle,
+					struct audio_module_configuration *configuration)
+{
+	return 0;
+}
+
+static int bench_sink_data_process(struct audio_module_handle_private *handle,
+				   struct audio_data const *const audio_data_in,
+				   struct audio_data *audio_data_out)
+{
+	struct bench_stamp stamp;
+	uint32_t latency;
+
+	memcpy(&stamp, audio_data_in->data, sizeof(stamp));
+
+	if (atomic_inc(&bench_copies[stamp.seq % BENCH_WINDOW]) == bench_branches - 1) {
+		latency = k_cycle_get_32() - stamp.cycles;
+
+		atomic_clear(&bench_copies[stamp.seq % BENCH_WINDOW]);
+		bench_latency_sum += latency;
+		bench_latency_max = MAX(bench_latency_max, latency);
+
+		k_sem_give(&bench_credit);
+	}
+
+	return 0;
+}
+
+static const struct audio_module_functions bench_sink_functions = {
+	.configuration_set = bench_sink_configuration_set,
+	.configuration_get = bench_sink_configuration_get,
+	.data_process = bench_sink_data_process,
+};
+
+static struct audio_module_description bench_sink_description = {
+	.name = "Benchmark sink",
+	.type = AUDIO_MODULE_TYPE_OUTPUT,
+	.functions = &bench_sink_functions,
+};
+
+static void bench_module_open(int idx, struct audio_module_description *description,
+			      struct k_mem_slab *data_slab,
+			      struct audio_module_configuration const *const configuration,
+			      struct audio_module_context *context)
+{
+	int ret;
+	char inst_name[CONFIG_AUDIO_MODULE_NAME_SIZE];
+	struct audio_module_parameters mod_parameters;
+
+	snprintf(inst_name, sizeof(inst_name), "Bench %d", idx);
+
+	mod_parameters.description = description;
+	mod_parameters.thread.stack = bench_stack[idx];
+	mod_parameters.thread.stack_size = BENCH_MOD_THREAD_STACK_SIZE;
+	mod_parameters.thread.priority = BENCH_MOD_THREAD_PRIORITY;
+	mod_parameters.thread.data_slab = data_slab;
+	mod_parameters.thread.data_size = BENCH_MOD_DATA_SIZE;
+	mod_parameters.thread.msg_rx = bench_fifo_rx_array[idx];
+	mod_parameters.thread.msg_tx = NULL;
+
+	memset(&bench_handle[idx], 0, sizeof(struct audio_module_handle));
+
+	ret = audio_module_open(&mod_parameters, configuration, inst_name, context,
+				&bench_handle[idx]);
+	zassert_equal(ret, 0, "Open function did not return successfully (0): ret %d", ret);
+}
+
+static void bench_graph_run(int branches)
+{
+	int ret;
+	int i;
+	uint32_t start;
+	uint32_t cycles;
+	uint32_t sink_context;
+	struct bench_stamp stamp[BENCH_WINDOW];
+	struct audio_data audio_data_tx = {0};
+	struct audio_module_template_configuration configuration = {
+		.sample_rate_hz = 48000, .bit_depth = 16, .module_description = "Benchmark"};
+
+	bench_branches = branches;
+	bench_latency_sum = 0;
+	bench_latency_max = 0;
+	k_sem_reset(&bench_credit);
+
+	for (i = 0; i < BENCH_WINDOW; i++) {
+		atomic_clear(&bench_copies[i]);
+		k_sem_give(&bench_credit);
+	}
+
+	for (i = 0; i <= branches; i++) {
+		bench_module_open(i, audio_module_template_description, &bench_data_slab,
+				  (struct audio_module_configuration const *const)&configuration,
+				  (struct audio_module_context *)&bench_context[i]);
+	}
+
+	bench_module_open(BENCH_SINK_IDX, &bench_sink_description, NULL,
+			  (struct audio_module_configuration const *const)&configuration,
+			  (struct audio_module_context *)&sink_context);
+
+	for (i = 1; i <= branches; i++) {
+		ret = audio_module_connect(&bench_handle[BENCH_SOURCE_IDX], &bench_handle[i],
+					   false);
+		zassert_equal(ret, 0, "Connect function did not return successfully (0): ret %d",
+			      ret);
+
+		ret = audio_module_connect(&bench_handle[i], &bench_handle[BENCH_SINK_IDX], false);
+		zassert_equal(ret, 0, "Connect function did not return successfully (0): ret %d",
+			      ret);
+	}
+
+	for (i = 0; i < BENCH_MODULES_NUM; i++) {
+		if (i > branches && i != BENCH_SINK_IDX) {
+			continue;
+		}
+
+		ret = audio_module_start(&bench_handle[i]);
+		zassert_equal(ret, 0, "Start function did not return successfully (0): ret %d",
+			      ret);
+	}
+
+	start = k_cycle_get_32();
+
+	for (uint32_t seq = 0; seq < BENCH_AUDIO_DATA_ITEMS_NUM; seq++) {
+		ret = k_sem_take(&bench_credit, BENCH_TIMEOUT);
+		zassert_equal(ret, 0, "Audio data item %d not returned from the graph", seq);
+
+		stamp[seq % BENCH_WINDOW].seq = seq;
+		stamp[seq % BENCH_WINDOW].cycles = k_cycle_get_32();
+
+		audio_data_tx.data = &stamp[seq % BENCH_WINDOW];
+		audio_data_tx.data_size = sizeof(struct bench_stamp);
+
+		ret = audio_module_data_tx(&bench_handle[BENCH_SOURCE_IDX], &audio_data_tx, NULL);
+		zassert_equal(ret, 0, "Data TX function did not return successfully (0): ret %d",
+			      ret);
+	}
+
+	for (i = 0; i < BENCH_WINDOW; i++) {
+		ret = k_sem_take(&bench_credit, BENCH_TIMEOUT);
+		zassert_equal(ret, 0, "Audio data items not returned from the graph");
+	}
+
+	cycles = k_cycle_get_32() - start;
+
+	/* The sink releases the last copy after it has been counted */
+	for (i = 0; i < 100 && k_mem_slab_num_used_get(&bench_data_slab) != 0; i++) {
+		k_msleep(1);
+	}
+
+	zassert_equal(k_mem_slab_num_used_get(&bench_data_slab), 0,
+		      "%d data blocks not released", k_mem_slab_num_used_get(&bench_data_slab));
+
+	TC_PRINT("%d branch(es): %u items/s, latency avg %u us, max %u us\n", branches,
+		 (uint32_t)((uint64_t)BENCH_AUDIO_DATA_ITEMS_NUM * sys_clock_hw_cycles_per_sec() /
+			    cycles),
+		 k_cyc_to_us_floor32(bench_latency_sum / BENCH_AUDIO_DATA_ITEMS_NUM),
+		 k_cyc_to_us_floor32(bench_latency_max));
+
+	for (i = 0; i < BENCH_MODULES_NUM; i++) {
+		if (i > branches && i != BENCH_SINK_IDX) {
+			continue;
+		}
+
+		ret = audio_module_stop(&bench_handle[i]);
+		zassert_equal(ret, 0, "Stop function did not return successfully (0): ret %d", ret);
+
+		ret = audio_module_close(&bench_handle[i]);
+		zassert_equal(ret, 0, "Close function did not return successfully (0): ret %d",
+			      ret);
+	}
+}
+
+ZTEST(suite_audio_module_benchmark, test_benchmark_fan_out)
+{
+	for (int branches = 1; branches <= BENCH_BRANCHES_MAX; branches++) {
+		bench_graph_run(branches);
+	}
+}
+
+ZTEST_SUITE(suite_audio_module_benchmark, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,636 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/* Tones of one procedure in each dataset, with the 12-bit resolution of the controller.
+ * The tones were produced by a multipath channel model, with a line-of-sight path, a few
+ * reflections at random distances and noise. The reference estimates were made by
+ * the floating-point IFFT path with 512 points.
+ */
+
+#include "datasets.h"
+
+const struct dataset datasets[] = {
+	{
+		.name = "los_1m",
+		.distance = 1.20f,
+		.ifft_f32 = { 0.869f },
+		.n_ap = 1,
+		.tones = {
+			[0] = {
+				[0] = {-492, 209, -201, 491}, [1] = {-472, 238, -163, 509},
+				[2] = {-479, 251, -124, 513}, [3] = {-446, 292, -95, 531},
+				[4] = {-424, 307, -50, 512}, [5] = {-405, 299, -10, 513},
+				[6] = {-389, 340, 34, 500}, [7] = {-359, 360, 61, 519},
+				[8] = {-347, 358, 96, 502}, [9] = {-321, 375, 125, 462},
+				[10] = {-297, 368, 151, 448}, [11] = {-277, 394, 180, 443},
+				[12] = {-246, 382, 218, 420}, [13] = {-232, 395, 233, 394},
+				[14] = {-191, 410, 266, 357}, [15] = {-181, 392, 274, 337},
+				[16] = {-152, 397, 282, 307}, [17] = {-126, 387, 286, 272},
+				[18] = {-106, 379, 302, 251}, [19] = {-75, 363, 319, 211},
+				[20] = {-80, 356, 302, 193}, [24] = {-15, 303, 284, 94},
+				[25] = {10, 298, 289, 63}, [26] = {8, 286, 271, 57},
+				[27] = {7, 255, 269, 46}, [28] = {38, 256, 246, 19},
+				[29] = {25, 217, 217, 15}, [30] = {32, 207, 215, 15},
+				[31] = {44, 195, 199, 5}, [32] = {27, 183, 200, -3},
+				[33] = {37, 159, 155, -18}, [34] = {33, 157, 147, -4},
+				[35] = {31, 135, 150, -21}, [36] = {15, 130, 131, -2},
+				[37] = {14, 119, 111, -4}, [38] = {-2, 87, 106, -1},
+				[39] = {-10, 93, 93, 13}, [40] = {-16, 88, 96, 16},
+				[41] = {-30, 87, 90, 35}, [42] = {-64, 82, 91, 30},
+				[43] = {-65, 68, 98, 38}, [44] = {-67, 79, 88, 58},
+				[45] = {-74, 93, 82, 72}, [46] = {-98, 78, 106, 80},
+				[47] = {-101, 85, 106, 78}, [48] = {-109, 88, 103, 95},
+				[49] = {-120, 89, 124, 94}, [50] = {-122, 110, 129, 112},
+				[51] = {-143, 103, 137, 107}, [52] = {-154, 128, 154, 102},
+				[53] = {-160, 134, 157, 108}, [54] = {-148, 146, 189, 110},
+				[55] = {-154, 147, 201, 102}, [56] = {-144, 184, 212, 94},
+				[57] = {-165, 185, 229, 94}, [58] = {-161, 204, 237, 73},
+				[59] = {-159, 210, 261, 49}, [60] = {-171, 235, 270, 49},
+				[61] = {-156, 234, 286, 28}, [62] = {-151, 249, 280, 24},
+				[63] = {-130, 256, 286, -4}, [64] = {-131, 264, 296, -22},
+				[65] = {-118, 287, 306, -41}, [66] = {-116, 291, 305, -69},
+				[67] = {-101, 306, 297, -73}, [68] = {-84, 306, 311, -100},
+				[69] = {-59, 314, 297, -117}, [70] = {-50, 316, 296, -139},
+				[71] = {-30, 318, 275, -153}, [72] = {-12, 315, 277, -170},
+				[73] = {-18, 314, 251, -184}, [74] = {-6, 315, 229, -211},
+			},
+		},
+	},
+	{
+		.name = "los_4m",
+		.distance = 4.30f,
+		.ifft_f32 = { 4.977f, 7.745f },
+		.n_ap = 2,
+		.tones = {
+			[0] = {
+				[0] = {188, 571, 562, -138}, [1] = {244, 520, 542, -242},
+				[2] = {320, 508, 503, -326}, [3] = {354, 481, 449, -399},
+				[4] = {403, 418, 407, -455}, [5] = {494, 366, 347, -516},
+				[6] = {510, 323, 272, -545}, [7] = {552, 245, 181, -567},
+				[8] = {584, 168, 113, -574}, [9] = {579, 110, 32, -580},
+				[10] = {593, 33, -54, -594}, [11] = {592, -27, -110, -575},
+				[12] = {560, -101, -199, -528}, [13] = {552, -128, -252, -472},
+				[14] = {495, -211, -313, -442}, [15] = {470, -250, -353, -402},
+				[16] = {415, -285, -406, -358}, [17] = {381, -302, -427, -283},
+				[18] = {338, -352, -446, -199}, [19] = {315, -346, -429, -160},
+				[20] = {257, -371, -452, -110}, [24] = {93, -399, -412, 47},
+				[25] = {104, -374, -381, 87}, [26] = {60, -393, -360, 127},
+				[27] = {27, -361, -351, 132}, [28] = {21, -373, -327, 163},
+				[29] = {-1, -371, -308, 196}, [30] = {-30, -381, -312, 194},
+				[31] = {-57, -400, -298, 230}, [32] = {-44, -379, -269, 279},
+				[33] = {-101, -380, -255, 297}, [34] = {-131, -374, -235, 317},
+				[35] = {-158, -375, -221, 351}, [36] = {-178, -365, -188, 371},
+				[37] = {-203, -386, -154, 426}, [38] = {-278, -376, -88, 446},
+				[39] = {-287, -349, -80, 457}, [40] = {-336, -321, -21, 467},
+				[41] = {-377, -310, 38, 473}, [42] = {-430, -283, 104, 500},
+				[43] = {-443, -228, 179, 477}, [44] = {-483, -163, 227, 464},
+				[45] = {-518, -134, 301, 443}, [46] = {-529, -54, 358, 391},
+				[47] = {-540, -15, 405, 342}, [48] = {-549, 65, 442, 303},
+				[49] = {-551, 124, 505, 218}, [50] = {-528, 164, 530, 158},
+				[51] = {-494, 230, 560, 64}, [52] = {-481, 306, 543, 12},
+				[53] = {-413, 348, 502, -69}, [54] = {-369, 397, 532, -143},
+				[55] = {-315, 433, 489, -222}, [56] = {-287, 453, 462, -266},
+				[57] = {-202, 478, 395, -346}, [58] = {-125, 489, 330, -368},
+				[59] = {-61, 473, 286, -418}, [60] = {-1, 499, 204, -445},
+				[61] = {48, 480, 137, -444}, [62] = {77, 424, 68, -438},
+				[63] = {144, 431, 6, -461}, [64] = {174, 357, -48, -413},
+				[65] = {220, 341, -106, -395}, [66] = {253, 296, -142, -360},
+				[67] = {234, 265, -169, -327}, [68] = {258, 219, -221, -281},
+				[69] = {255, 181, -227, -242}, [70] = {270, 149, -219, -201},
+				[71] = {233, 100, -219, -157}, [72] = {219, 88, -229, -133},
+				[73] = {222, 62, -222, -91}, [74] = {204, 30, -208, -89},
+			},
+			[1] = {
+				[0] = {202, -70, 200, 131}, [1] = {143, -123, 172, 68},
+				[2] = {86, -136, 172, 23}, [3] = {26, -140, 123, -50},
+				[4] = {-27, -101, 80, -82}, [5] = {-95, -53, -7, -125},
+				[6] = {-116, -48, -43, -126}, [7] = {-155, 41, -110, -84},
+				[8] = {-145, 102, -132, -71}, [9] = {-127, 144, -203, -23},
+				[10] = {-116, 215, -238, 68}, [11] = {-72, 276, -241, 116},
+				[12] = {-9, 343, -229, 228}, [13] = {62, 356, -203, 295},
+				[14] = {121, 347, -159, 353}, [15] = {203, 367, -109, 403},
+				[16] = {287, 331, -21, 450}, [17] = {382, 333, 75, 490},
+				[18] = {434, 261, 158, 470}, [19] = {491, 194, 274, 457},
+				[20] = {527, 91, 373, 429}, [24] = {555, -279, 598, 62},
+				[25] = {494, -379, 620, -40}, [26] = {416, -463, 623, -187},
+				[27] = {343, -500, 542, -279}, [28] = {244, -563, 501, -385},
+				[29] = {167, -576, 425, -453}, [30] = {59, -620, 301, -520},
+				[31] = {-43, -580, 210, -573}, [32] = {-162, -566, 71, -590},
+				[33] = {-220, -533, -21, -580}, [34] = {-311, -472, -123, -534},
+				[35] = {-359, -379, -181, -481}, [36] = {-394, -279, -268, -430},
+				[37] = {-414, -213, -338, -316}, [38] = {-433, -117, -366, -247},
+				[39] = {-389, -30, -378, -169}, [40] = {-373, 49, -368, -69},
+				[41] = {-332, 91, -355, 18}, [42] = {-289, 138, -300, 78},
+				[43] = {-229, 179, -262, 118}, [44] = {-158, 196, -170, 170},
+				[45] = {-69, 192, -103, 194}, [46] = {-30, 172, -54, 184},
+				[47] = {63, 129, 1, 125}, [48] = {93, 88, 75, 97},
+				[49] = {110, 18, 107, 51}, [50] = {136, -28, 130, -4},
+				[51] = {123, -100, 112, -76}, [52] = {118, -160, 108, -161},
+				[53] = {77, -229, 73, -197}, [54] = {35, -258, 11, -231},
+				[55] = {-49, -273, -47, -271}, [56] = {-100, -308, -134, -321},
+				[57] = {-181, -313, -221, -293}, [58] = {-265, -275, -306, -264},
+				[59] = {-364, -259, -369, -210}, [60] = {-408, -217, -440, -160},
+				[61] = {-462, -129, -489, -52}, [62] = {-514, -53, -522, 48},
+				[63] = {-546, 51, -518, 153}, [64] = {-558, 140, -519, 258},
+				[65] = {-508, 226, -462, 356}, [66] = {-494, 309, -413, 438},
+				[67] = {-439, 411, -296, 491}, [68] = {-368, 491, -231, 551},
+				[69] = {-297, 558, -101, 619}, [70] = {-178, 602, 0, 620},
+				[71] = {-92, 595, 128, 607}, [72] = {8, 610, 227, 585},
+				[73] = {101, 598, 310, 501}, [74] = {208, 575, 409, 440},
+			},
+		},
+	},
+	{
+		.name = "office_8m",
+		.distance = 8.10f,
+		.ifft_f32 = { 7.657f, 8.629f, 8.783f, 7.612f },
+		.n_ap = 4,
+		.tones = {
+			[0] = {
+				[0] = {-133, -180, -213, 30}, [1] = {-159, -135, -245, 73},
+				[2] = {-187, -132, -191, 114}, [3] = {-190, -87, -153, 135},
+				[4] = {-193, -57, -134, 157}, [5] = {-246, -4, -91, 189},
+				[6] = {-213, 42, -47, 189}, [7] = {-183, 86, -17, 200},
+				[8] = {-178, 97, 35, 191}, [9] = {-150, 117, 68, 189},
+				[10] = {-104, 150, 113, 151}, [11] = {-80, 204, 101, 132},
+				[12] = {-41, 165, 144, 140}, [13] = {-22, 153, 185, 98},
+				[14] = {20, 170, 173, 37}, [15] = {13, 147, 170, 10},
+				[16] = {21, 166, 161, -15}, [17] = {71, 104, 152, -46},
+				[18] = {54, 110, 129, -48}, [19] = {86, 100, 136, -69},
+				[20] = {100, 127, 101, -88}, [24] = {153, 66, 82, -141},
+				[25] = {187, -6, 34, -177}, [26] = {172, -11, -8, -172},
+				[27] = {165, -45, -17, -170}, [28] = {168, -99, -93, -213},
+				[29] = {191, -110, -87, -187}, [30] = {143, -173, -158, -127},
+				[31] = {99, -168, -200, -110}, [32] = {73, -206, -235, -64},
+				[33] = {41, -239, -262, -5}, [34] = {-9, -229, -235, 42},
+				[35] = {-60, -262, -228, 120}, [36] = {-151, -203, -230, 150},
+				[37] = {-162, -195, -159, 173}, [38] = {-235, -159, -99, 244},
+				[39] = {-224, -98, -26, 225}, [40] = {-234, -38, -13, 259},
+				[41] = {-278, 20, 97, 231}, [42] = {-239, 80, 141, 189},
+				[43] = {-183, 129, 184, 138}, [44] = {-134, 176, 222, 89},
+				[45] = {-68, 195, 213, 15}, [46] = {-33, 194, 176, -58},
+				[47] = {10, 179, 136, -111}, [48] = {62, 121, 117, -114},
+				[49] = {101, 94, 65, -143}, [50] = {99, 74, 3, -112},
+				[51] = {86, -20, -36, -83}, [52] = {118, -14, -86, -62},
+				[53] = {45, -63, -85, -28}, [54] = {12, -50, -69, -4},
+				[55] = {-21, -57, -29, 64}, [56] = {-38, -36, 14, 95},
+				[57] = {-79, -35, 36, 117}, [58] = {-87, 32, 91, 72},
+				[59] = {-106, 93, 124, 33}, [60] = {-85, 122, 138, 13},
+				[61] = {-58, 134, 158, -40}, [62] = {18, 177, 147, -107},
+				[63] = {72, 206, 141, -175}, [64] = {112, 203, 66, -201},
+				[65] = {158, 143, 6, -243}, [66] = {216, 137, -21, -239},
+				[67] = {245, 54, -122, -215}, [68] = {254, 27, -197, -183},
+				[69] = {242, -55, -263, -138}, [70] = {237, -125, -227, -65},
+				[71] = {190, -178, -244, -12}, [72] = {141, -190, -262, 49},
+				[73] = {71, -214, -218, 110}, [74] = {60, -251, -163, 165},
+			},
+			[1] = {
+				[0] = {-227, -213, 318, 62}, [1] = {-204, -167, 317, 2},
+				[2] = {-254, -130, 281, -54}, [3] = {-296, -68, 272, -106},
+				[4] = {-263, -43, 225, -180}, [5] = {-279, 10, 207, -227},
+				[6] = {-247, 62, 143, -200}, [7] = {-230, 111, 85, -218},
+				[8] = {-171, 158, 37, -248}, [9] = {-197, 149, 5, -242},
+				[10] = {-135, 191, -23, -230}, [11] = {-145, 197, -75, -231},
+				[12] = {-63, 248, -114, -190}, [13] = {-71, 235, -160, -192},
+				[14] = {-8, 244, -223, -141}, [15] = {24, 234, -209, -128},
+				[16] = {50, 265, -230, -66}, [17] = {81, 248, -262, -47},
+				[18] = {158, 230, -294, 7}, [19] = {191, 195, -263, 50},
+				[20] = {252, 150, -219, 118}, [24] = {257, -61, -65, 239},
+				[25] = {272, -115, -17, 277}, [26] = {229, -162, 57, 253},
+				[27] = {188, -190, 100, 242}, [28] = {154, -214, 183, 231},
+				[29] = {88, -248, 211, 148}, [30] = {52, -273, 233, 97},
+				[31] = {-20, -228, 239, 62}, [32] = {-65, -206, 209, 9},
+				[33] = {-76, -183, 222, -46}, [34] = {-119, -192, 227, -66},
+				[35] = {-146, -119, 151, -128}, [36] = {-126, -92, 140, -113},
+				[37] = {-137, -80, 71, -123}, [38] = {-108, -35, 49, -141},
+				[39] = {-146, -27, 43, -139}, [40] = {-142, -13, 48, -129},
+				[41] = {-111, 10, 31, -140}, [42] = {-135, 6, 3, -138},
+				[43] = {-124, -24, 11, -121}, [44] = {-107, 28, -15, -119},
+				[45] = {-151, 37, -13, -109}, [46] = {-138, 45, -38, -143},
+				[47] = {-143, 59, -91, -139}, [48] = {-136, 115, -96, -126},
+				[49] = {-154, 137, -171, -142}, [50] = {-150, 179, -174, -108},
+				[51] = {-91, 209, -202, -73}, [52] = {-46, 228, -226, -37},
+				[53] = {6, 208, -223, -14}, [54] = {33, 221, -244, 81},
+				[55] = {108, 237, -216, 151}, [56] = {148, 217, -139, 175},
+				[57] = {190, 169, -143, 247}, [58] = {241, 109, -67, 263},
+				[59] = {242, 70, -18, 262}, [60] = {294, 10, 50, 246},
+				[61] = {288, -43, 120, 222}, [62] = {245, -114, 152, 195},
+				[63] = {194, -150, 228, 129}, [64] = {153, -185, 204, 77},
+				[65] = {92, -200, 241, 47}, [66] = {69, -201, 236, -36},
+				[67] = {-13, -214, 183, -87}, [68] = {-53, -188, 135, -107},
+				[69] = {-82, -160, 100, -150}, [70] = {-109, -100, 43, -137},
+				[71] = {-131, -75, -2, -134}, [72] = {-113, -54, -31, -128},
+				[73] = {-89, -8, -75, -108}, [74] = {-86, 15, -50, -44},
+			},
+			[2] = {
+				[0] = {-209, -8, 188, -28}, [1] = {-192, 39, 157, -130},
+				[2] = {-131, 112, 74, -180}, [3] = {-67, 164, -47, -163},
+				[4] = {44, 151, -112, -155}, [5] = {109, 180, -180, -62},
+				[6] = {218, 105, -233, 2}, [7] = {217, 0, -219, 100},
+				[8] = {253, -95, -179, 183}, [9] = {221, -191, -117, 281},
+				[10] = {181, -274, 17, 337}, [11] = {70, -337, 143, 306},
+				[12] = {-32, -401, 278, 279}, [13] = {-133, -328, 339, 194},
+				[14] = {-261, -292, 398, 54}, [15] = {-350, -207, 432, -74},
+				[16] = {-409, -121, 378, -185}, [17] = {-394, 34, 286, -280},
+				[18] = {-389, 139, 182, -397}, [19] = {-335, 265, 78, -443},
+				[20] = {-266, 308, -47, -414}, [24] = {136, 267, -317, -26},
+				[25] = {243, 170, -270, 8}, [26] = {245, 120, -200, 103},
+				[27] = {228, 34, -133, 147}, [28] = {137, -53, -36, 167},
+				[29] = {107, -57, 26, 136}, [30] = {51, -90, 39, 35},
+				[31] = {-24, -43, 52, -41}, [32] = {-65, -13, 45, -51},
+				[33] = {-41, 73, -12, -110}, [34] = {-48, 123, -80, -111},
+				[35] = {-2, 167, -158, -70}, [36] = {118, 214, -227, -32},
+				[37] = {129, 176, -263, 86}, [38] = {246, 196, -242, 128},
+				[39] = {337, 117, -256, 251}, [40] = {394, 52, -157, 353},
+				[41] = {394, -85, -49, 408}, [42] = {377, -239, 93, 443},
+				[43] = {361, -329, 207, 422}, [44] = {262, -382, 348, 353},
+				[45] = {127, -473, 412, 266}, [46] = {-6, -510, 486, 154},
+				[47] = {-93, -479, 489, -32}, [48] = {-248, -421, 462, -144},
+				[49] = {-341, -371, 409, -233}, [50] = {-372, -262, 337, -342},
+				[51] = {-469, -150, 191, -415}, [52] = {-455, -44, 119, -442},
+				[53] = {-450, 47, -25, -432}, [54] = {-382, 141, -131, -369},
+				[55] = {-331, 232, -171, -338}, [56] = {-234, 295, -248, -262},
+				[57] = {-165, 315, -300, -195}, [58] = {-118, 283, -296, -107},
+				[59] = {-42, 281, -302, -51}, [60] = {15, 259, -265, 52},
+				[61] = {46, 259, -201, 12}, [62] = {59, 208, -204, 95},
+				[63] = {99, 216, -191, 82}, [64] = {52, 191, -173, 65},
+				[65] = {77, 149, -194, 131}, [66] = {75, 177, -169, 118},
+				[67] = {124, 163, -149, 140}, [68] = {143, 156, -122, 174},
+				[69] = {179, 154, -128, 228}, [70] = {235, 132, -64, 213},
+				[71] = {261, 97, -38, 229}, [72] = {282, 22, 10, 250},
+				[73] = {300, -9, 76, 253}, [74] = {291, -30, 118, 284},
+			},
+			[3] = {
+				[0] = {-108, -70, 89, -90}, [1] = {-96, -73, 70, -69},
+				[2] = {-74, -59, 159, -78}, [3] = {-71, -96, 67, -51},
+				[4] = {-114, -69, 91, -104}, [5] = {-110, -73, 62, -154},
+				[6] = {-157, -72, 82, -123}, [7] = {-176, -83, 72, -205},
+				[8] = {-208, -44, 10, -199}, [9] = {-224, -11, -18, -211},
+				[10] = {-216, 52, -76, -189}, [11] = {-213, 119, -120, -206},
+				[12] = {-188, 138, -208, -147}, [13] = {-160, 202, -230, -136},
+				[14] = {-129, 238, -212, -101}, [15] = {-31, 232, -245, -51},
+				[16] = {15, 233, -240, 40}, [17] = {35, 213, -190, 82},
+				[18] = {33, 191, -182, 105}, [19] = {108, 182, -166, 124},
+				[20] = {139, 166, -153, 136}, [24] = {162, 53, -60, 203},
+				[25] = {161, 112, -25, 184}, [26] = {206, 94, -47, 209},
+				[27] = {205, 68, 8, 228}, [28] = {271, 12, 65, 233},
+				[29] = {274, -45, 120, 242}, [30] = {291, -110, 185, 183},
+				[31] = {293, -135, 255, 171}, [32] = {255, -197, 346, 78},
+				[33] = {173, -309, 297, 36}, [34] = {125, -316, 339, -66},
+				[35] = {57, -370, 305, -155}, [36] = {-25, -352, 252, -217},
+				[37] = {-110, -319, 185, -275}, [38] = {-170, -271, 102, -318},
+				[39] = {-254, -207, 51, -338}, [40] = {-277, -171, -24, -305},
+				[41] = {-296, -85, -134, -301}, [42] = {-235, -13, -175, -216},
+				[43] = {-242, 43, -159, -147}, [44] = {-200, 104, -222, -108},
+				[45] = {-171, 113, -214, -61}, [46] = {-112, 96, -166, -18},
+				[47] = {-71, 155, -124, -3}, [48] = {-103, 132, -136, -6},
+				[49] = {-62, 129, -95, 48}, [50] = {-58, 120, -93, 42},
+				[51] = {-45, 79, -104, 49}, [52] = {-23, 85, -116, 50},
+				[53] = {-45, 126, -123, 98}, [54] = {-19, 129, -82, 111},
+				[55] = {-24, 109, -58, 70}, [56] = {29, 101, -52, 135},
+				[57] = {12, 126, -46, 99}, [58] = {65, 144, 11, 155},
+				[59] = {67, 152, 9, 125}, [60] = {73, 104, 72, 151},
+				[61] = {111, 62, 54, 53}, [62] = {103, -5, 78, 66},
+				[63] = {97, 15, 19, 49}, [64] = {97, 18, 82, 67},
+				[65] = {28, 19, -3, 53}, [66] = {49, 38, 78, 36},
+				[67] = {43, 47, 42, 50}, [68] = {79, 69, 33, 75},
+				[69] = {102, 70, 17, 96}, [70] = {123, 104, 89, 130},
+				[71] = {139, 74, 123, 96}, [72] = {197, 44, 176, 92},
+				[73] = {250, 6, 250, 70}, [74] = {285, -48, 316, 22},
+			},
+		},
+	},
+	{
+		.name = "weak_los_11m",
+		.distance = 11.60f,
+		.ifft_f32 = { 11.711f, 11.593f },
+		.n_ap = 2,
+		.tones = {
+			[0] = {
+				[0] = {15, -128, -8, -147}, [1] = {-58, -111, -65, -117},
+				[2] = {-81, -66, -47, -104}, [3] = {-115, -16, -134, -41},
+				[4] = {-98, 9, -114, 23}, [5] = {-96, 50, -113, 84},
+				[6] = {-55, 123, -52, 87}, [7] = {-7, 133, 21, 141},
+				[8] = {66, 107, 70, 131}, [9] = {132, 143, 122, 141},
+				[10] = {209, 29, 187, 37}, [11] = {204, -10, 209, -66},
+				[12] = {205, -69, 228, -135}, [13] = {184, -220, 174, -245},
+				[14] = {103, -297, 57, -317}, [15] = {3, -309, -12, -281},
+				[16] = {-110, -317, -203, -296}, [17] = {-241, -271, -290, -253},
+				[18] = {-369, -189, -369, -112}, [19] = {-395, -77, -400, 9},
+				[20] = {-391, 52, -433, 169}, [24] = {-85, 494, 100, 483},
+				[25] = {108, 503, 270, 442}, [26] = {234, 479, 423, 329},
+				[27] = {403, 342, 538, 190}, [28] = {505, 198, 527, 11},
+				[29] = {531, 48, 529, -216}, [30] = {553, -123, 418, -347},
+				[31] = {473, -263, 331, -447}, [32] = {375, -406, 104, -547},
+				[33] = {255, -492, -68, -533}, [34] = {57, -501, -203, -518},
+				[35] = {-112, -522, -372, -423}, [36] = {-246, -442, -467, -257},
+				[37] = {-387, -365, -491, -91}, [38] = {-438, -244, -510, 85},
+				[39] = {-459, -55, -409, 243}, [40] = {-447, 56, -319, 322},
+				[41] = {-393, 181, -231, 402}, [42] = {-309, 278, -63, 430},
+				[43] = {-235, 326, 17, 403}, [44] = {-100, 362, 144, 358},
+				[45] = {-22, 348, 212, 282}, [46] = {97, 326, 277, 188},
+				[47] = {115, 289, 274, 97}, [48] = {208, 206, 279, 11},
+				[49] = {226, 133, 282, -40}, [50] = {228, 126, 199, -82},
+				[51] = {229, 49, 200, -108}, [52] = {220, 35, 159, -169},
+				[53] = {215, 20, 95, -177}, [54] = {216, -49, 81, -183},
+				[55] = {189, -62, 56, -189}, [56] = {191, -131, 48, -211},
+				[57] = {182, -149, -11, -229}, [58] = {144, -205, -82, -231},
+				[59] = {117, -231, -160, -216}, [60] = {21, -288, -222, -180},
+				[61] = {-13, -283, -258, -123}, [62] = {-99, -299, -299, -21},
+				[63] = {-159, -256, -300, 81}, [64] = {-236, -223, -314, 128},
+				[65] = {-299, -168, -268, 236}, [66] = {-381, -63, -216, 285},
+				[67] = {-368, 15, -113, 346}, [68] = {-386, 79, -21, 368},
+				[69] = {-303, 231, 83, 379}, [70] = {-257, 319, 189, 329},
+				[71] = {-147, 359, 326, 219}, [72] = {-52, 384, 375, 173},
+				[73] = {59, 333, 407, 28}, [74] = {174, 363, 377, -95},
+			},
+			[1] = {
+				[0] = {246, 290, -193, -367}, [1] = {341, 252, -299, -258},
+				[2] = {436, 87, -403, -177}, [3] = {466, -41, -471, -30},
+				[4] = {474, -194, -439, 158}, [5] = {385, -321, -394, 328},
+				[6] = {270, -441, -297, 423}, [7] = {146, -478, -125, 486},
+				[8] = {-36, -536, 22, 531}, [9] = {-198, -490, 232, 495},
+				[10] = {-354, -371, 354, 409}, [11] = {-438, -279, 485, 255},
+				[12] = {-511, -116, 457, 93}, [13] = {-485, 19, 504, -81},
+				[14] = {-466, 189, 423, -200}, [15] = {-376, 303, 360, -314},
+				[16] = {-269, 391, 198, -394}, [17] = {-144, 437, 80, -427},
+				[18] = {-36, 427, -74, -419}, [19] = {94, 378, -145, -383},
+				[20] = {179, 356, -270, -292}, [24] = {309, 30, -301, 52},
+				[25] = {284, -42, -235, 136}, [26] = {257, -101, -202, 177},
+				[27] = {214, -136, -153, 250}, [28] = {199, -203, -100, 225},
+				[29] = {136, -231, -71, 254}, [30] = {79, -281, 33, 286},
+				[31] = {22, -260, 70, 232}, [32] = {-35, -263, 137, 212},
+				[33] = {-102, -267, 202, 174}, [34] = {-140, -224, 251, 107},
+				[35] = {-171, -185, 247, 36}, [36] = {-232, -142, 255, -44},
+				[37] = {-274, -52, 267, -117}, [38] = {-258, 26, 211, -186},
+				[39] = {-233, 106, 154, -219}, [40] = {-176, 141, 85, -212},
+				[41] = {-142, 178, -17, -228}, [42] = {-72, 221, -91, -228},
+				[43] = {-31, 214, -141, -163}, [44] = {30, 179, -180, -115},
+				[45] = {86, 167, -187, -80}, [46] = {89, 145, -172, 15},
+				[47] = {129, 37, -134, 42}, [48] = {120, 44, -70, 62},
+				[49] = {52, -3, -51, 94}, [50] = {56, -18, 14, 77},
+				[51] = {-6, -30, 2, 5}, [52] = {-19, 10, -35, -28},
+				[53] = {30, 39, -42, -40}, [54] = {38, 84, -106, -21},
+				[55] = {54, 105, -125, -30}, [56] = {112, 132, -143, 28},
+				[57] = {181, 91, -148, 104}, [58] = {203, -15, -158, 183},
+				[59] = {243, -64, -122, 248}, [60] = {247, -141, 4, 322},
+				[61] = {234, -249, 93, 303}, [62] = {133, -311, 209, 263},
+				[63] = {42, -368, 305, 232}, [64] = {-67, -378, 385, 103},
+				[65] = {-218, -325, 429, -66}, [66] = {-334, -302, 399, -174},
+				[67] = {-407, -194, 334, -288}, [68] = {-457, -57, 190, -403},
+				[69] = {-493, 102, 78, -480}, [70] = {-408, 228, -110, -469},
+				[71] = {-316, 340, -248, -421}, [72] = {-197, 464, -366, -351},
+				[73] = {-40, 509, -444, -171}, [74] = {87, 474, -482, -17},
+			},
+		},
+	},
+	{
+		.name = "corridor_19m",
+		.distance = 19.40f,
+		.ifft_f32 = { 19.411f, 20.201f },
+		.n_ap = 2,
+		.tones = {
+			[0] = {
+				[0] = {-332, -243, 12, 430}, [1] = {-420, -92, 171, 421},
+				[2] = {-436, 93, 347, 273}, [3] = {-342, 252, 383, 67},
+				[4] = {-173, 355, 380, -122}, [5] = {3, 381, 252, -212},
+				[6] = {140, 384, 121, -418}, [7] = {333, 262, -95, -431},
+				[8] = {320, 55, -175, -321}, [9] = {330, -55, -326, -105},
+				[10] = {272, -193, -350, 24}, [11] = {142, -238, -261, 97},
+				[12] = {4, -199, -185, 225}, [13] = {-111, -173, -61, 188},
+				[14] = {-144, -67, 29, 206}, [15] = {-129, -116, 125, 143},
+				[16] = {-90, -34, 111, 85}, [17] = {-73, -25, 92, 34},
+				[18] = {-63, -45, 86, -1}, [19] = {-116, -60, 119, 149},
+				[20] = {-215, 24, 191, 107}, [24] = {26, 353, 91, -349},
+				[25] = {235, 323, -185, -440}, [26] = {408, 288, -369, -310},
+				[27] = {543, -5, -531, -120}, [28] = {455, -319, -536, 142},
+				[29] = {373, -500, -425, 445}, [30] = {39, -593, -185, 597},
+				[31] = {-225, -594, 133, 549}, [32] = {-535, -335, 478, 459},
+				[33] = {-659, -15, 608, 145}, [34] = {-619, 280, 589, -180},
+				[35] = {-376, 528, 407, -464}, [36] = {-148, 565, 185, -620},
+				[37] = {199, 553, -208, -517}, [38] = {424, 368, -415, -355},
+				[39] = {529, 79, -471, -102}, [40] = {437, -194, -416, 168},
+				[41] = {257, -329, -261, 282}, [42] = {55, -342, -86, 312},
+				[43] = {-94, -263, 74, 210}, [44] = {-172, -98, 158, 77},
+				[45] = {-183, -33, 88, -6}, [46] = {-37, 69, 38, -71},
+				[47] = {12, 35, -74, -32}, [48] = {61, -71, -105, 34},
+				[49] = {34, -174, -62, 185}, [50] = {-102, -219, 98, 203},
+				[51] = {-273, -121, 242, 155}, [52] = {-364, -82, 425, -16},
+				[53] = {-427, 218, 351, -237}, [54] = {-355, 390, 175, -528},
+				[55] = {-8, 563, -144, -540}, [56] = {254, 524, -455, -426},
+				[57] = {503, 359, -597, -127}, [58] = {574, 76, -643, 143},
+				[59] = {572, -272, -514, 473}, [60] = {416, -593, -173, 703},
+				[61] = {178, -665, 127, 644}, [62] = {-220, -623, 470, 427},
+				[63] = {-478, -415, 619, 200}, [64] = {-639, -115, 608, -186},
+				[65] = {-593, 203, 415, -477}, [66] = {-365, 428, 162, -570},
+				[67] = {-162, 517, -149, -538}, [68] = {108, 465, -346, -294},
+				[69] = {311, 316, -380, -100}, [70] = {362, 131, -413, 97},
+				[71] = {352, 10, -224, 218}, [72] = {237, -152, -84, 199},
+				[73] = {77, -206, -27, 202}, [74] = {39, -104, 95, 103},
+			},
+			[1] = {
+				[0] = {210, 680, -469, 567}, [1] = {411, 488, -189, 636},
+				[2] = {553, 192, 252, 578}, [3] = {618, -87, 476, 392},
+				[4] = {558, -302, 574, 193}, [5] = {306, -540, 543, -112},
+				[6] = {61, -488, 375, -272}, [7] = {-170, -484, 270, -362},
+				[8] = {-251, -393, 22, -460}, [9] = {-373, -295, -85, -519},
+				[10] = {-433, -187, -284, -392}, [11] = {-515, 16, -443, -287},
+				[12] = {-475, 147, -541, -188}, [13] = {-398, 305, -544, 30},
+				[14] = {-225, 580, -518, 289}, [15] = {87, 737, -362, 577},
+				[16] = {380, 655, -1, 712}, [17] = {657, 377, 383, 711},
+				[18] = {813, 134, 636, 453}, [19] = {804, -302, 839, 111},
+				[20] = {531, -652, 858, -306}, [24] = {-764, -181, -686, -529},
+				[25] = {-774, 249, -810, -151}, [26] = {-570, 497, -705, 234},
+				[27] = {-254, 591, -469, 466}, [28] = {48, 680, -208, 550},
+				[29] = {258, 543, 27, 631}, [30] = {359, 247, 306, 395},
+				[31] = {475, 105, 304, 191}, [32] = {361, -11, 424, 65},
+				[33] = {349, -184, 354, -1}, [34] = {289, -264, 396, -137},
+				[35] = {265, -365, 237, -284}, [36] = {58, -444, 207, -406},
+				[37] = {-76, -518, 37, -520}, [38] = {-282, -400, -282, -456},
+				[39] = {-501, -293, -426, -300}, [40] = {-580, -3, -540, -108},
+				[41] = {-575, 273, -538, 242}, [42] = {-227, 507, -426, 463},
+				[43] = {1, 593, -145, 551}, [44] = {224, 493, 294, 564},
+				[45] = {484, 326, 477, 291}, [46] = {488, 57, 587, 136},
+				[47] = {403, -268, 396, -214}, [48] = {271, -312, 214, -402},
+				[49] = {-33, -439, -43, -399}, [50] = {-172, -222, -241, -298},
+				[51] = {-254, -81, -229, -139}, [52] = {-207, 53, -227, 68},
+				[53] = {-68, 81, -131, 83}, [54] = {-63, 79, 29, 60},
+				[55] = {90, 41, 5, 36}, [56] = {74, -97, 32, -38},
+				[57] = {-112, -49, -66, -67}, [58] = {-116, 16, -116, 15},
+				[59] = {-157, 66, -133, 72}, [60] = {-29, 187, -107, 185},
+				[61] = {39, 205, 69, 201}, [62] = {84, 166, 159, 113},
+				[63] = {165, 58, 226, 21}, [64] = {156, -82, 189, -109},
+				[65] = {141, -125, 66, -115}, [66] = {14, -168, -12, -155},
+				[67] = {-95, -47, -166, -140}, [68] = {-87, -20, -41, 8},
+				[69] = {-35, 78, 8, 77}, [70] = {32, 99, 82, 74},
+				[71] = {116, 33, 125, -81}, [72] = {164, -113, -17, -151},
+				[73] = {48, -234, -72, -238}, [74] = {-106, -289, -165, -134},
+			},
+		},
+	},
+	{
+		.name = "hall_33m",
+		.distance = 33.00f,
+		.ifft_f32 = { 33.463f, 32.911f, 31.033f, 32.790f },
+		.n_ap = 4,
+		.tones = {
+			[0] = {
+				[0] = {-281, 157, -337, 71}, [1] = {-69, 346, -117, 311},
+				[2] = {193, 270, 130, 314}, [3] = {299, 5, 290, 145},
+				[4] = {233, -96, 306, -45}, [5] = {22, -245, 107, -261},
+				[6] = {-58, -291, -67, -207}, [7] = {-211, -166, -212, -168},
+				[8] = {-254, -64, -253, 64}, [9] = {-239, 73, -136, 138},
+				[10] = {-176, 255, -58, 187}, [11] = {70, 346, 110, 249},
+				[12] = {188, 138, 124, 115}, [13] = {157, 12, 296, 6},
+				[14] = {177, -121, 104, -216}, [15] = {35, -276, -37, -250},
+				[16] = {-130, -146, -195, -186}, [17] = {-132, -75, -140, -1},
+				[18] = {-198, 77, -264, 123}, [19] = {-59, 187, -55, 139},
+				[20] = {59, 180, 61, 151}, [24] = {75, -177, -13, -273},
+				[25] = {-24, -191, -43, -181}, [26] = {-116, -161, -140, -110},
+				[27] = {-267, -29, -260, 76}, [28] = {-234, 72, -283, 147},
+				[29] = {-160, 316, 46, 284}, [30] = {56, 325, 182, 168},
+				[31] = {366, 241, 363, 96}, [32] = {398, -54, 352, -237},
+				[33] = {256, -346, 101, -395}, [34] = {-87, -455, -277, -344},
+				[35] = {-380, -270, -442, -60}, [36] = {-483, 43, -446, 272},
+				[37] = {-290, 397, -55, 395}, [38] = {19, 459, 234, 450},
+				[39] = {407, 236, 459, -32}, [40] = {366, -56, 387, -249},
+				[41] = {249, -390, 96, -431}, [42] = {-36, -410, -304, -365},
+				[43] = {-319, -216, -317, 29}, [44] = {-353, 75, -281, 167},
+				[45] = {-182, 186, 2, 351}, [46] = {-45, 199, 87, 214},
+				[47] = {124, 236, 137, 106}, [48] = {91, -9, 105, 12},
+				[49] = {102, -16, 44, -31}, [50] = {105, -43, 119, -134},
+				[51] = {149, 43, 65, -93}, [52] = {139, -150, 12, -188},
+				[53] = {49, -215, -229, -178}, [54] = {-193, -240, -310, -32},
+				[55] = {-355, -41, -241, 223}, [56] = {-299, 287, 59, 406},
+				[57] = {-15, 510, 367, 317}, [58] = {367, 375, 479, -8},
+				[59] = {620, 6, 322, -500}, [60] = {355, -400, -73, -522},
+				[61] = {68, -581, -512, -401}, [62] = {-473, -399, -562, 231},
+				[63] = {-619, 6, -267, 555}, [64] = {-396, 522, 203, 503},
+				[65] = {6, 540, 570, 217}, [66] = {423, 294, 474, -199},
+				[67] = {452, -30, 178, -510}, [68] = {253, -355, -232, -427},
+				[69] = {-36, -393, -417, -62}, [70] = {-323, -164, -304, 225},
+				[71] = {-335, 137, -18, 294}, [72] = {-56, 287, 126, 199},
+				[73] = {28, 229, 188, 20}, [74] = {94, -8, -35, -26},
+			},
+			[1] = {
+				[0] = {-39, -676, -392, -364}, [1] = {-468, -333, -557, 30},
+				[2] = {-465, 47, -359, 426}, [3] = {-337, 437, -45, 516},
+				[4] = {0, 509, 291, 394}, [5] = {322, 407, 501, -22},
+				[6] = {493, 127, 333, -339}, [7] = {334, -268, 182, -403},
+				[8] = {186, -280, -190, -292}, [9] = {-67, -369, -322, -175},
+				[10] = {-414, -207, -363, 44}, [11] = {-381, 25, -243, 290},
+				[12] = {-312, 161, -29, 368}, [13] = {-91, 388, 189, 289},
+				[14] = {79, 391, 392, 135}, [15] = {425, 163, 413, -283},
+				[16] = {403, -128, 149, -403}, [17] = {261, -314, -222, -497},
+				[18] = {-34, -427, -378, -246}, [19] = {-397, -265, -518, 114},
+				[20] = {-454, 27, -224, 440}, [24] = {478, 33, 237, -418},
+				[25] = {354, -321, -54, -355}, [26] = {42, -332, -359, -168},
+				[27] = {-178, -314, -323, 22}, [28] = {-239, -135, -167, 170},
+				[29] = {-288, -27, -131, 295}, [30] = {-97, 168, 90, 237},
+				[31] = {-48, 150, 200, 177}, [32] = {122, 215, 94, -26},
+				[33] = {261, 182, 219, -156}, [34] = {285, 107, 101, -123},
+				[35] = {229, -85, -82, -265}, [36] = {192, -278, -269, -302},
+				[37] = {-30, -419, -359, -56}, [38] = {-376, -275, -324, 228},
+				[39] = {-450, 19, -3, 469}, [40] = {-309, 371, 297, 406},
+				[41] = {29, 483, 540, -93}, [42] = {388, 385, 308, -402},
+				[43] = {515, -28, -95, -420}, [44] = {300, -424, -335, -314},
+				[45] = {-110, -454, -490, 74}, [46] = {-374, -204, -246, 342},
+				[47] = {-366, 59, -38, 412}, [48] = {-146, 264, 316, 224},
+				[49] = {49, 322, 323, -40}, [50] = {240, 244, 236, -267},
+				[51] = {217, -11, -44, -207}, [52] = {127, -82, -118, -112},
+				[53] = {11, -73, -60, 33}, [54] = {35, -14, -6, 7},
+				[55] = {44, -77, -52, -90}, [56] = {-22, -179, -231, -10},
+				[57] = {-130, -132, -189, 61}, [58] = {-358, -150, -38, 275},
+				[59] = {-328, 160, 252, 231}, [60] = {-132, 326, 380, 79},
+				[61] = {225, 429, 247, -347}, [62] = {469, 236, 76, -584},
+				[63] = {457, -178, -324, -397}, [64] = {253, -491, -507, 65},
+				[65] = {-244, -536, -339, 437}, [66] = {-525, -136, -22, 557},
+				[67] = {-511, 219, 392, 313}, [68] = {-238, 509, 464, -9},
+				[69] = {154, 335, 381, -273}, [70] = {383, 190, 11, -410},
+				[71] = {434, -75, -212, -337}, [72] = {244, -356, -481, -12},
+				[73] = {-9, -370, -256, 254}, [74] = {-256, -183, -166, 234},
+			},
+			[2] = {
+				[0] = {-480, 201, 455, 43}, [1] = {-257, 434, 354, -295},
+				[2] = {200, 342, 41, -488}, [3] = {310, 120, -236, -240},
+				[4] = {349, -109, -314, 38}, [5] = {19, -359, -157, 251},
+				[6] = {-219, -233, 183, 262}, [7] = {-284, -171, 262, 105},
+				[8] = {-47, 140, 161, -131}, [9] = {107, 110, 27, -247},
+				[10] = {98, -78, -157, -1}, [11] = {57, -227, -149, 171},
+				[12] = {-136, -144, 82, 205}, [13] = {-219, 60, 209, 132},
+				[14] = {-59, 289, 189, -209}, [15] = {145, 377, -63, -311},
+				[16] = {420, 178, -305, -255}, [17] = {360, -182, -385, -39},
+				[18] = {145, -462, -244, 326}, [19] = {-95, -377, 118, 415},
+				[20] = {-368, -79, 444, 227}, [24] = {459, 238, -373, -199},
+				[25] = {455, -159, -416, 142}, [26] = {192, -384, -180, 420},
+				[27] = {-137, -370, 111, 407}, [28] = {-348, -273, 314, 242},
+				[29] = {-421, 109, 357, -77}, [30] = {-176, 281, 150, -396},
+				[31] = {64, 435, -69, -337}, [32] = {320, 313, -321, -277},
+				[33] = {386, 13, -379, -57}, [34] = {407, -350, -346, 351},
+				[35] = {127, -338, -48, 428}, [36] = {-202, -431, 300, 444},
+				[37] = {-487, -202, 374, 40}, [38] = {-385, 140, 338, -229},
+				[39] = {-207, 341, 187, -391}, [40] = {114, 364, -234, -347},
+				[41] = {363, 193, -472, -197}, [42] = {425, 2, -402, 186},
+				[43] = {269, -309, -189, 304}, [44] = {-23, -455, 198, 342},
+				[45] = {-231, -269, 274, 117}, [46] = {-330, 12, 234, -111},
+				[47] = {-228, 229, 50, -299}, [48] = {78, 303, -147, -265},
+				[49] = {159, 147, -152, -66}, [50] = {191, 23, -252, 71},
+				[51] = {103, -28, -21, 248}, [52] = {7, -119, -95, 99},
+				[53] = {-18, -88, 83, 62}, [54] = {47, -26, 16, 45},
+				[55] = {-44, -25, 32, 3}, [56] = {-152, -94, 103, -1},
+				[57] = {-75, -56, 212, -5}, [58] = {-189, 125, 177, -228},
+				[59] = {-39, 233, -185, -214}, [60] = {81, 254, -295, -106},
+				[61] = {305, 165, -368, 108}, [62] = {227, -75, -114, 307},
+				[63] = {115, -351, 182, 304}, [64] = {-171, -367, 376, 152},
+				[65] = {-392, -152, 329, -146}, [66] = {-274, 181, 49, -366},
+				[67] = {-114, 331, -237, -299}, [68] = {175, 356, -305, -111},
+				[69] = {308, 98, -201, 219}, [70] = {280, -114, -98, 378},
+				[71] = {84, -389, 169, 225}, [72] = {-193, -202, 235, 15},
+				[73] = {-235, -58, 158, -131}, [74] = {-119, 100, -35, -165},
+			},
+			[3] = {
+				[0] = {-471, -323, -404, -414}, [1] = {-557, 17, -465, -61},
+				[2] = {-306, 356, -338, 336}, [3] = {14, 488, -59, 491},
+				[4] = {319, 358, 335, 308}, [5] = {445, 95, 463, -12},
+				[6] = {341, -217, 397, -319}, [7] = {83, -377, 84, -404},
+				[8] = {-154, -373, -197, -367}, [9] = {-379, -154, -318, -167},
+				[10] = {-398, 133, -359, 146}, [11] = {-159, 245, -129, 370},
+				[12] = {39, 318, 63, 399}, [13] = {217, 189, 337, 159},
+				[14] = {292, -46, 350, -27}, [15] = {230, -155, 158, -155},
+				[16] = {34, -252, 52, -222}, [17] = {-78, -262, -82, -212},
+				[18] = {-177, -136, -151, -98}, [19] = {-348, -46, -139, 99},
+				[20] = {-208, 142, -128, 148}, [24] = {175, 64, 112, -6},
+				[25] = {96, -124, 121, -217}, [26] = {-18, -256, -7, -209},
+				[27] = {-36, -124, -154, -232}, [28] = {-226, -160, -306, -54},
+				[29] = {-273, 74, -208, 93}, [30] = {-110, 178, -68, 206},
+				[31] = {1, 280, 61, 222}, [32] = {177, 183, 212, 164},
+				[33] = {208, 104, 286, -32}, [34] = {298, -152, 167, -233},
+				[35] = {166, -218, 1, -282}, [36] = {-16, -293, -92, -232},
+				[37] = {-329, -272, -229, -1}, [38] = {-286, 118, -270, 254},
+				[39] = {-235, 264, -47, 281}, [40] = {-60, 330, 189, 272},
+				[41] = {218, 237, 390, 80}, [42] = {303, 67, 316, -140},
+				[43] = {306, -135, 73, -334}, [44] = {48, -359, -122, -265},
+				[45] = {-141, -365, -279, -105}, [46] = {-310, -70, -261, 201},
+				[47] = {-341, 66, -203, 266}, [48] = {-221, 310, 101, 294},
+				[49] = {117, 271, 262, 138}, [50] = {284, 106, 341, -149},
+				[51] = {345, 4, 178, -169}, [52] = {198, -223, 5, -234},
+				[53] = {-38, -248, -217, -112}, [54] = {-215, -205, -315, 7},
+				[55] = {-195, -56, -161, 161}, [56] = {-185, 107, 42, 252},
+				[57] = {-76, 150, 162, 89}, [58] = {73, 155, 171, 35},
+				[59] = {156, 109, 213, -133}, [60] = {188, -38, 58, -121},
+				[61] = {23, -147, -80, -135}, [62] = {-37, -31, -55, -54},
+				[63] = {-25, 1, -169, 52}, [64] = {-26, -8, -15, -10},
+				[65] = {65, 37, -37, 109}, [66] = {49, 6, 82, 112},
+				[67] = {-15, -43, 71, 42}, [68] = {86, -75, -82, 67},
+				[69] = {1, 6, -37, -7}, [70] = {2, 75, 105, 90},
+				[71] = {47, 93, 43, -40}, [72] = {105, 64, 80, -139},
+				[73] = {111, -85, -6, -184}, [74] = {90, -148, -165, -85},
+			},
+		},
+	},
+};
+
+const size_t datasets_num = ARRAY_SIZE(datasets);
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef DATASETS_H__
+#define DATASETS_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/sys/util.h>
+
+#define DATASET_AP_MAX (4)
+#define DATASET_CHANNELS (75)
+
+/* IQ values of a tone measured on both devices. */
+struct dataset_tone {
+	int16_t i_local;
+	int16_t q_local;
+	int16_t i_remote;
+	int16_t q_remote;
+};
+
+struct dataset {
+	const char *name;
+	/* Distance between the devices, in meters. */
+	float distance;
+	/* Distance estimated by the floating-point IFFT path, for each antenna path. */
+	float ifft_f32[DATASET_AP_MAX];
+	uint8_t n_ap;
+	/* Tones of each antenna path, indexed by channel from 2 to 76.
+	 * Channels 23 to 25 do not have tones.
+	 */
+	struct dataset_tone tones[DATASET_AP_MAX][DATASET_CHANNELS];
+};
+
+extern const struct dataset datasets[];
+extern const size_t datasets_num;
+
+#endif /* DATASETS_H__ */
@@ -0,0 +1,306 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/bluetooth/conn.h>
+#include <zephyr/bluetooth/hci_types.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/timing/timing.h>
+#include <bluetooth/cs_de.h>
+#include <bluetooth/services/ras.h>
+
+#include <math.h>
+
+#include "datasets.h"
+
+/* Number of procedures estimated for each dataset in a single run. */
+#define BENCH_RUNS (20)
+/* Number of ranging sessions estimating at the same time. */
+#define BENCH_SESSIONS (3)
+/* Largest difference from the estimates of the floating-point path. */
+#define FLOAT_PATH_TOLERANCE_M (0.05f)
+
+#define CHANNEL_INDEX_OFFSET (2)
+#define STEP_DATA_MAX_LEN                                                                          \
+	(sizeof(struct bt_hci_le_cs_step_data_mode_2) +                                            \
+	 (DATASET_AP_MAX + 1) * sizeof(struct bt_hci_le_cs_step_data_tone_info))
+
+#define M_TO_MM(m) ((int32_t)((m) * 1000.0f))
+
+BUILD_ASSERT(DATASET_AP_MAX <= CONFIG_BT_RAS_MAX_ANTENNA_PATHS);
+
+#if defined(CONFIG_TIMING_FUNCTIONS)
+#define BENCH_UNIT "cycles"
+
+typedef timing_t bench_time_t;
+
+static bench_time_t bench_now(void)
+{
+	return timing_counter_get();
+}
+
+static uint64_t bench_elapsed(bench_time_t start)
+{
+	bench_time_t end = timing_counter_get();
+
+	return timing_cycles_get(&start, &end);
+}
+#else
+/* Simulated time does not advance while code executes on native_sim,
+ * so the benchmark reads the host clock provided by the native simulator runner.
+ */
+#define BENCH_UNIT "ns"
+
+typedef uint64_t bench_time_t;
+
+uint64_t host_clock_ns(void);
+
+static bench_time_t bench_now(void)
+{
+	return host_clock_ns();
+}
+
+static uint64_t bench_elapsed(bench_time_t start)
+{
+	return host_clock_ns() - start;
+}
+#endif /* defined(CONFIG_TIMING_FUNCTIONS) */
+
+/* Mode 2 step, as reported by the local controller and by the peer. */
+struct step {
+	struct bt_le_cs_subevent_step local;
+	struct bt_le_cs_subevent_step peer;
+	uint8_t local_data[STEP_DATA_MAX_LEN];
+	uint8_t peer_data[STEP_DATA_MAX_LEN];
+};
+
+/* Ranging session replaying the procedure of a dataset. */
+struct session {
+	const struct dataset *dataset;
+	struct step steps[DATASET_CHANNELS];
+	size_t steps_num;
+	cs_de_ctx_t ctx;
+};
+
+static struct bt_conn_le_cs_config cs_config;
+static struct session sessions[BENCH_SESSIONS];
+
+static bool channel_has_tones(uint8_t channel_index)
+{
+	uint8_t channel = channel_index + CHANNEL_INDEX_OFFSET;
+
+	return channel < 23 || channel > 25;
+}
+
+static void pct_put(uint8_t pct[3], int16_t i, int16_t q)
+{
+	sys_put_le24(((uint32_t)(q & 0xFFF) << 12) | (i & 0xFFF), pct);
+}
+
+static void session_init(struct session *session, const struct dataset *dataset)
+{
+	size_t data_len = sizeof(struct bt_hci_le_cs_step_data_mode_2) +
+			  (dataset->n_ap + 1) * sizeof(struct bt_hci_le_cs_step_data_tone_info);
+
+	session->dataset = dataset;
+	session->steps_num = 0;
+
+	for (uint8_t n = 0; n < DATASET_CHANNELS; n++) {
+		struct step *step;
+		struct bt_hci_le_cs_step_data_mode_2 *local_data;
+		struct bt_hci_le_cs_step_data_mode_2 *peer_data;
+
+		if (!channel_has_tones(n)) {
+			continue;
+		}
+
+		step = &session->steps[session->steps_num++];
+		memset(step, 0, sizeof(*step));
+
+		local_data = (struct bt_hci_le_cs_step_data_mode_2 *)step->local_data;
+		peer_data = (struct bt_hci_le_cs_step_data_mode_2 *)step->peer_data;
+
+		for (uint8_t ap = 0; ap < dataset->n_ap; ap++) {
+			const struct dataset_tone *tone = &dataset->tones[ap][n];
+			struct bt_hci_le_cs_step_data_tone_info *local_tone;
+			struct bt_hci_le_cs_step_data_tone_info *peer_tone;
+
+			local_tone = &local_data->tone_info[ap];
+			peer_tone = &peer_data->tone_info[ap];
+
+			pct_put(local_tone->phase_correction_term, tone->i_local, tone->q_local);
+			local_tone->quality_indicator = BT_HCI_LE_CS_TONE_QUALITY_HIGH;
+			pct_put(peer_tone->phase_correction_term, tone->i_remote, tone->q_remote);
+			peer_tone->quality_indicator = BT_HCI_LE_CS_TONE_QUALITY_HIGH;
+		}
+
+		step->local.mode = BT_HCI_OP_LE_CS_MAIN_MODE_2;
+		step->local.channel = n + CHANNEL_INDEX_OFFSET;
+		step->local.data_len = data_len;
+		step->local.data = step->local_data;
+
+		step->peer = step->local;
+		step->peer.data = step->peer_data;
+	}
+}
+
+static void session_start(struct session *session)
+{
+	struct ras_ranging_header header = {
+		.antenna_paths_mask = BIT_MASK(session->dataset->n_ap),
+	};
+
+	cs_de_ctx_init(&session->ctx, &cs_config);
+	cs_de_ctx_ranging_header_cb(&header, &session->ctx);
+}
+
+static void session_step_add(struct session *session, size_t idx)
+{
+	struct step *step = &session->steps[idx];
+
+	cs_de_ctx_step_data_cb(&step->local, &step->peer, &session->ctx);
+}
+
+static cs_de_quality_t session_run(struct session *session)
+{
+	session_start(session);
+
+	for (size_t i = 0; i < session->steps_num; i++) {
+		session_step_add(session, i);
+	}
+
+	return cs_de_ctx_calc(&session->ctx);
+}
+
+static void *bench_setup(void)
+{
+	cs_config.role = BT_CONN_LE_CS_ROLE_INITIATOR;
+
+	for (uint8_t n = 0; n < DATASET_CHANNELS; n++) {
+		uint8_t channel = n + CHANNEL_INDEX_OFFSET;
+
+		if (channel_has_tones(n)) {
+			cs_config.channel_map[channel / 8] |= BIT(channel % 8);
+		}
+	}
+
+#if defined(CONFIG_TIMING_FUNCTIONS)
+	timing_init();
+	timing_start();
+#endif
+
+	TC_PRINT("IFFT with %u points in %s arithmetic\n", CONFIG_BT_CS_DE_NFFT_SIZE,
+		 IS_ENABLED(CONFIG_BT_CS_DE_IFFT_Q31) ? "q31 fixed-point" : "floating-point");
+
+	return NULL;
+}
+
+/* The estimates are as accurate as the ones of the floating-point path. */
+ZTEST(cs_de_benchmark, test_accuracy)
+{
+	struct session *session = &sessions[0];
+
+	for (size_t d = 0; d < datasets_num; d++) {
+		const struct dataset *dataset = &datasets[d];
+		const cs_de_report_t *report = &session->ctx.report;
+		float error = 0.0f;
+		float deviation = 0.0f;
+
+		session_init(session, dataset);
+		zassert_equal(session_run(session), CS_DE_QUALITY_OK, "%s: no estimate",
+			      dataset->name);
+		zassert_equal(report->n_ap, dataset->n_ap);
+
+		for (uint8_t ap = 0; ap < dataset->n_ap; ap++) {
+			float ifft = report->distance_estimates[ap].ifft;
+
+			zassert_equal(report->tone_quality[ap], CS_DE_TONE_QUALITY_OK);
+			error = fmaxf(error, fabsf(ifft - dataset->distance));
+			deviation = fmaxf(deviation, fabsf(ifft - dataset->ifft_f32[ap]));
+		}
+
+		TC_PRINT("%-14s %u AP: %6d mm, IFFT error up to %5d mm, %3d mm from the "
+			 "floating-point path\n",
+			 dataset->name, dataset->n_ap, M_TO_MM(dataset->distance), M_TO_MM(error),
+			 M_TO_MM(deviation));
+
+		zassert_true(deviation <= FLOAT_PATH_TOLERANCE_M,
+			     "%s: %d mm from the floating-point path", dataset->name,
+			     M_TO_MM(deviation));
+	}
+}
+
+/* Time of adding the steps of a procedure as they arrive, and of the estimation. */
+ZTEST(cs_de_benchmark, test_time_per_estimate)
+{
+	struct session *session = &sessions[0];
+
+	for (size_t d = 0; d < datasets_num; d++) {
+		const struct dataset *dataset = &datasets[d];
+		uint64_t steps_time = 0;
+		uint64_t calc_time = 0;
+		bench_time_t start;
+
+		session_init(session, dataset);
+
+		for (uint32_t run = 0; run < BENCH_RUNS; run++) {
+			start = bench_now();
+			session_start(session);
+
+			for (size_t i = 0; i < session->steps_num; i++) {
+				session_step_add(session, i);
+			}
+
+			steps_time += bench_elapsed(start);
+
+			start = bench_now();
+			zassert_equal(cs_de_ctx_calc(&session->ctx), CS_DE_QUALITY_OK);
+			calc_time += bench_elapsed(start);
+		}
+
+		TC_PRINT("%-14s %u AP: %8u %s/estimate, %7u adding %u steps, %8u estimating\n",
+			 dataset->name, dataset->n_ap,
+			 (uint32_t)((steps_time + calc_time) / BENCH_RUNS), BENCH_UNIT,
+			 (uint32_t)(steps_time / BENCH_RUNS), (uint32_t)session->steps_num,
+			 (uint32_t)(calc_time / BENCH_RUNS));
+	}
+}
+
+/* Sessions with interleaved steps estimate the same distances as sessions run one by one. */
+ZTEST(cs_de_benchmark, test_concurrent_sessions)
+{
+	cs_de_dist_estimates_t expected[BENCH_SESSIONS][DATASET_AP_MAX];
+	size_t steps_num = 0;
+
+	for (size_t s = 0; s < BENCH_SESSIONS; s++) {
+		struct session *session = &sessions[s];
+
+		session_init(session, &datasets[s % datasets_num]);
+		zassert_equal(session_run(session), CS_DE_QUALITY_OK);
+		memcpy(expected[s], session->ctx.report.distance_estimates, sizeof(expected[s]));
+
+		steps_num = MAX(steps_num, session->steps_num);
+		session_start(session);
+	}
+
+	for (size_t i = 0; i < steps_num; i++) {
+		for (size_t s = 0; s < BENCH_SESSIONS; s++) {
+			if (i < sessions[s].steps_num) {
+				session_step_add(&sessions[s], i);
+			}
+		}
+	}
+
+	for (size_t s = 0; s < BENCH_SESSIONS; s++) {
+		struct session *session = &sessions[s];
+
+		zassert_equal(cs_de_ctx_calc(&session->ctx), CS_DE_QUALITY_OK);
+		zassert_mem_equal(session->ctx.report.distance_estimates, expected[s],
+				  sizeof(expected[s]), "Session %zu estimates differ", s);
+	}
+}
+
+ZTEST_SUITE(cs_de_benchmark, NULL, bench_setup, NULL, NULL, NULL);
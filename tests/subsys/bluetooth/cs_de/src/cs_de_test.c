@@ -9,12 +9,19 @@
 #include <string.h>
 #include <math.h>
 
+#include <zephyr/bluetooth/hci_types.h>
+#include <zephyr/sys/byteorder.h>
 #include <bluetooth/cs_de.h>
+#include <bluetooth/services/ras.h>
 
 #define NUM_CHANNELS (75)
 #define CHANNEL_SPACING_HZ  (1e6f)
 #define PI (3.14159265358979f)
 #define SPEED_OF_LIGHT_M_PER_S (299792458.0f)
+#define CHANNEL_INDEX_OFFSET (2)
+#define STEP_DATA_LEN                                                                              \
+	(sizeof(struct bt_hci_le_cs_step_data_mode_2) +                                            \
+	 2 * sizeof(struct bt_hci_le_cs_step_data_tone_info))
 
 /* The unity_main is not declared in any header file. It is only defined in the generated test
  * runner because of ncs' unity configuration. It is therefore declared here to avoid a compiler
@@ -99,6 +106,103 @@ void test_cs_de_calc_with_ideal_iq_data(void)
 	}
 }
 
+static bool channel_has_tones(uint8_t channel_index)
+{
+	uint8_t channel = channel_index + CHANNEL_INDEX_OFFSET;
+
+	return channel < 23 || channel > 25;
+}
+
+static void ctx_init(cs_de_ctx_t *ctx)
+{
+	struct bt_conn_le_cs_config config = {
+		.role = BT_CONN_LE_CS_ROLE_INITIATOR,
+	};
+	struct ras_ranging_header header = {
+		.antenna_paths_mask = BIT(0),
+	};
+
+	for (uint8_t n = 0; n < NUM_CHANNELS; n++) {
+		uint8_t channel = n + CHANNEL_INDEX_OFFSET;
+
+		if (channel_has_tones(n)) {
+			config.channel_map[channel / 8] |= BIT(channel % 8);
+		}
+	}
+
+	cs_de_ctx_init(ctx, &config);
+	cs_de_ctx_ranging_header_cb(&header, ctx);
+}
+
+/* Add a mode 2 step with the ideal tone of one antenna path for a given distance in meters. */
+static void ctx_ideal_step_add(cs_de_ctx_t *ctx, float distance, uint8_t channel_index)
+{
+	float rotation = -2 * PI * CHANNEL_SPACING_HZ * distance * channel_index /
+			 SPEED_OF_LIGHT_M_PER_S;
+	int16_t i = (int16_t)roundf(1000 * cosf(rotation));
+	int16_t q = (int16_t)roundf(1000 * sinf(rotation));
+	uint8_t local_data[STEP_DATA_LEN] = {0};
+	struct bt_hci_le_cs_step_data_mode_2 *mode_2 =
+		(struct bt_hci_le_cs_step_data_mode_2 *)local_data;
+	struct bt_le_cs_subevent_step local_step = {
+		.mode = BT_HCI_OP_LE_CS_MAIN_MODE_2,
+		.channel = channel_index + CHANNEL_INDEX_OFFSET,
+		.data_len = STEP_DATA_LEN,
+		.data = local_data,
+	};
+
+	/* Both devices measure the same tone. */
+	sys_put_le24(((uint32_t)(q & 0xFFF) << 12) | (i & 0xFFF),
+		     mode_2->tone_info[0].phase_correction_term);
+	mode_2->tone_info[0].quality_indicator = BT_HCI_LE_CS_TONE_QUALITY_HIGH;
+
+	cs_de_ctx_step_data_cb(&local_step, &local_step, ctx);
+}
+
+void test_cs_de_ctx_no_steps(void)
+{
+	static cs_de_ctx_t ctx;
+
+	ctx_init(&ctx);
+
+	TEST_ASSERT_EQUAL(CS_DE_QUALITY_DO_NOT_USE, cs_de_ctx_calc(&ctx));
+	TEST_ASSERT_EQUAL(1, ctx.report.n_ap);
+	TEST_ASSERT_EQUAL(CS_DE_TONE_QUALITY_BAD, ctx.report.tone_quality[0]);
+}
+
+void test_cs_de_ctx_interleaved_steps(void)
+{
+	static cs_de_ctx_t ctx[2];
+	const float distance[ARRAY_SIZE(ctx)] = {3.0f, 27.5f};
+
+	for (uint8_t repeat = 0; repeat < 2; repeat++) {
+		for (size_t c = 0; c < ARRAY_SIZE(ctx); c++) {
+			ctx_init(&ctx[c]);
+		}
+
+		/* Each context receives the steps of its own procedure, twice per channel. */
+		for (uint8_t n = 0; n < NUM_CHANNELS; n++) {
+			if (!channel_has_tones(n)) {
+				continue;
+			}
+
+			for (size_t c = 0; c < ARRAY_SIZE(ctx); c++) {
+				ctx_ideal_step_add(&ctx[c], distance[c], n);
+				ctx_ideal_step_add(&ctx[c], distance[c], n);
+			}
+		}
+
+		for (size_t c = 0; c < ARRAY_SIZE(ctx); c++) {
+			TEST_ASSERT_EQUAL(CS_DE_QUALITY_OK, cs_de_ctx_calc(&ctx[c]));
+			TEST_ASSERT_EQUAL(CS_DE_TONE_QUALITY_OK, ctx[c].report.tone_quality[0]);
+			TEST_ASSERT_FLOAT_WITHIN(0.01f, distance[c],
+						 ctx[c].report.distance_estimates[0].ifft);
+			TEST_ASSERT_FLOAT_WITHIN(0.01f, distance[c],
+						 ctx[c].report.distance_estimates[0].phase_slope);
+		}
+	}
+}
+
 /* Main test entry point */
 int main(void)
 {
@@ -12,20 +12,34 @@
 #include <zephyr/sys/util.h>
 
 
+/* Maximum number of connections served by the discover mock at a time */
+#define DISCOVER_MOCK_CONN_MAX 8
+
+/* Simulated time of a single discover request */
+#define DISCOVER_MOCK_DELAY K_MSEC(5)
+
 /* Settings of the discover mock */
-static struct bt_discover_mock {
+static struct {
 	const struct bt_gatt_attr *attr;
 	size_t len;
+} discover_mock_data;
+
+/* Discover request state of a connection */
+static struct bt_discover_mock {
 	struct bt_conn *conn;
 	struct bt_gatt_discover_params *params;
 	struct k_work_delayable work;
-} discover_mock_data;
+} discover_mock_conn[DISCOVER_MOCK_CONN_MAX];
 
 static void bt_gatt_discover_work(struct k_work *work);
 
 void bt_gatt_discover_mock_setup(const struct bt_gatt_attr *attr, size_t len)
 {
-	k_work_init_delayable(&discover_mock_data.work, bt_gatt_discover_work);
+	for (size_t i = 0; i < ARRAY_SIZE(discover_mock_conn); i++) {
+		discover_mock_conn[i].conn = NULL;
+		k_work_init_delayable(&discover_mock_conn[i].work,
+				      bt_gatt_discover_work);
+	}
 	discover_mock_data.attr = attr;
 	discover_mock_data.len  = len;
 }
@@ -125,10 +139,26 @@ static void bt_gatt_discover_work(struct k_work *work)
 int bt_gatt_discover(struct bt_conn *conn,
 		     struct bt_gatt_discover_params *params)
 {
+	struct bt_discover_mock *mock_data = NULL;
+
 	printk("Running %s mock\n", __func__);
-	discover_mock_data.conn = conn;
-	discover_mock_data.params = params;
 
-	k_work_schedule(&discover_mock_data.work, K_MSEC(5));
+	for (size_t i = 0; i < ARRAY_SIZE(discover_mock_conn); i++) {
+		if (discover_mock_conn[i].conn == conn) {
+			mock_data = &discover_mock_conn[i];
+			break;
+		}
+
+		if (!mock_data && !discover_mock_conn[i].conn) {
+			mock_data = &discover_mock_conn[i];
+		}
+	}
+
+	zassert_not_null(mock_data, "Too many connections");
+
+	mock_data->conn = conn;
+	mock_data->params = params;
+
+	k_work_schedule(&mock_data->work, DISCOVER_MOCK_DELAY);
 	return 0;
 }
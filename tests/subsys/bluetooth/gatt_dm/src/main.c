@@ -476,3 +476,21 @@ ZTEST(gatt_tests, test_gatt_many_serv_by_uuid)
 	zassert_equal(0, bt_gatt_dm_attr_cnt(dm), "Parameter count after clearing: %d",
 		      bt_gatt_dm_attr_cnt(dm));
 }
+
+/* An ended discovery cannot be continued. */
+ZTEST(gatt_tests, test_gatt_continue_after_end)
+{
+	struct bt_gatt_dm *dm = run_dm(NULL);
+	struct bt_gatt_dm *dm_next = dm;
+
+	zassert_not_null(dm, "Device Manager pointer not set");
+
+	while (dm_next) {
+		dm_next = run_dm_next(dm);
+	}
+
+	zassert_equal(-EINVAL, bt_gatt_dm_continue(dm, &dm_next),
+		      "Ended discovery continued");
+	zassert_equal(-EBUSY, k_sem_take(&discovery_finished, K_NO_WAIT),
+		      "Callback called for an ended discovery");
+}
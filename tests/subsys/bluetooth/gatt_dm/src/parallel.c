@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <zephyr/bluetooth/uuid.h>
+#include <bluetooth/gatt_dm.h>
+#include "../mock/gatt_discover_mock.h"
+
+#define PEERS_NUM CONFIG_BT_GATT_DM_MAX_INSTANCES
+#define DISCOVERY_TIMEOUT K_MSEC(2000)
+/* Number of attributes of the discovered service */
+#define SERVICE_ATTR_CNT 4
+
+struct peer {
+	struct bt_gatt_dm *dm;
+	int err;
+};
+
+/* One connection more than the number of instances */
+static char peer_conn[PEERS_NUM + 1];
+static struct peer peers[PEERS_NUM + 1];
+static K_SEM_DEFINE(peer_ready, 0, K_SEM_MAX_LIMIT);
+
+static const struct bt_gatt_attr peer_db[] = {
+	BT_GATT_DISCOVER_MOCK_SERV(1, BT_UUID_BAS, 4),
+	BT_GATT_DISCOVER_MOCK_CHRC(2, BT_UUID_BAS_BATTERY_LEVEL,
+				   BT_GATT_CHRC_READ | BT_GATT_CHRC_NOTIFY),
+	BT_GATT_DISCOVER_MOCK_DESC(3, BT_UUID_BAS_BATTERY_LEVEL),
+	BT_GATT_DISCOVER_MOCK_DESC(4, BT_UUID_GATT_CCC),
+};
+
+static void peer_completed(struct bt_gatt_dm *dm, void *context)
+{
+	struct peer *peer = context;
+
+	peer->dm = dm;
+	k_sem_give(&peer_ready);
+}
+
+static void peer_service_not_found(struct bt_conn *conn, void *context)
+{
+	struct peer *peer = context;
+
+	peer->err = -ENOENT;
+	k_sem_give(&peer_ready);
+}
+
+static void peer_error_found(struct bt_conn *conn, int err, void *context)
+{
+	struct peer *peer = context;
+
+	peer->err = err;
+	k_sem_give(&peer_ready);
+}
+
+static const struct bt_gatt_dm_cb peer_cb = {
+	.completed         = peer_completed,
+	.service_not_found = peer_service_not_found,
+	.error_found       = peer_error_found,
+};
+
+static int peer_start(size_t idx)
+{
+	peers[idx].dm = NULL;
+	peers[idx].err = 0;
+
+	return bt_gatt_dm_start((struct bt_conn *)&peer_conn[idx], BT_UUID_BAS,
+				&peer_cb, &peers[idx]);
+}
+
+static void peer_wait(void)
+{
+	zassert_ok(k_sem_take(&peer_ready, DISCOVERY_TIMEOUT), "Discovery did not finish");
+}
+
+static void peer_check_and_release(size_t idx)
+{
+	struct bt_gatt_dm *dm = peers[idx].dm;
+
+	zassert_ok(peers[idx].err, "Peer %zu discovery failed: %d", idx, peers[idx].err);
+	zassert_not_null(dm, "Peer %zu not discovered", idx);
+	zassert_equal_ptr(bt_gatt_dm_conn_get(dm), &peer_conn[idx], "Peer %zu mixed up", idx);
+	zassert_equal(bt_gatt_dm_attr_cnt(dm), SERVICE_ATTR_CNT,
+		      "Peer %zu: %zu attributes", idx, bt_gatt_dm_attr_cnt(dm));
+	zassert_ok(bt_gatt_dm_data_release(dm));
+}
+
+static int64_t discover_sequential(void)
+{
+	int64_t start = k_uptime_get();
+
+	for (size_t i = 0; i < PEERS_NUM; i++) {
+		zassert_ok(peer_start(i));
+		peer_wait();
+		peer_check_and_release(i);
+	}
+
+	return k_uptime_get() - start;
+}
+
+static int64_t discover_parallel(void)
+{
+	int64_t start = k_uptime_get();
+	int64_t elapsed;
+
+	for (size_t i = 0; i < PEERS_NUM; i++) {
+		zassert_ok(peer_start(i));
+	}
+
+	for (size_t i = 0; i < PEERS_NUM; i++) {
+		peer_wait();
+	}
+
+	elapsed = k_uptime_get() - start;
+
+	for (size_t i = 0; i < PEERS_NUM; i++) {
+		for (size_t j = i + 1; j < PEERS_NUM; j++) {
+			zassert_not_equal(peers[i].dm, peers[j].dm,
+					  "Peers %zu and %zu share an instance", i, j);
+		}
+
+		peer_check_and_release(i);
+	}
+
+	return elapsed;
+}
+
+static void parallel_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	k_sem_reset(&peer_ready);
+	bt_gatt_discover_mock_setup(peer_db, ARRAY_SIZE(peer_db));
+}
+
+/* Discovery of all peers at once takes as long as the discovery of one peer. */
+ZTEST(gatt_dm_parallel, test_time_to_ready)
+{
+	int64_t sequential = discover_sequential();
+	int64_t parallel = discover_parallel();
+
+	TC_PRINT("%u peers ready in %lld ms sequentially, %lld ms in parallel\n",
+		 PEERS_NUM, (long long)sequential, (long long)parallel);
+
+	zassert_true(parallel < sequential, "No gain from the parallel discovery");
+}
+
+/* A connection gets one instance, and only as many connections as instances are served. */
+ZTEST(gatt_dm_parallel, test_instances_busy)
+{
+	for (size_t i = 0; i < PEERS_NUM; i++) {
+		zassert_ok(peer_start(i));
+	}
+
+	zassert_equal(bt_gatt_dm_start((struct bt_conn *)&peer_conn[0], BT_UUID_BAS, &peer_cb,
+				       &peers[0]),
+		      -EALREADY, "Second discovery on the same connection");
+	zassert_equal(peer_start(PEERS_NUM), -EALREADY, "Discovery with no free instance");
+
+	for (size_t i = 0; i < PEERS_NUM; i++) {
+		peer_wait();
+	}
+
+	for (size_t i = 0; i < PEERS_NUM; i++) {
+		peer_check_and_release(i);
+	}
+
+	/* Released instances can be used for another connection. */
+	zassert_ok(peer_start(PEERS_NUM));
+
+	for (size_t i = 0; i < PEERS_NUM; i++) {
+		if (bt_gatt_dm_conn_get(peers[i].dm) == (struct bt_conn *)&peer_conn[PEERS_NUM]) {
+			zassert_equal(bt_gatt_dm_continue(peers[i].dm, &peers[i]), -EINVAL,
+				      "Peer %zu continued on another connection", i);
+		}
+	}
+
+	peer_wait();
+	peer_check_and_release(PEERS_NUM);
+}
+
+static bool parallel_predicate(const void *global_state)
+{
+	ARG_UNUSED(global_state);
+
+	return CONFIG_BT_GATT_DM_MAX_INSTANCES > 1;
+}
+
+ZTEST_SUITE(gatt_dm_parallel, parallel_predicate, NULL, parallel_before, NULL, NULL);
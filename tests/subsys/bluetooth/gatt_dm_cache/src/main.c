@@ -0,0 +1,576 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <zephyr/bluetooth/bluetooth.h>
+#include <zephyr/bluetooth/conn.h>
+#include <zephyr/bluetooth/gatt.h>
+#include <zephyr/bluetooth/uuid.h>
+#include <zephyr/settings/settings.h>
+#include <zephyr/sys/byteorder.h>
+#include <bluetooth/gatt_dm.h>
+#include "../../gatt_dm/mock/gatt_discover_mock.h"
+
+#define PEERS_NUM (2)
+#define DB_HASH_SIZE (16)
+/* Simulated time of the Database Hash read */
+#define DB_HASH_READ_DELAY K_MSEC(5)
+#define DISCOVERY_TIMEOUT K_MSEC(2000)
+
+#define SETTINGS_ENTRIES_MAX (8)
+#define SETTINGS_KEY_MAX_LEN (40)
+#define SETTINGS_VAL_MAX_LEN (1024)
+
+struct peer {
+	/* Used as the connection object. */
+	char conn;
+	bt_addr_le_t addr;
+	bool bonded;
+	bool db_hash_present;
+	uint8_t db_hash[DB_HASH_SIZE];
+	struct bt_gatt_read_params *read_params;
+	struct k_work_delayable read_work;
+};
+
+/* Attribute data that does not depend on where the discovery manager stores it */
+struct attr_snapshot {
+	uint16_t handle;
+	uint8_t perm;
+	uint8_t uuid[BT_UUID_SIZE_128];
+	uint16_t end_handle;
+	uint16_t value_handle;
+	uint8_t properties;
+	uint8_t val_uuid[BT_UUID_SIZE_128];
+};
+
+struct result {
+	struct bt_gatt_dm *dm;
+	bool not_found;
+	int err;
+	size_t attr_cnt;
+	struct attr_snapshot attrs[CONFIG_BT_GATT_DM_MAX_ATTRS];
+};
+
+struct settings_entry {
+	char key[SETTINGS_KEY_MAX_LEN];
+	uint8_t val[SETTINGS_VAL_MAX_LEN];
+	size_t len;
+	bool used;
+};
+
+static struct peer peers[PEERS_NUM];
+static struct result result;
+static K_SEM_DEFINE(discovery_finished, 0, 1);
+
+static struct settings_entry settings_entries[SETTINGS_ENTRIES_MAX];
+static uint32_t settings_saves;
+static uint32_t db_hash_reads;
+
+static struct bt_conn_auth_info_cb *auth_info_cb;
+
+static const struct bt_gatt_attr peer_db[] = {
+	BT_GATT_DISCOVER_MOCK_SERV(1, BT_UUID_BAS, 4),
+	BT_GATT_DISCOVER_MOCK_CHRC(2, BT_UUID_BAS_BATTERY_LEVEL,
+				   BT_GATT_CHRC_READ | BT_GATT_CHRC_NOTIFY),
+	BT_GATT_DISCOVER_MOCK_DESC(3, BT_UUID_BAS_BATTERY_LEVEL),
+	BT_GATT_DISCOVER_MOCK_DESC(4, BT_UUID_GATT_CCC),
+
+	BT_GATT_DISCOVER_MOCK_SERV(5, BT_UUID_DIS, 0xffff),
+	BT_GATT_DISCOVER_MOCK_CHRC(6, BT_UUID_DIS_MODEL_NUMBER, BT_GATT_CHRC_READ),
+	BT_GATT_DISCOVER_MOCK_DESC(7, BT_UUID_DIS_MODEL_NUMBER),
+};
+
+/** Mocks ******************************************/
+
+static void uuid_to_128(const struct bt_uuid *uuid, uint8_t val[BT_UUID_SIZE_128])
+{
+	static const uint8_t base_uuid[] = {
+		BT_UUID_128_ENCODE(0x00000000, 0x0000, 0x1000, 0x8000, 0x00805F9B34FB)
+	};
+
+	memcpy(val, base_uuid, sizeof(base_uuid));
+
+	switch (uuid->type) {
+	case BT_UUID_TYPE_16:
+		sys_put_le16(BT_UUID_16(uuid)->val, &val[12]);
+		break;
+	case BT_UUID_TYPE_32:
+		sys_put_le32(BT_UUID_32(uuid)->val, &val[12]);
+		break;
+	case BT_UUID_TYPE_128:
+		memcpy(val, BT_UUID_128(uuid)->val, BT_UUID_SIZE_128);
+		break;
+	default:
+		zassert_unreachable("Invalid UUID type: %u", uuid->type);
+	}
+}
+
+int bt_uuid_cmp(const struct bt_uuid *u1, const struct bt_uuid *u2)
+{
+	uint8_t val1[BT_UUID_SIZE_128];
+	uint8_t val2[BT_UUID_SIZE_128];
+
+	uuid_to_128(u1, val1);
+	uuid_to_128(u2, val2);
+
+	return memcmp(val1, val2, sizeof(val1));
+}
+
+bool bt_uuid_create(struct bt_uuid *uuid, const uint8_t *data, uint8_t data_len)
+{
+	switch (data_len) {
+	case BT_UUID_SIZE_16:
+		uuid->type = BT_UUID_TYPE_16;
+		BT_UUID_16(uuid)->val = sys_get_le16(data);
+		return true;
+	case BT_UUID_SIZE_32:
+		uuid->type = BT_UUID_TYPE_32;
+		BT_UUID_32(uuid)->val = sys_get_le32(data);
+		return true;
+	case BT_UUID_SIZE_128:
+		uuid->type = BT_UUID_TYPE_128;
+		memcpy(BT_UUID_128(uuid)->val, data, BT_UUID_SIZE_128);
+		return true;
+	default:
+		return false;
+	}
+}
+
+int bt_conn_get_info(const struct bt_conn *conn, struct bt_conn_info *info)
+{
+	const struct peer *peer = (const struct peer *)conn;
+
+	memset(info, 0, sizeof(*info));
+	info->type = BT_CONN_TYPE_LE;
+	info->id = BT_ID_DEFAULT;
+	info->le.dst = &peer->addr;
+
+	return 0;
+}
+
+bool bt_addr_le_is_bonded(uint8_t id, const bt_addr_le_t *addr)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(peers); i++) {
+		if (bt_addr_le_eq(&peers[i].addr, addr)) {
+			return (id == BT_ID_DEFAULT) && peers[i].bonded;
+		}
+	}
+
+	return false;
+}
+
+int bt_conn_auth_info_cb_register(struct bt_conn_auth_info_cb *cb)
+{
+	auth_info_cb = cb;
+	return 0;
+}
+
+static void db_hash_read_work(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct peer *peer = CONTAINER_OF(dwork, struct peer, read_work);
+	struct bt_gatt_read_params *params = peer->read_params;
+
+	if (peer->db_hash_present) {
+		(void)params->func((struct bt_conn *)&peer->conn, 0, params, peer->db_hash,
+				   sizeof(peer->db_hash));
+	} else {
+		(void)params->func((struct bt_conn *)&peer->conn, BT_ATT_ERR_ATTRIBUTE_NOT_FOUND,
+				   params, NULL, 0);
+	}
+}
+
+int bt_gatt_read(struct bt_conn *conn, struct bt_gatt_read_params *params)
+{
+	struct peer *peer = (struct peer *)conn;
+
+	zassert_equal(params->handle_count, 0, "Not a read by UUID");
+	zassert_ok(bt_uuid_cmp(params->by_uuid.uuid, BT_UUID_GATT_DB_HASH), "Not a hash read");
+
+	db_hash_reads++;
+	peer->read_params = params;
+	k_work_schedule(&peer->read_work, DB_HASH_READ_DELAY);
+
+	return 0;
+}
+
+static struct settings_entry *settings_entry_find(const char *key)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(settings_entries); i++) {
+		if (settings_entries[i].used && !strcmp(settings_entries[i].key, key)) {
+			return &settings_entries[i];
+		}
+	}
+
+	return NULL;
+}
+
+int settings_save_one(const char *name, const void *value, size_t val_len)
+{
+	struct settings_entry *entry = settings_entry_find(name);
+
+	for (size_t i = 0; !entry && (i < ARRAY_SIZE(settings_entries)); i++) {
+		if (!settings_entries[i].used) {
+			entry = &settings_entries[i];
+		}
+	}
+
+	zassert_not_null(entry, "No space for %s", name);
+	zassert_true(strlen(name) < sizeof(entry->key), "Key too long: %s", name);
+	zassert_true(val_len <= sizeof(entry->val), "Value too long: %zu", val_len);
+
+	strcpy(entry->key, name);
+	memcpy(entry->val, value, val_len);
+	entry->len = val_len;
+	entry->used = true;
+	settings_saves++;
+
+	return 0;
+}
+
+int settings_delete(const char *name)
+{
+	struct settings_entry *entry = settings_entry_find(name);
+
+	if (entry) {
+		entry->used = false;
+	}
+
+	return 0;
+}
+
+static ssize_t settings_entry_read(void *cb_arg, void *data, size_t len)
+{
+	struct settings_entry *entry = cb_arg;
+
+	len = MIN(len, entry->len);
+	memcpy(data, entry->val, len);
+
+	return len;
+}
+
+int settings_load_subtree_direct(const char *subtree, settings_load_direct_cb cb, void *param)
+{
+	size_t subtree_len = strlen(subtree);
+
+	for (size_t i = 0; i < ARRAY_SIZE(settings_entries); i++) {
+		struct settings_entry *entry = &settings_entries[i];
+		const char *key;
+
+		if (!entry->used || strncmp(entry->key, subtree, subtree_len)) {
+			continue;
+		}
+
+		if (entry->key[subtree_len] == '\0') {
+			key = NULL;
+		} else if (entry->key[subtree_len] == '/') {
+			key = &entry->key[subtree_len + 1];
+		} else {
+			continue;
+		}
+
+		(void)cb(key, entry->len, settings_entry_read, entry, param);
+	}
+
+	return 0;
+}
+
+/** Test helpers ***********************************/
+
+static size_t settings_entries_cnt(const bt_addr_le_t *addr)
+{
+	char addr_str[16];
+	size_t cnt = 0;
+
+	snprintk(addr_str, sizeof(addr_str), "/%02x%02x%02x%02x%02x%02x%u/", addr->a.val[5],
+		 addr->a.val[4], addr->a.val[3], addr->a.val[2], addr->a.val[1], addr->a.val[0],
+		 addr->type);
+
+	for (size_t i = 0; i < ARRAY_SIZE(settings_entries); i++) {
+		if (settings_entries[i].used && strstr(settings_entries[i].key, addr_str)) {
+			cnt++;
+		}
+	}
+
+	return cnt;
+}
+
+static void result_snapshot(struct bt_gatt_dm *dm)
+{
+	const struct bt_gatt_dm_attr *attr = bt_gatt_dm_service_get(dm);
+
+	result.attr_cnt = bt_gatt_dm_attr_cnt(dm);
+	zassert_true(result.attr_cnt <= ARRAY_SIZE(result.attrs));
+
+	for (size_t i = 0; i < result.attr_cnt; i++, attr = bt_gatt_dm_attr_next(dm, attr)) {
+		struct attr_snapshot *snapshot = &result.attrs[i];
+		const struct bt_gatt_service_val *service_val;
+		const struct bt_gatt_chrc *chrc;
+
+		zassert_not_null(attr);
+
+		snapshot->handle = attr->handle;
+		snapshot->perm = attr->perm;
+		uuid_to_128(attr->uuid, snapshot->uuid);
+
+		service_val = bt_gatt_dm_attr_service_val(attr);
+		if (service_val) {
+			snapshot->end_handle = service_val->end_handle;
+			uuid_to_128(service_val->uuid, snapshot->val_uuid);
+		}
+
+		chrc = bt_gatt_dm_attr_chrc_val(attr);
+		if (chrc) {
+			snapshot->value_handle = chrc->value_handle;
+			snapshot->properties = chrc->properties;
+			uuid_to_128(chrc->uuid, snapshot->val_uuid);
+		}
+	}
+}
+
+static void test_cb_completed(struct bt_gatt_dm *dm, void *context)
+{
+	result.dm = dm;
+	result_snapshot(dm);
+	k_sem_give(&discovery_finished);
+}
+
+static void test_cb_service_not_found(struct bt_conn *conn, void *context)
+{
+	result.not_found = true;
+	k_sem_give(&discovery_finished);
+}
+
+static void test_cb_error_found(struct bt_conn *conn, int err, void *context)
+{
+	result.err = err;
+	k_sem_give(&discovery_finished);
+}
+
+static const struct bt_gatt_dm_cb test_cb = {
+	.completed         = test_cb_completed,
+	.service_not_found = test_cb_service_not_found,
+	.error_found       = test_cb_error_found,
+};
+
+static void result_wait(void)
+{
+	zassert_ok(k_sem_take(&discovery_finished, DISCOVERY_TIMEOUT), "Discovery did not finish");
+	zassert_ok(result.err, "Discovery failed: %d", result.err);
+}
+
+/* Runs the discovery and returns the time until the result is ready. */
+static int64_t discover(size_t peer_idx, const struct bt_uuid *svc_uuid)
+{
+	int64_t start = k_uptime_get();
+
+	memset(&result, 0, sizeof(result));
+	zassert_ok(bt_gatt_dm_start((struct bt_conn *)&peers[peer_idx].conn, svc_uuid, &test_cb,
+				    NULL));
+	result_wait();
+
+	return k_uptime_get() - start;
+}
+
+static void discover_next(void)
+{
+	struct bt_gatt_dm *dm = result.dm;
+
+	zassert_not_null(dm);
+	zassert_ok(bt_gatt_dm_data_release(dm));
+
+	memset(&result, 0, sizeof(result));
+	zassert_ok(bt_gatt_dm_continue(dm, NULL));
+	result_wait();
+}
+
+static void result_release(void)
+{
+	zassert_not_null(result.dm);
+	zassert_ok(bt_gatt_dm_data_release(result.dm));
+}
+
+static void result_expect(const struct result *expected)
+{
+	zassert_equal(result.not_found, expected->not_found);
+	zassert_equal(result.attr_cnt, expected->attr_cnt, "%zu attributes, expected %zu",
+		      result.attr_cnt, expected->attr_cnt);
+	zassert_mem_equal(result.attrs, expected->attrs,
+			  result.attr_cnt * sizeof(result.attrs[0]), "Wrong attributes");
+}
+
+static void *setup(void)
+{
+	zassert_not_null(auth_info_cb, "Bond deletion callback not registered");
+	zassert_not_null(auth_info_cb->bond_deleted);
+
+	return NULL;
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	for (size_t i = 0; i < ARRAY_SIZE(peers); i++) {
+		struct peer *peer = &peers[i];
+
+		peer->addr.type = BT_ADDR_LE_RANDOM;
+		memset(peer->addr.a.val, 0, sizeof(peer->addr.a.val));
+		peer->addr.a.val[0] = i + 1;
+		peer->addr.a.val[5] = 0xC0;
+		peer->bonded = true;
+		peer->db_hash_present = true;
+		memset(peer->db_hash, 0xA0 + i, sizeof(peer->db_hash));
+		k_work_init_delayable(&peer->read_work, db_hash_read_work);
+	}
+
+	memset(settings_entries, 0, sizeof(settings_entries));
+	settings_saves = 0;
+	db_hash_reads = 0;
+
+	k_sem_reset(&discovery_finished);
+	bt_gatt_discover_mock_setup(peer_db, ARRAY_SIZE(peer_db));
+}
+
+/* Reconnection to a bonded peer with an unchanged database uses the stored results. */
+ZTEST(gatt_dm_cache, test_reconnect_time)
+{
+	static struct result discovered;
+	int64_t discovery_time;
+	int64_t cached_time;
+
+	discovery_time = discover(0, BT_UUID_BAS);
+	discovered = result;
+	result_release();
+
+	zassert_equal(discovered.attr_cnt, 4);
+	zassert_equal(settings_saves, 1, "Results not stored");
+
+	cached_time = discover(0, BT_UUID_BAS);
+	result_expect(&discovered);
+	result_release();
+
+	TC_PRINT("Reconnect-to-ready: %lld ms with the discovery, %lld ms from the cache\n",
+		 (long long)discovery_time, (long long)cached_time);
+
+	zassert_equal(settings_saves, 1, "Services discovered again");
+	zassert_equal(db_hash_reads, 2);
+	zassert_true(cached_time < discovery_time, "No gain from the cache");
+}
+
+/* The services are discovered again if the Database Hash of the peer changed. */
+ZTEST(gatt_dm_cache, test_db_hash_changed)
+{
+	static struct result discovered;
+
+	(void)discover(0, BT_UUID_BAS);
+	discovered = result;
+	result_release();
+
+	peers[0].db_hash[0]++;
+
+	(void)discover(0, BT_UUID_BAS);
+	result_expect(&discovered);
+	result_release();
+	zassert_equal(settings_saves, 2, "Services not discovered again");
+
+	(void)discover(0, BT_UUID_BAS);
+	result_expect(&discovered);
+	result_release();
+	zassert_equal(settings_saves, 2, "Results not stored with the new hash");
+	zassert_equal(settings_entries_cnt(&peers[0].addr), 1);
+}
+
+/* Nothing is stored for peers that are not bonded or have no Database Hash. */
+ZTEST(gatt_dm_cache, test_not_stored)
+{
+	peers[0].bonded = false;
+	peers[1].db_hash_present = false;
+
+	for (size_t i = 0; i < 2; i++) {
+		(void)discover(0, BT_UUID_BAS);
+		zassert_equal(result.attr_cnt, 4);
+		result_release();
+
+		(void)discover(1, BT_UUID_BAS);
+		zassert_equal(result.attr_cnt, 4);
+		result_release();
+	}
+
+	zassert_equal(db_hash_reads, 2, "Hash read from a peer that is not bonded");
+	zassert_equal(settings_saves, 0);
+}
+
+/* The discovery of all services and of a missing service is stored as well. */
+ZTEST(gatt_dm_cache, test_continue_and_not_found)
+{
+	static struct result discovered[2];
+
+	for (size_t pass = 0; pass < 2; pass++) {
+		(void)discover(0, NULL);
+		if (pass == 0) {
+			discovered[0] = result;
+		}
+		result_expect(&discovered[0]);
+
+		discover_next();
+		if (pass == 0) {
+			discovered[1] = result;
+		}
+		result_expect(&discovered[1]);
+
+		discover_next();
+		zassert_true(result.not_found);
+
+		(void)discover(0, BT_UUID_HRS);
+		zassert_true(result.not_found);
+	}
+
+	zassert_equal(discovered[0].attr_cnt, 4);
+	zassert_equal(discovered[1].attr_cnt, 3);
+	zassert_equal(settings_saves, 3, "Results of the second pass not restored");
+}
+
+/* The stored results of a peer are deleted together with its bond. */
+ZTEST(gatt_dm_cache, test_bond_deleted)
+{
+	(void)discover(0, BT_UUID_BAS);
+	result_release();
+	(void)discover(0, BT_UUID_DIS);
+	result_release();
+	(void)discover(1, BT_UUID_BAS);
+	result_release();
+
+	zassert_equal(settings_entries_cnt(&peers[0].addr), 2);
+	zassert_equal(settings_entries_cnt(&peers[1].addr), 1);
+
+	auth_info_cb->bond_deleted(BT_ID_DEFAULT, &peers[0].addr);
+
+	zassert_equal(settings_entries_cnt(&peers[0].addr), 0);
+	zassert_equal(settings_entries_cnt(&peers[1].addr), 1);
+
+	(void)discover(0, BT_UUID_BAS);
+	result_release();
+	zassert_equal(settings_saves, 4, "Deleted results restored");
+}
+
+/* The stored results are read on demand, not with the rest of the Bluetooth settings. */
+ZTEST(gatt_dm_cache, test_settings_handler)
+{
+	const struct settings_handler_static *handler = NULL;
+
+	STRUCT_SECTION_FOREACH(settings_handler_static, h) {
+		if (!strcmp(h->name, "bt/dm")) {
+			handler = h;
+		}
+	}
+
+	zassert_not_null(handler, "No settings handler for the stored results");
+	zassert_ok(handler->h_set("1/c00000000001/0123abcd", 0, NULL, NULL));
+}
+
+ZTEST_SUITE(gatt_dm_cache, NULL, setup, before, NULL, NULL);
@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <errno.h>
+#include <string.h>
+
+#include <nrf_rpc_cbor.h>
+#include <nrf_rpc/nrf_rpc_serialize.h>
+
+#include <bt_rpc_common.h>
+#include <bt_rpc_gatt_common.h>
+
+/* ATT_MTU 23 leaves 22 bytes for a Read Response and each Read Blob Response. */
+#define READ_LEN 22
+#define REPORT_MAP_LEN 100
+#define DEVICE_NAME_LEN 12
+#define PEERS_NUM 3
+
+static struct bt_uuid test_uuid = {.type = 0x20};
+
+static struct bt_gatt_attr test_attrs[] = {
+	{.uuid = &test_uuid},
+	{.uuid = &test_uuid},
+	{.uuid = &test_uuid},
+};
+
+static struct bt_gatt_service test_svc = {
+	.attrs = test_attrs,
+	.attr_count = ARRAY_SIZE(test_attrs),
+};
+
+static uint8_t report_map[REPORT_MAP_LEN];
+static const uint8_t device_name[DEVICE_NAME_LEN] = "Test device";
+
+/* Number of reads forwarded to the application core. */
+static int rpc_calls;
+
+/* Read callback of the attributes on the client. */
+static ssize_t client_attr_read(const struct bt_gatt_attr *attr, void *buf, uint16_t len,
+				uint16_t offset)
+{
+	const uint8_t *value = (attr == &test_attrs[1]) ? report_map : device_name;
+	uint16_t value_len = (attr == &test_attrs[1]) ? REPORT_MAP_LEN : DEVICE_NAME_LEN;
+
+	rpc_calls++;
+
+	if (offset > value_len) {
+		return BT_GATT_ERR(BT_ATT_ERR_INVALID_OFFSET);
+	}
+
+	len = MIN(len, value_len - offset);
+	memcpy(buf, value + offset, len);
+
+	return len;
+}
+
+/* Handles the reads forwarded by the host, like the client does. */
+static void client_attr_read_rpc_handler(const struct nrf_rpc_group *group,
+					 struct nrf_rpc_cbor_ctx *ctx, void *handler_data)
+{
+	struct nrf_rpc_scratchpad scratchpad;
+	struct nrf_rpc_cbor_ctx ectx;
+	const struct bt_gatt_attr *attr;
+	uint16_t len;
+	uint16_t offset;
+	ssize_t read_len;
+	uint8_t *buf;
+
+	NRF_RPC_SCRATCHPAD_DECLARE(&scratchpad, ctx);
+
+	bt_rpc_decode_bt_conn(ctx);
+	attr = bt_rpc_decode_gatt_attr(ctx);
+	len = nrf_rpc_decode_uint(ctx);
+	offset = nrf_rpc_decode_uint(ctx);
+
+	zassert_true(nrf_rpc_decoding_done_and_check(group, ctx), "Decoding failed");
+	zassert_not_null(attr, "Unknown attribute");
+
+	buf = nrf_rpc_scratchpad_add(&scratchpad, len);
+	read_len = client_attr_read(attr, buf, len, offset);
+
+	NRF_RPC_CBOR_ALLOC(group, ectx, NRF_RPC_CBOR_INT_MAX_SIZE(int32_t) +
+				      NRF_RPC_CBOR_BUFFER_SIZE((read_len > 0) ? read_len : 0));
+
+	nrf_rpc_encode_int(&ectx, read_len);
+	nrf_rpc_encode_buffer(&ectx, buf, (read_len > 0) ? read_len : 0);
+
+	nrf_rpc_cbor_rsp_no_err(group, &ectx);
+}
+
+NRF_RPC_CBOR_CMD_DECODER(bt_rpc_grp, client_attr_read_cb, BT_RPC_GATT_CB_ATTR_READ_RPC_CMD,
+			 client_attr_read_rpc_handler, NULL);
+
+/* Read callback of the client attributes on the host. */
+static ssize_t host_attr_read(const struct bt_gatt_attr *attr, void *buf, uint16_t len,
+			      uint16_t offset)
+{
+	return bt_rpc_normal_attr_read(NULL, attr, buf, len, offset);
+}
+
+/* Read a value the way a GATT client does: Read Request followed by Read Blob Requests. */
+static void long_read(const struct bt_gatt_attr *attr, uint8_t *out, uint16_t value_len)
+{
+	uint16_t offset = 0;
+	ssize_t read_len;
+
+	do {
+		read_len = host_attr_read(attr, out + offset, READ_LEN, offset);
+		zassert_true(read_len >= 0, "Read failed: %d", (int)read_len);
+		offset += read_len;
+	} while (read_len == READ_LEN);
+
+	zassert_equal(offset, value_len, "Read %u bytes, expected %u", offset, value_len);
+}
+
+/* Each peer reads the device name and the report map after the discovery. */
+static int discovery_rpc_calls(void)
+{
+	uint8_t value[REPORT_MAP_LEN];
+
+	rpc_calls = 0;
+
+	for (int peer = 0; peer < PEERS_NUM; peer++) {
+		long_read(&test_attrs[0], value, DEVICE_NAME_LEN);
+		zassert_mem_equal(value, device_name, DEVICE_NAME_LEN);
+
+		long_read(&test_attrs[1], value, REPORT_MAP_LEN);
+		zassert_mem_equal(value, report_map, REPORT_MAP_LEN);
+	}
+
+	return rpc_calls;
+}
+
+static void *attr_cache_setup(void)
+{
+	for (size_t i = 0; i < sizeof(report_map); i++) {
+		report_map[i] = i;
+	}
+
+	return NULL;
+}
+
+static void attr_cache_before(void *fixture)
+{
+	uint32_t svc_index;
+
+	ARG_UNUSED(fixture);
+
+	zassert_ok(bt_rpc_gatt_add_service(&test_svc, &svc_index));
+}
+
+static void attr_cache_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	bt_rpc_gatt_value_cache_remove_service(&test_svc);
+	bt_rpc_gatt_remove_service(&test_svc);
+}
+
+ZTEST(bt_rpc_gatt_attr_cache, test_fewer_rpc_calls_per_discovery)
+{
+	int uncached;
+	int cached;
+
+	uncached = discovery_rpc_calls();
+
+	zassert_ok(bt_rpc_gatt_value_cache_set(&test_attrs[0], device_name, DEVICE_NAME_LEN));
+	zassert_ok(bt_rpc_gatt_value_cache_set(&test_attrs[1], report_map, REPORT_MAP_LEN));
+
+	cached = discovery_rpc_calls();
+
+	TC_PRINT("RPC calls for %d peers: %d without cache, %d with cache\n", PEERS_NUM, uncached,
+		 cached);
+
+	zassert_equal(uncached, PEERS_NUM * (1 + DIV_ROUND_UP(REPORT_MAP_LEN + 1, READ_LEN)));
+	zassert_equal(cached, 0, "Cached reads must not be forwarded to the client");
+}
+
+ZTEST(bt_rpc_gatt_attr_cache, test_invalidate)
+{
+	uint8_t value[REPORT_MAP_LEN];
+
+	zassert_ok(bt_rpc_gatt_value_cache_set(&test_attrs[1], report_map, REPORT_MAP_LEN));
+
+	/* The application updates the value and invalidates the cached one. */
+	report_map[0] ^= 0xff;
+	bt_rpc_gatt_value_cache_remove(&test_attrs[1]);
+
+	rpc_calls = 0;
+	long_read(&test_attrs[1], value, REPORT_MAP_LEN);
+	zassert_mem_equal(value, report_map, REPORT_MAP_LEN, "Stale value served");
+	zassert_true(rpc_calls > 0, "Read not forwarded after invalidation");
+
+	report_map[0] ^= 0xff;
+}
+
+ZTEST(bt_rpc_gatt_attr_cache, test_update_and_offsets)
+{
+	uint8_t buf[READ_LEN];
+	const uint8_t updated[] = {1, 2, 3};
+
+	zassert_ok(bt_rpc_gatt_value_cache_set(&test_attrs[2], device_name, DEVICE_NAME_LEN));
+	zassert_ok(bt_rpc_gatt_value_cache_set(&test_attrs[2], updated, sizeof(updated)));
+
+	zassert_equal(host_attr_read(&test_attrs[2], buf, sizeof(buf), 0), sizeof(updated));
+	zassert_mem_equal(buf, updated, sizeof(updated));
+	zassert_equal(host_attr_read(&test_attrs[2], buf, sizeof(buf), 1), sizeof(updated) - 1);
+	zassert_equal(host_attr_read(&test_attrs[2], buf, sizeof(buf), sizeof(updated)), 0);
+	zassert_equal(host_attr_read(&test_attrs[2], buf, sizeof(buf), sizeof(updated) + 1),
+		      BT_GATT_ERR(BT_ATT_ERR_INVALID_OFFSET));
+}
+
+ZTEST(bt_rpc_gatt_attr_cache, test_limits)
+{
+	static struct bt_gatt_attr attrs[CONFIG_BT_RPC_GATT_ATTR_CACHE_ENTRIES + 1];
+	static uint8_t big[CONFIG_BT_RPC_GATT_ATTR_CACHE_SIZE];
+	uint8_t value = 0;
+
+	zassert_equal(bt_rpc_gatt_value_cache_set(&attrs[0], big, sizeof(big)), -ENOMEM);
+
+	for (size_t i = 0; i < CONFIG_BT_RPC_GATT_ATTR_CACHE_ENTRIES; i++) {
+		zassert_ok(bt_rpc_gatt_value_cache_set(&attrs[i], &value, sizeof(value)));
+	}
+
+	zassert_equal(bt_rpc_gatt_value_cache_set(&attrs[ARRAY_SIZE(attrs) - 1], &value,
+						  sizeof(value)),
+		      -ENOMEM);
+
+	for (size_t i = 0; i < ARRAY_SIZE(attrs); i++) {
+		bt_rpc_gatt_value_cache_remove(&attrs[i]);
+	}
+}
+
+ZTEST_SUITE(bt_rpc_gatt_attr_cache, NULL, attr_cache_setup, attr_cache_before,
+	    attr_cache_after, NULL);
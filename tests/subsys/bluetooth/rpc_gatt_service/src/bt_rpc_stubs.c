@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ *
+ * Stub implementation of the parts of the BT RPC stack and the Bluetooth host
+ * used by the GATT code under test.
+ */
+
+#include <string.h>
+
+#include <mock_nrf_rpc_loopback.h>
+#include <nrf_rpc/nrf_rpc_serialize.h>
+
+#include <bt_rpc_common.h>
+#include <bt_rpc_gatt_common.h>
+
+/* The image acts as both the host and the client of the group. */
+NRF_RPC_GROUP_DEFINE(bt_rpc_grp, "bt_rpc", &mock_nrf_rpc_loopback_tr, NULL, NULL, NULL);
+
+void bt_rpc_encode_bt_conn(struct nrf_rpc_cbor_ctx *ctx, const struct bt_conn *conn)
+{
+	ARG_UNUSED(conn);
+
+	nrf_rpc_encode_null(ctx);
+}
+
+struct bt_conn *bt_rpc_decode_bt_conn(struct nrf_rpc_cbor_ctx *ctx)
+{
+	nrf_rpc_decode_is_null(ctx);
+
+	return NULL;
+}
+
+/* Attributes are looked up in the service pool, like on the client and the host. */
+void bt_rpc_encode_gatt_attr(struct nrf_rpc_cbor_ctx *ctx, const struct bt_gatt_attr *attr)
+{
+	uint32_t attr_index;
+
+	if (bt_rpc_gatt_attr_to_index(attr, &attr_index)) {
+		nrf_rpc_encoder_invalid(ctx);
+		return;
+	}
+
+	nrf_rpc_encode_uint(ctx, attr_index);
+}
+
+const struct bt_gatt_attr *bt_rpc_decode_gatt_attr(struct nrf_rpc_cbor_ctx *ctx)
+{
+	return bt_rpc_gatt_index_to_attr(nrf_rpc_decode_uint(ctx));
+}
+
+ssize_t bt_gatt_attr_read(struct bt_conn *conn, const struct bt_gatt_attr *attr, void *buf,
+			  uint16_t buf_len, uint16_t offset, const void *value, uint16_t value_len)
+{
+	uint16_t len;
+
+	if (offset > value_len) {
+		return BT_GATT_ERR(BT_ATT_ERR_INVALID_OFFSET);
+	}
+
+	len = MIN(buf_len, value_len - offset);
+	memcpy(buf, (const uint8_t *)value + offset, len);
+
+	return len;
+}
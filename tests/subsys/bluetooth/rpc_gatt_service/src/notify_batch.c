@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <errno.h>
+#include <string.h>
+
+#include <nrf_rpc_cbor.h>
+#include <nrf_rpc/nrf_rpc_serialize.h>
+#include <zcbor_decode.h>
+#include <zcbor_encode.h>
+
+#include <bt_rpc_gatt_common.h>
+
+#define BATCH_MAX CONFIG_BT_RPC_GATT_NOTIFY_BATCH_MAX
+#define VALUE_LEN 20
+#define ENCODE_BUF_SIZE 512
+/* Upper bound of top-level CBOR items in a batch. */
+#define DECODE_ITEMS_MAX 64
+
+static struct bt_uuid_16 notify_uuid = BT_UUID_INIT_16(0x2a37);
+static struct bt_gatt_attr notify_attrs[BATCH_MAX + 1];
+static struct bt_gatt_service notify_svc = {
+	.attrs = notify_attrs,
+	.attr_count = ARRAY_SIZE(notify_attrs),
+};
+static uint8_t values[BATCH_MAX + 1][VALUE_LEN];
+static struct bt_gatt_notify_params params[BATCH_MAX + 1];
+static uint8_t encode_buf[ENCODE_BUF_SIZE];
+
+/* Number of notifications sent, and the index of the one that fails, if any. */
+static int notify_count;
+static int notify_fail_at;
+
+/* Stands for bt_gatt_notify_cb() on the host. */
+static int notify(struct bt_conn *conn, struct bt_gatt_notify_params *decoded)
+{
+	const struct bt_gatt_notify_params *sent = &params[notify_count];
+
+	zassert_is_null(conn);
+	zassert_equal_ptr(decoded->attr, sent->attr, "Notification %d out of order",
+			  notify_count);
+	zassert_equal(decoded->len, sent->len);
+	zassert_mem_equal(decoded->data, sent->data, sent->len);
+	zassert_is_null(decoded->func);
+	zassert_equal_ptr(decoded->user_data, sent->user_data);
+
+	if (sent->uuid) {
+		zassert_not_null(decoded->uuid);
+		zassert_mem_equal(decoded->uuid, sent->uuid, sizeof(struct bt_uuid_16));
+	} else {
+		zassert_is_null(decoded->uuid);
+	}
+
+	return (notify_count++ == notify_fail_at) ? -ENOMEM : 0;
+}
+
+/* Encode a batch like the client and decode it like the host, which sends the notifications. */
+static bool batch_round_trip(uint16_t num_params, int *result, uint16_t *failed)
+{
+	struct nrf_rpc_cbor_ctx ctx;
+	struct nrf_rpc_scratchpad scratchpad;
+	size_t scratchpad_size = 0;
+	size_t buffer_size_max = NRF_RPC_CBOR_UINT_SIZE(num_params);
+	size_t len;
+
+	for (uint16_t i = 0; i < num_params; i++) {
+		buffer_size_max += bt_rpc_gatt_notify_params_buf_size(&params[i]);
+		scratchpad_size += bt_rpc_gatt_notify_params_sp_size(&params[i]);
+	}
+
+	buffer_size_max += NRF_RPC_CBOR_UINT_SIZE(scratchpad_size);
+
+	zcbor_new_encode_state(ctx.zs, ARRAY_SIZE(ctx.zs), encode_buf, sizeof(encode_buf), 0);
+	nrf_rpc_encode_uint(&ctx, scratchpad_size);
+	bt_rpc_gatt_notify_batch_enc(&ctx, num_params, params);
+
+	zassert_true(zcbor_check_error(ctx.zs), "Encoding failed");
+	len = ctx.zs[0].payload_mut - encode_buf;
+	zassert_true(len <= buffer_size_max, "Encoded %zu bytes, reserved %zu", len,
+		     buffer_size_max);
+
+	zcbor_new_decode_state(ctx.zs, ARRAY_SIZE(ctx.zs), encode_buf, len, DECODE_ITEMS_MAX, NULL,
+			       0);
+
+	NRF_RPC_SCRATCHPAD_DECLARE(&scratchpad, &ctx);
+
+	bt_rpc_gatt_notify_batch_dec(&scratchpad, NULL, NULL, notify, result, failed);
+
+	return nrf_rpc_decode_valid(&ctx);
+}
+
+static void *notify_batch_setup(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(params); i++) {
+		memset(values[i], i, VALUE_LEN);
+
+		params[i].attr = &notify_attrs[i];
+		params[i].data = values[i];
+		params[i].len = VALUE_LEN - i;
+		params[i].user_data = (void *)(uintptr_t)(0x100 + i);
+		/* Only some notifications select the characteristic by UUID. */
+		params[i].uuid = (i % 2) ? &notify_uuid.uuid : NULL;
+	}
+
+	return NULL;
+}
+
+static void notify_batch_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	uint32_t svc_index;
+
+	notify_count = 0;
+	notify_fail_at = -1;
+
+	zassert_ok(bt_rpc_gatt_add_service(&notify_svc, &svc_index));
+}
+
+static void notify_batch_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	bt_rpc_gatt_remove_service(&notify_svc);
+}
+
+ZTEST(bt_rpc_gatt_notify_batch, test_round_trip)
+{
+	int result;
+	uint16_t failed;
+
+	for (uint16_t num_params = 1; num_params <= BATCH_MAX; num_params++) {
+		notify_count = 0;
+
+		zassert_true(batch_round_trip(num_params, &result, &failed), "Decoding failed");
+		zassert_equal(notify_count, num_params);
+		zassert_ok(result);
+		zassert_equal(failed, 0);
+	}
+}
+
+/* The asynchronous batch reports the error and the number of failed notifications back. */
+ZTEST(bt_rpc_gatt_notify_batch, test_stop_at_first_failure)
+{
+	int result;
+	uint16_t failed;
+
+	notify_fail_at = 1;
+
+	zassert_true(batch_round_trip(BATCH_MAX, &result, &failed), "Decoding failed");
+	zassert_equal(notify_count, notify_fail_at + 1, "Notifications sent after a failure");
+	zassert_equal(result, -ENOMEM);
+	zassert_equal(failed, BATCH_MAX - notify_fail_at);
+}
+
+ZTEST(bt_rpc_gatt_notify_batch, test_too_many_entries)
+{
+	int result;
+	uint16_t failed;
+
+	zassert_false(batch_round_trip(BATCH_MAX + 1, &result, &failed),
+		      "Batch larger than the host limit accepted");
+	zassert_equal(notify_count, 0);
+}
+
+ZTEST_SUITE(bt_rpc_gatt_notify_batch, NULL, notify_batch_setup, notify_batch_before,
+	    notify_batch_after, NULL);
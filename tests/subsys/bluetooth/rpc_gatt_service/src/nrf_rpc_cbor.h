@@ -1,16 +0,0 @@
-/*
- * Copyright (c) 2025 Nordic Semiconductor ASA
- *
- * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
- *
- * Stub header for nRF RPC CBOR types needed for unit testing
- */
-
-#ifndef NRF_RPC_CBOR_H_
-#define NRF_RPC_CBOR_H_
-
-/* Forward declaration - full definition not needed for unit testing */
-struct nrf_rpc_cbor_ctx;
-
-
-#endif /* NRF_RPC_CBOR_H_ */
@@ -24,4 +24,24 @@
 #endif
 #define CONFIG_BT_RPC_LOG_LEVEL 4
 
+#ifdef CONFIG_BT_RPC_GATT_ATTR_CACHE
+#undef CONFIG_BT_RPC_GATT_ATTR_CACHE
+#endif
+#define CONFIG_BT_RPC_GATT_ATTR_CACHE 1
+
+#ifdef CONFIG_BT_RPC_GATT_ATTR_CACHE_ENTRIES
+#undef CONFIG_BT_RPC_GATT_ATTR_CACHE_ENTRIES
+#endif
+#define CONFIG_BT_RPC_GATT_ATTR_CACHE_ENTRIES 4
+
+#ifdef CONFIG_BT_RPC_GATT_ATTR_CACHE_SIZE
+#undef CONFIG_BT_RPC_GATT_ATTR_CACHE_SIZE
+#endif
+#define CONFIG_BT_RPC_GATT_ATTR_CACHE_SIZE 512
+
+#ifdef CONFIG_BT_RPC_GATT_NOTIFY_BATCH_MAX
+#undef CONFIG_BT_RPC_GATT_NOTIFY_BATCH_MAX
+#endif
+#define CONFIG_BT_RPC_GATT_NOTIFY_BATCH_MAX 4
+
 #endif /* TEST_CONFIG_H_ */
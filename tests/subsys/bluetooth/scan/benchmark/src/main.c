@@ -0,0 +1,449 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/bluetooth/bluetooth.h>
+#include <zephyr/bluetooth/conn.h>
+#include <zephyr/bluetooth/hci_types.h>
+#include <zephyr/bluetooth/uuid.h>
+#include <zephyr/sys/byteorder.h>
+#include <bluetooth/scan.h>
+
+#include <stdio.h>
+
+/* Number of advertisers in the simulated environment. */
+#define DEVICES_NUM (256)
+/* Number of reports in the stream, in the order they are received. */
+#define REPORTS_NUM (4096)
+/* Number of times the stream is fed through the library in a single run. */
+#define STREAM_PASSES (25)
+#define AD_MAX_LEN (31)
+/* Number of devices added to the blocklist and to the connection attempts filter.
+ * Only a few of them are present in the stream, which is the common case.
+ */
+#define DEVICE_FILTER_LEN (32)
+#define BLOCKED_DEVICE (0)
+#define EXCEEDED_DEVICE (4)
+#define NAMED_DEVICE (42)
+
+#define APPLE_COMPANY_ID (0x004C)
+#define EDDYSTONE_UUID (0xFEAA)
+#define SENSOR_UUID (0x181A)
+#define VENDOR_UUID_VAL                                                                            \
+	BT_UUID_128_ENCODE(0x6e400001, 0xb5a3, 0xf393, 0xe0a9, 0xe50e24dcca9e)
+#define OTHER_UUID_VAL                                                                             \
+	BT_UUID_128_ENCODE(0x6e400001, 0xb5a3, 0xf393, 0xe0a9, 0xe50e24dcca9f)
+
+/* Kinds of the advertisers, assigned by the device index. */
+enum device_kind {
+	DEVICE_IBEACON,
+	DEVICE_EDDYSTONE,
+	DEVICE_SENSOR,
+	DEVICE_VENDOR,
+
+	DEVICE_KIND_NUM,
+};
+
+enum report_result {
+	REPORT_NO_MATCH,
+	REPORT_MATCH,
+	REPORT_IGNORED,
+};
+
+struct device {
+	struct bt_le_scan_recv_info info;
+	bt_addr_le_t addr;
+	uint8_t ad[AD_MAX_LEN];
+	uint8_t ad_len;
+};
+
+struct bench_result {
+	uint32_t match;
+	uint32_t no_match;
+};
+
+/* Host clock provided by the native simulator runner. */
+uint64_t host_clock_ns(void);
+
+static struct device devices[DEVICES_NUM];
+static uint16_t stream[REPORTS_NUM];
+static bt_addr_le_t absent_addr[DEVICE_FILTER_LEN];
+static struct bench_result counters;
+
+static const uint8_t ibeacon_prefix[] = {
+	BT_BYTES_LIST_LE16(APPLE_COMPANY_ID), 0x02, 0x15,
+};
+static const uint8_t vendor_uuid[] = { VENDOR_UUID_VAL };
+static const uint8_t other_uuid[] = { OTHER_UUID_VAL };
+
+/** Mocks ******************************************/
+
+static struct bt_le_scan_cb *scan_cb;
+static struct bt_conn_cb *conn_cb;
+
+int bt_le_scan_cb_register(struct bt_le_scan_cb *cb)
+{
+	scan_cb = cb;
+	return 0;
+}
+
+int bt_le_scan_start(const struct bt_le_scan_param *param, bt_le_scan_cb_t cb)
+{
+	return 0;
+}
+
+int bt_le_scan_stop(void)
+{
+	return 0;
+}
+
+int bt_conn_cb_register(struct bt_conn_cb *cb)
+{
+	conn_cb = cb;
+	return 0;
+}
+
+/* The benchmark uses peer addresses as connection objects. */
+const bt_addr_le_t *bt_conn_get_dst(const struct bt_conn *conn)
+{
+	return (const bt_addr_le_t *)conn;
+}
+
+/** Report stream **********************************/
+
+static uint32_t rand_state = 0x12345678;
+
+static uint32_t rand_next(void)
+{
+	/* xorshift32, so that the stream is the same on every run. */
+	rand_state ^= rand_state << 13;
+	rand_state ^= rand_state >> 17;
+	rand_state ^= rand_state << 5;
+
+	return rand_state;
+}
+
+static void addr_random_get(bt_addr_le_t *addr)
+{
+	addr->type = BT_ADDR_LE_RANDOM;
+	sys_put_le32(rand_next(), &addr->a.val[0]);
+	sys_put_le16(rand_next(), &addr->a.val[4]);
+
+	/* Static random address. */
+	addr->a.val[5] |= 0xC0;
+}
+
+static void ad_put(struct device *dev, uint8_t type, const void *data, uint8_t len)
+{
+	__ASSERT_NO_MSG(dev->ad_len + len + 2 <= sizeof(dev->ad));
+
+	dev->ad[dev->ad_len++] = len + 1;
+	dev->ad[dev->ad_len++] = type;
+	memcpy(&dev->ad[dev->ad_len], data, len);
+	dev->ad_len += len;
+}
+
+static enum device_kind device_kind(size_t idx)
+{
+	return idx % DEVICE_KIND_NUM;
+}
+
+static bool vendor_uuid_advertised(size_t idx)
+{
+	return ((idx / DEVICE_KIND_NUM) % 2) == 0;
+}
+
+static void device_init(size_t idx)
+{
+	struct device *dev = &devices[idx];
+	uint8_t flags = BT_LE_AD_GENERAL | BT_LE_AD_NO_BREDR;
+	uint8_t data[AD_MAX_LEN];
+	int len;
+
+	addr_random_get(&dev->addr);
+	dev->info.addr = &dev->addr;
+	dev->info.rssi = -(int8_t)(40 + (rand_next() % 50));
+	dev->info.adv_type = BT_GAP_ADV_TYPE_ADV_IND;
+	dev->info.adv_props = BT_GAP_ADV_PROP_CONNECTABLE | BT_GAP_ADV_PROP_SCANNABLE;
+	dev->ad_len = 0;
+
+	ad_put(dev, BT_DATA_FLAGS, &flags, sizeof(flags));
+
+	switch (device_kind(idx)) {
+	case DEVICE_IBEACON:
+		/* Prefix, proximity UUID, major, minor and measured power. */
+		memcpy(data, ibeacon_prefix, sizeof(ibeacon_prefix));
+		memcpy(&data[4], vendor_uuid, sizeof(vendor_uuid));
+		sys_put_be16(1, &data[20]);
+		sys_put_be16(idx, &data[22]);
+		data[24] = 0xC5;
+		dev->info.adv_props = 0;
+		ad_put(dev, BT_DATA_MANUFACTURER_DATA, data, 25);
+		break;
+
+	case DEVICE_EDDYSTONE:
+		/* UID frame: frame type, ranging data, namespace and instance. */
+		sys_put_le16(EDDYSTONE_UUID, data);
+		ad_put(dev, BT_DATA_UUID16_ALL, data, sizeof(uint16_t));
+		data[2] = 0x00;
+		data[3] = 0xEE;
+		for (size_t i = 4; i < 20; i++) {
+			data[i] = rand_next();
+		}
+		dev->info.adv_props = 0;
+		ad_put(dev, BT_DATA_SVC_DATA16, data, 20);
+		break;
+
+	case DEVICE_SENSOR:
+		len = snprintf((char *)data, sizeof(data), "Sensor-%03u", (unsigned int)idx);
+		ad_put(dev, BT_DATA_NAME_COMPLETE, data, len);
+		sys_put_le16(BT_UUID_BAS_VAL, &data[0]);
+		sys_put_le16(SENSOR_UUID, &data[2]);
+		ad_put(dev, BT_DATA_UUID16_ALL, data, 2 * sizeof(uint16_t));
+		sys_put_le16(BT_APPEARANCE_GENERIC_SENSOR, data);
+		ad_put(dev, BT_DATA_GAP_APPEARANCE, data, sizeof(uint16_t));
+		break;
+
+	case DEVICE_VENDOR:
+		ad_put(dev, BT_DATA_UUID128_ALL,
+		       vendor_uuid_advertised(idx) ? vendor_uuid : other_uuid,
+		       sizeof(vendor_uuid));
+		ad_put(dev, BT_DATA_NAME_SHORTENED, "Dev", 3);
+		break;
+
+	default:
+		break;
+	}
+}
+
+static void stream_init(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(devices); i++) {
+		device_init(i);
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(absent_addr); i++) {
+		addr_random_get(&absent_addr[i]);
+	}
+
+	/* Every device advertises at least once, the rest of the reports come
+	 * from randomly selected devices.
+	 */
+	for (size_t i = 0; i < ARRAY_SIZE(stream); i++) {
+		stream[i] = (i < ARRAY_SIZE(devices)) ? i : (rand_next() % ARRAY_SIZE(devices));
+	}
+
+	for (size_t i = ARRAY_SIZE(stream) - 1; i > 0; i--) {
+		size_t j = rand_next() % (i + 1);
+		uint16_t tmp = stream[i];
+
+		stream[i] = stream[j];
+		stream[j] = tmp;
+	}
+}
+
+/** Benchmark **************************************/
+
+static void filter_match(struct bt_scan_device_info *device_info,
+			 struct bt_scan_filter_match *filter_match, bool connectable)
+{
+	counters.match++;
+}
+
+static void filter_no_match(struct bt_scan_device_info *device_info, bool connectable)
+{
+	counters.no_match++;
+}
+
+BT_SCAN_CB_INIT(scan_cb_data, filter_match, filter_no_match, NULL, NULL);
+
+static void device_filters_fill(void)
+{
+	struct bt_conn *conn;
+
+	/* Disconnections of a device exceed the connection attempts count. */
+	for (size_t i = 0; i < CONFIG_BT_SCAN_CONN_ATTEMPTS_COUNT; i++) {
+		conn = (struct bt_conn *)&devices[EXCEEDED_DEVICE].addr;
+		conn_cb->connected(conn, 0);
+		conn_cb->disconnected(conn, BT_HCI_ERR_REMOTE_USER_TERM_CONN);
+	}
+
+	zassert_ok(bt_scan_blocklist_device_add(&devices[BLOCKED_DEVICE].addr));
+
+	for (size_t i = 1; i < ARRAY_SIZE(absent_addr); i++) {
+		zassert_ok(bt_scan_blocklist_device_add(&absent_addr[i]));
+
+		conn = (struct bt_conn *)&absent_addr[i];
+		conn_cb->connected(conn, 0);
+	}
+}
+
+static enum report_result expect_no_match(size_t idx)
+{
+	ARG_UNUSED(idx);
+
+	return REPORT_NO_MATCH;
+}
+
+static enum report_result expect_any_mode(size_t idx)
+{
+	switch (device_kind(idx)) {
+	case DEVICE_IBEACON:
+		return REPORT_MATCH;
+
+	case DEVICE_EDDYSTONE:
+		/* Only the devices on the address filter. */
+		return (idx < (2 * DEVICE_KIND_NUM)) ? REPORT_MATCH : REPORT_NO_MATCH;
+
+	case DEVICE_SENSOR:
+		return REPORT_MATCH;
+
+	case DEVICE_VENDOR:
+		return vendor_uuid_advertised(idx) ? REPORT_MATCH : REPORT_NO_MATCH;
+
+	default:
+		return REPORT_NO_MATCH;
+	}
+}
+
+static enum report_result expect_all_mode(size_t idx)
+{
+	return (idx == NAMED_DEVICE) ? REPORT_MATCH : REPORT_NO_MATCH;
+}
+
+static void bench_run(const char *name, bool device_filters,
+		      enum report_result (*expect)(size_t idx))
+{
+	struct bench_result expected = {0};
+	struct net_buf_simple ad;
+	uint64_t start;
+	uint64_t elapsed;
+	uint32_t reports = REPORTS_NUM * STREAM_PASSES;
+
+	for (size_t i = 0; i < ARRAY_SIZE(stream); i++) {
+		size_t idx = stream[i];
+		enum report_result result = expect(idx);
+
+		if (device_filters && ((idx == BLOCKED_DEVICE) || (idx == EXCEEDED_DEVICE))) {
+			result = REPORT_IGNORED;
+		}
+
+		if (result == REPORT_MATCH) {
+			expected.match += STREAM_PASSES;
+		} else if (result == REPORT_NO_MATCH) {
+			expected.no_match += STREAM_PASSES;
+		}
+	}
+
+	memset(&counters, 0, sizeof(counters));
+	start = host_clock_ns();
+
+	for (size_t pass = 0; pass < STREAM_PASSES; pass++) {
+		for (size_t i = 0; i < ARRAY_SIZE(stream); i++) {
+			struct device *dev = &devices[stream[i]];
+
+			net_buf_simple_init_with_data(&ad, dev->ad, dev->ad_len);
+			scan_cb->recv(&dev->info, &ad);
+		}
+	}
+
+	elapsed = MAX(host_clock_ns() - start, 1);
+
+	TC_PRINT("%s: %u reports/s, %u ns/report, %u matched, %u not matched\n", name,
+		 (uint32_t)(((uint64_t)reports * NSEC_PER_SEC) / elapsed),
+		 (uint32_t)(elapsed / reports), counters.match, counters.no_match);
+
+	zassert_equal(counters.match, expected.match, "%u matched, expected %u", counters.match,
+		      expected.match);
+	zassert_equal(counters.no_match, expected.no_match, "%u not matched, expected %u",
+		      counters.no_match, expected.no_match);
+}
+
+static void any_mode_filters_add(void)
+{
+	struct bt_scan_manufacturer_data ibeacon = {
+		.data = (uint8_t *)ibeacon_prefix,
+		.data_len = sizeof(ibeacon_prefix),
+	};
+
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_NAME, "Sensor-042"));
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_UUID, BT_UUID_DECLARE_16(SENSOR_UUID)));
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_UUID,
+				      BT_UUID_DECLARE_128(VENDOR_UUID_VAL)));
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_MANUFACTURER_DATA, &ibeacon));
+
+	/* The first two Eddystone beacons. */
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_ADDR,
+				      &devices[DEVICE_EDDYSTONE].addr));
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_ADDR,
+				      &devices[DEVICE_KIND_NUM + DEVICE_EDDYSTONE].addr));
+
+	for (size_t i = 0; i < CONFIG_BT_SCAN_ADDRESS_CNT - 2; i++) {
+		zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_ADDR, &absent_addr[i]));
+	}
+}
+
+static void *bench_setup(void)
+{
+	stream_init();
+
+	bt_scan_init(NULL);
+	bt_scan_cb_register(&scan_cb_data);
+
+	zassert_not_null(scan_cb);
+	zassert_not_null(conn_cb);
+
+	return NULL;
+}
+
+static void bench_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	/* Remove and disable all filters and select the normal filter mode. */
+	bt_scan_init(NULL);
+	bt_scan_blocklist_clear();
+	bt_scan_conn_attempts_filter_clear();
+}
+
+/* No filters, every report is passed to the application. */
+ZTEST(bt_scan_benchmark, test_no_filters)
+{
+	bench_run("no filters", false, expect_no_match);
+}
+
+/* Only the blocklist and the connection attempts filter are used. */
+ZTEST(bt_scan_benchmark, test_device_filters)
+{
+	device_filters_fill();
+
+	bench_run("device filters", true, expect_no_match);
+}
+
+/* One filter of any type must match. */
+ZTEST(bt_scan_benchmark, test_any_mode)
+{
+	device_filters_fill();
+	any_mode_filters_add();
+	zassert_ok(bt_scan_filter_enable(BT_SCAN_NAME_FILTER | BT_SCAN_UUID_FILTER |
+					 BT_SCAN_MANUFACTURER_DATA_FILTER | BT_SCAN_ADDR_FILTER,
+					 false));
+
+	bench_run("any mode", true, expect_any_mode);
+}
+
+/* The name and the UUID filters must match. */
+ZTEST(bt_scan_benchmark, test_all_mode)
+{
+	device_filters_fill();
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_NAME, "Sensor-042"));
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_UUID, BT_UUID_DECLARE_16(SENSOR_UUID)));
+	zassert_ok(bt_scan_filter_enable(BT_SCAN_NAME_FILTER | BT_SCAN_UUID_FILTER, true));
+
+	bench_run("all mode", true, expect_all_mode);
+}
+
+ZTEST_SUITE(bt_scan_benchmark, NULL, bench_setup, bench_before, NULL, NULL);
@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/bluetooth/bluetooth.h>
+#include <zephyr/bluetooth/hci_types.h>
+#include <bluetooth/scan.h>
+
+#define DEVICES_NUM (CONFIG_BT_SCAN_DEDUP_CACHE_LEN + 1)
+#define DUPLICATES_NUM (5)
+/* Margin added to the library intervals to make up for the tick rounding. */
+#define TIME_MARGIN_MS (10)
+
+struct device {
+	struct bt_le_scan_recv_info info;
+	bt_addr_le_t addr;
+	uint8_t ad[8];
+};
+
+static struct device devices[DEVICES_NUM];
+static uint32_t reports;
+
+/** Mocks ******************************************/
+
+static struct bt_le_scan_cb *scan_cb;
+
+int bt_le_scan_cb_register(struct bt_le_scan_cb *cb)
+{
+	scan_cb = cb;
+	return 0;
+}
+
+int bt_le_scan_start(const struct bt_le_scan_param *param, bt_le_scan_cb_t cb)
+{
+	return 0;
+}
+
+int bt_le_scan_stop(void)
+{
+	return 0;
+}
+
+/** Test helpers ***********************************/
+
+static void filter_no_match(struct bt_scan_device_info *device_info, bool connectable)
+{
+	reports++;
+}
+
+BT_SCAN_CB_INIT(scan_cb_data, NULL, filter_no_match, NULL, NULL);
+
+static void device_init(size_t idx)
+{
+	struct device *dev = &devices[idx];
+
+	dev->addr.type = BT_ADDR_LE_RANDOM;
+	memset(dev->addr.a.val, 0, sizeof(dev->addr.a.val));
+	dev->addr.a.val[0] = idx;
+	dev->addr.a.val[5] = 0xC0;
+
+	dev->info.addr = &dev->addr;
+	dev->info.rssi = -60;
+	dev->info.adv_type = BT_GAP_ADV_TYPE_ADV_IND;
+	dev->info.adv_props = BT_GAP_ADV_PROP_CONNECTABLE | BT_GAP_ADV_PROP_SCANNABLE;
+
+	/* Flags and a manufacturer specific data byte. */
+	dev->ad[0] = 2;
+	dev->ad[1] = BT_DATA_FLAGS;
+	dev->ad[2] = BT_LE_AD_GENERAL | BT_LE_AD_NO_BREDR;
+	dev->ad[3] = 4;
+	dev->ad[4] = BT_DATA_MANUFACTURER_DATA;
+	dev->ad[5] = 0x59;
+	dev->ad[6] = 0x00;
+	dev->ad[7] = 0;
+}
+
+/* Returns true if the report was passed to the application. */
+static bool report(size_t idx)
+{
+	struct device *dev = &devices[idx];
+	struct net_buf_simple ad;
+	uint32_t before = reports;
+
+	net_buf_simple_init_with_data(&ad, dev->ad, sizeof(dev->ad));
+	scan_cb->recv(&dev->info, &ad);
+
+	return reports != before;
+}
+
+static void scan_rsp_set(size_t idx, bool scan_rsp)
+{
+	struct device *dev = &devices[idx];
+
+	if (scan_rsp) {
+		dev->info.adv_props |= BT_GAP_ADV_PROP_SCAN_RESPONSE;
+		dev->ad[7] = 0xFF;
+	} else {
+		dev->info.adv_props &= ~BT_GAP_ADV_PROP_SCAN_RESPONSE;
+		dev->ad[7] = 0;
+	}
+}
+
+static void stats_check(uint32_t passed, uint32_t duplicates, uint32_t rate_limited,
+			uint32_t evictions)
+{
+	struct bt_scan_dedup_stats stats;
+
+	bt_scan_dedup_stats_get(&stats);
+
+	zassert_equal(stats.passed, passed, "%u passed, expected %u", stats.passed, passed);
+	zassert_equal(stats.duplicates, duplicates, "%u duplicates, expected %u",
+		      stats.duplicates, duplicates);
+	zassert_equal(stats.rate_limited, rate_limited, "%u rate limited, expected %u",
+		      stats.rate_limited, rate_limited);
+	zassert_equal(stats.evictions, evictions, "%u evictions, expected %u", stats.evictions,
+		      evictions);
+	zassert_equal(reports, passed, "%u reports, expected %u", reports, passed);
+}
+
+static void *setup(void)
+{
+	bt_scan_init(NULL);
+	bt_scan_cb_register(&scan_cb_data);
+
+	zassert_not_null(scan_cb);
+
+	return NULL;
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	for (size_t i = 0; i < ARRAY_SIZE(devices); i++) {
+		device_init(i);
+	}
+
+	/* Remove all filters and clear the cache. */
+	bt_scan_init(NULL);
+	bt_scan_dedup_stats_reset();
+	reports = 0;
+}
+
+/* Repeated reports are suppressed, regardless of the RSSI. */
+ZTEST(bt_scan_dedup, test_duplicates)
+{
+	zassert_true(report(0));
+
+	for (size_t i = 0; i < DUPLICATES_NUM; i++) {
+		devices[0].info.rssi--;
+		zassert_false(report(0));
+	}
+
+	/* Other devices are not affected. */
+	zassert_true(report(1));
+
+	stats_check(2, DUPLICATES_NUM, 0, 0);
+}
+
+/* Changed data is reported no sooner than the minimum interval after the previous report. */
+ZTEST(bt_scan_dedup, test_min_interval)
+{
+	zassert_true(report(0));
+
+	devices[0].ad[7]++;
+	zassert_false(report(0));
+
+	k_msleep(CONFIG_BT_SCAN_DEDUP_MIN_INTERVAL_MS + TIME_MARGIN_MS);
+	zassert_true(report(0));
+	zassert_false(report(0));
+
+	stats_check(2, 1, 1, 0);
+}
+
+/* Unchanged data is reported again once the duplicate timeout elapses. */
+ZTEST(bt_scan_dedup, test_timeout)
+{
+	zassert_true(report(0));
+
+	k_msleep(CONFIG_BT_SCAN_DEDUP_TIMEOUT_MS - TIME_MARGIN_MS);
+	zassert_false(report(0));
+
+	k_msleep(2 * TIME_MARGIN_MS);
+	zassert_true(report(0));
+
+	stats_check(2, 1, 0, 0);
+}
+
+/* Advertising reports and scan responses of a device are tracked separately. */
+ZTEST(bt_scan_dedup, test_scan_rsp)
+{
+	zassert_true(report(0));
+
+	k_msleep(CONFIG_BT_SCAN_DEDUP_MIN_INTERVAL_MS + TIME_MARGIN_MS);
+	scan_rsp_set(0, true);
+	zassert_true(report(0));
+
+	for (size_t i = 0; i < DUPLICATES_NUM; i++) {
+		scan_rsp_set(0, false);
+		zassert_false(report(0));
+		scan_rsp_set(0, true);
+		zassert_false(report(0));
+	}
+
+	stats_check(2, 2 * DUPLICATES_NUM, 0, 0);
+}
+
+/* The oldest device is replaced once the cache is full. */
+ZTEST(bt_scan_dedup, test_eviction)
+{
+	for (size_t i = 0; i < DEVICES_NUM; i++) {
+		zassert_true(report(i));
+	}
+
+	stats_check(DEVICES_NUM, 0, 0, 1);
+
+	/* The first device was replaced, so it is reported again.
+	 * This replaces the second device.
+	 */
+	zassert_true(report(0));
+	zassert_false(report(DEVICES_NUM - 1));
+	zassert_true(report(1));
+
+	stats_check(DEVICES_NUM + 2, 1, 0, 3);
+}
+
+/* Starting the scanning and changing the filters clear the cache. */
+ZTEST(bt_scan_dedup, test_clear)
+{
+	zassert_true(report(0));
+	zassert_false(report(0));
+
+	zassert_ok(bt_scan_start(BT_SCAN_TYPE_SCAN_PASSIVE));
+	zassert_true(report(0));
+
+	zassert_ok(bt_scan_filter_add(BT_SCAN_FILTER_TYPE_NAME, "Name"));
+	zassert_true(report(0));
+
+	bt_scan_filter_disable();
+	zassert_true(report(0));
+
+	bt_scan_dedup_clear();
+	zassert_true(report(0));
+	zassert_false(report(0));
+
+	stats_check(5, 2, 0, 0);
+}
+
+ZTEST_SUITE(bt_scan_dedup, NULL, setup, before, NULL, NULL);
@@ -7,6 +7,8 @@
 #define TEST_CONFIG_SIMPLE_BURST_SIZE 10000
 #define TEST_CONFIG_DATA_BURST_SIZE 10000
 #define TEST_CONFIG_DATA_BIG_BURST_SIZE 1000
+/* Number of events submitted to the event manager at once in batched burst tests. */
+#define TEST_CONFIG_SIMPLE_BATCH_SIZE 32
 
 /* Test related timeouts. */
 #define TEST_TIMEOUT_BASE_S 1
@@ -54,6 +54,42 @@ ZTEST(simple_tests, test_simple_burst)
 	printk(" Test sending simple burst speed %lu msg/sec\n", speed);
 }
 
+ZTEST(simple_tests, test_simple_burst_batched)
+{
+	uint32_t us_spent;
+
+	BUILD_ASSERT(TEST_CONFIG_SIMPLE_BURST_SIZE % TEST_CONFIG_SIMPLE_BATCH_SIZE == 0);
+
+	test_start(TEST_SIMPLE_BURST);
+	test_start_ack_wait();
+
+	test_time_start();
+
+	for (size_t cnt = 0; cnt < TEST_CONFIG_SIMPLE_BURST_SIZE;
+	     cnt += TEST_CONFIG_SIMPLE_BATCH_SIZE) {
+		/*
+		 * Queue the events before the event manager processes them, so that the proxy
+		 * forwards the whole batch in a single message.
+		 */
+		k_sched_lock();
+		for (size_t i = 0; i < TEST_CONFIG_SIMPLE_BATCH_SIZE; ++i) {
+			APP_EVENT_SUBMIT(new_simple_event());
+		}
+		k_sched_unlock();
+	}
+
+	test_end_wait(TEST_SIMPLE_BURST);
+
+	us_spent = test_time_spent_us();
+
+	unsigned long speed =
+				     /* Burst size + test end event */
+		((uint64_t)Z_HZ_us * (TEST_CONFIG_SIMPLE_BURST_SIZE + 1)) /
+		us_spent;
+	printk(" Time: %u us\n", us_spent);
+	printk(" Test sending batched simple burst speed %lu msg/sec\n", speed);
+}
+
 ZTEST(simple_tests, test_simple_burst_from_remote)
 {
 	uint32_t us_spent;
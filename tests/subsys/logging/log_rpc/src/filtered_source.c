@@ -0,0 +1,15 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/logging/log.h>
+
+/* The RPC logging backend drops messages of sources with the nRF RPC prefix. */
+LOG_MODULE_REGISTER(nrf_rpc_test_source, LOG_LEVEL_DBG);
+
+void filtered_source_log(const char *text)
+{
+	LOG_INF("%s", text);
+}
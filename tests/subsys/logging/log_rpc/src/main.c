@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <logging/log_rpc.h>
+#include <mock_nrf_rpc_loopback.h>
+
+#include <zephyr/logging/log.h>
+#include <zephyr/logging/log_backend.h>
+#include <zephyr/logging/log_ctrl.h>
+#include <zephyr/sys/cbprintf.h>
+#include <zephyr/ztest.h>
+
+#include <string.h>
+
+LOG_MODULE_REGISTER(test_log_rpc, LOG_LEVEL_DBG);
+
+#define FORWARDED_MAX (8)
+#define FORWARDED_TEXT_MAX (128)
+#define FORWARD_TIMEOUT (K_SECONDS(2))
+#define NOT_FORWARDED_TIMEOUT (K_MSEC(2 * CONFIG_LOG_BACKEND_RPC_BINARY_FLUSH_INTERVAL))
+
+/* Message logged by the forwarder after receiving it from the RPC logging backend. */
+struct forwarded_msg {
+	uint8_t level;
+	char text[FORWARDED_TEXT_MAX];
+	size_t len;
+};
+
+static struct forwarded_msg forwarded[FORWARDED_MAX];
+static size_t forwarded_cnt;
+static K_SEM_DEFINE(forwarded_sem, 0, FORWARDED_MAX);
+
+void filtered_source_log(const char *text);
+
+static int text_out(int c, void *ctx)
+{
+	struct forwarded_msg *fwd = ctx;
+
+	if (fwd->len < sizeof(fwd->text) - 1) {
+		fwd->text[fwd->len++] = (char)c;
+	}
+
+	return c;
+}
+
+static bool is_forwarded(struct log_msg *msg)
+{
+	void *source = (void *)log_msg_get_source(msg);
+	const char *name;
+
+	if (log_msg_get_domain(msg) != Z_LOG_LOCAL_DOMAIN_ID || source == NULL) {
+		return false;
+	}
+
+	name = log_source_name_get(Z_LOG_LOCAL_DOMAIN_ID, log_dynamic_source_id(source));
+
+	return name != NULL && strcmp(name, "remote") == 0;
+}
+
+/* Collects the messages logged by the forwarder. */
+static void capture_process(const struct log_backend *const backend,
+			    union log_msg_generic *msg_generic)
+{
+	struct log_msg *msg = &msg_generic->log;
+	struct forwarded_msg *fwd;
+	size_t package_len;
+
+	ARG_UNUSED(backend);
+
+	if (!is_forwarded(msg) || forwarded_cnt == FORWARDED_MAX) {
+		return;
+	}
+
+	fwd = &forwarded[forwarded_cnt++];
+	fwd->level = log_msg_get_level(msg);
+	fwd->len = 0;
+	cbpprintf((cbprintf_cb)text_out, fwd, log_msg_get_package(msg, &package_len));
+	fwd->text[fwd->len] = '\0';
+
+	k_sem_give(&forwarded_sem);
+}
+
+static void capture_panic(const struct log_backend *const backend)
+{
+	ARG_UNUSED(backend);
+}
+
+static const struct log_backend_api capture_backend_api = {
+	.process = capture_process,
+	.panic = capture_panic,
+};
+
+LOG_BACKEND_DEFINE(capture_backend, capture_backend_api, true);
+
+static void forwarded_wait(size_t count)
+{
+	for (size_t i = 0; i < count; i++) {
+		zassert_ok(k_sem_take(&forwarded_sem, FORWARD_TIMEOUT),
+			   "%zu of %zu messages forwarded", i, count);
+	}
+}
+
+/* The forwarded text starts with the timestamp, followed by the source name and the message. */
+static void forwarded_check(size_t index, uint8_t level, const char *text)
+{
+	const struct forwarded_msg *fwd = &forwarded[index];
+	size_t text_len = strlen(text);
+
+	zassert_equal(fwd->level, level, "message %zu: unexpected level", index);
+	zassert_true(fwd->len >= text_len, "message %zu: \"%s\" too short", index, fwd->text);
+	zassert_str_equal(&fwd->text[fwd->len - text_len], text, "message %zu: \"%s\"", index,
+			  fwd->text);
+}
+
+ZTEST(log_rpc, test_batch_round_trip)
+{
+	struct mock_nrf_rpc_loopback_stats stats;
+
+	mock_nrf_rpc_loopback_stats_reset();
+
+	LOG_ERR("error %d", -5);
+	LOG_WRN("warning %s", "string");
+	LOG_INF("info %u", 3U);
+	LOG_DBG("debug");
+
+	forwarded_wait(4);
+	mock_nrf_rpc_loopback_stats_get(&stats);
+
+	zassert_equal(forwarded_cnt, 4);
+	forwarded_check(0, LOG_LEVEL_ERR, "test_log_rpc: error -5");
+	forwarded_check(1, LOG_LEVEL_WRN, "test_log_rpc: warning string");
+	forwarded_check(2, LOG_LEVEL_INF, "test_log_rpc: info 3");
+	forwarded_check(3, LOG_LEVEL_DBG, "test_log_rpc: debug");
+
+	/* A single event and its acknowledgment. */
+	zassert_true(stats.packets <= 2, "%u packets sent for one batch", stats.packets);
+}
+
+ZTEST(log_rpc, test_filtered_out_source)
+{
+	filtered_source_log("filtered");
+	LOG_INF("not filtered");
+
+	forwarded_wait(1);
+	zassert_equal(k_sem_take(&forwarded_sem, NOT_FORWARDED_TIMEOUT), -EAGAIN,
+		      "filtered out message forwarded");
+
+	zassert_equal(forwarded_cnt, 1);
+	forwarded_check(0, LOG_LEVEL_INF, "test_log_rpc: not filtered");
+}
+
+static void *log_rpc_setup(void)
+{
+	int16_t remote_id = log_source_id_get("remote");
+
+	zassert_true(remote_id >= 0);
+
+	/* Do not send the forwarded messages back to the forwarder. */
+	log_filter_set(log_backend_get_by_name("log_backend_rpc"), Z_LOG_LOCAL_DOMAIN_ID, remote_id,
+		       LOG_LEVEL_NONE);
+
+	log_rpc_set_stream_level(LOG_RPC_LEVEL_DBG);
+
+	return NULL;
+}
+
+static void log_rpc_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	forwarded_cnt = 0;
+	k_sem_reset(&forwarded_sem);
+}
+
+ZTEST_SUITE(log_rpc, NULL, log_rpc_setup, log_rpc_before, NULL, NULL);
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <nrf_rpc/nrf_rpc_serialize.h>
+
+#include <nrf_rpc_cbor.h>
+#include <zcbor_encode.h>
+
+#include <zephyr/ztest.h>
+
+#define ENCODE_BUF_SIZE (1100)
+
+BUILD_ASSERT(NRF_RPC_CBOR_UINT_SIZE(23) == 1);
+BUILD_ASSERT(NRF_RPC_CBOR_UINT_SIZE(24) == 2);
+BUILD_ASSERT(NRF_RPC_CBOR_INT_SIZE(-24) == 1);
+BUILD_ASSERT(NRF_RPC_CBOR_INT_SIZE(-25) == 2);
+BUILD_ASSERT(NRF_RPC_CBOR_INT_MAX_SIZE(uint16_t) == NRF_RPC_CBOR_UINT_SIZE(UINT16_MAX));
+BUILD_ASSERT(NRF_RPC_CBOR_BUFFER_SIZE(16) == 17);
+
+static const uint32_t uint_values[] = {
+	0, 23, 24, UINT8_MAX, UINT8_MAX + 1, UINT16_MAX, UINT16_MAX + 1, UINT32_MAX,
+};
+
+static const int32_t int_values[] = {
+	0, -1, -24, -25, -256, -257, -65536, -65537, INT32_MIN, INT32_MAX,
+};
+
+static const size_t buffer_sizes[] = {0, 23, 24, 255, 256, 1024};
+
+static uint8_t encode_buf[ENCODE_BUF_SIZE];
+static uint8_t payload[1024];
+
+static void encode_start(struct nrf_rpc_cbor_ctx *ctx)
+{
+	zcbor_new_encode_state(ctx->zs, ARRAY_SIZE(ctx->zs), encode_buf, sizeof(encode_buf), 0);
+}
+
+static size_t encode_len(const struct nrf_rpc_cbor_ctx *ctx)
+{
+	zassert_true(zcbor_check_error(ctx->zs));
+
+	return ctx->zs[0].payload_mut - encode_buf;
+}
+
+ZTEST(nrf_rpc_encode_size, test_uint)
+{
+	struct nrf_rpc_cbor_ctx ctx;
+
+	for (size_t i = 0; i < ARRAY_SIZE(uint_values); i++) {
+		encode_start(&ctx);
+		nrf_rpc_encode_uint(&ctx, uint_values[i]);
+		zassert_equal(encode_len(&ctx), NRF_RPC_CBOR_UINT_SIZE(uint_values[i]),
+			      "Wrong size of %u", uint_values[i]);
+		zassert_true(encode_len(&ctx) <= NRF_RPC_CBOR_INT_MAX_SIZE(uint32_t));
+	}
+}
+
+ZTEST(nrf_rpc_encode_size, test_int)
+{
+	struct nrf_rpc_cbor_ctx ctx;
+
+	for (size_t i = 0; i < ARRAY_SIZE(int_values); i++) {
+		encode_start(&ctx);
+		nrf_rpc_encode_int(&ctx, int_values[i]);
+		zassert_equal(encode_len(&ctx), NRF_RPC_CBOR_INT_SIZE(int_values[i]),
+			      "Wrong size of %d", int_values[i]);
+		zassert_true(encode_len(&ctx) <= NRF_RPC_CBOR_INT_MAX_SIZE(int32_t));
+	}
+}
+
+ZTEST(nrf_rpc_encode_size, test_buffer_and_str)
+{
+	struct nrf_rpc_cbor_ctx ctx;
+
+	memset(payload, 'a', sizeof(payload));
+
+	for (size_t i = 0; i < ARRAY_SIZE(buffer_sizes); i++) {
+		encode_start(&ctx);
+		nrf_rpc_encode_buffer(&ctx, payload, buffer_sizes[i]);
+		zassert_equal(encode_len(&ctx), nrf_rpc_encode_buffer_size(payload, buffer_sizes[i]),
+			      "Wrong size of %zu B buffer", buffer_sizes[i]);
+
+		encode_start(&ctx);
+		nrf_rpc_encode_str(&ctx, (const char *)payload, buffer_sizes[i]);
+		zassert_equal(encode_len(&ctx),
+			      nrf_rpc_encode_str_size((const char *)payload, buffer_sizes[i]),
+			      "Wrong size of %zu B string", buffer_sizes[i]);
+	}
+
+	encode_start(&ctx);
+	nrf_rpc_encode_buffer(&ctx, NULL, 0);
+	zassert_equal(encode_len(&ctx), nrf_rpc_encode_buffer_size(NULL, 0));
+
+	encode_start(&ctx);
+	nrf_rpc_encode_str(&ctx, "name", -1);
+	zassert_equal(encode_len(&ctx), nrf_rpc_encode_str_size("name", -1));
+}
+
+ZTEST_SUITE(nrf_rpc_encode_size, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,374 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <mock_nrf_rpc_loopback.h>
+#include <nrf_rpc/nrf_rpc_buf.h>
+#include <nrf_rpc/nrf_rpc_serialize.h>
+
+#include <nrf_rpc_cbor.h>
+
+#include <zephyr/ztest.h>
+
+#include <stdlib.h>
+
+#define BENCH_CMD (0)
+#define BENCH_EVT (1)
+#define BENCH_CALLS_NUM (200)
+#define BENCH_THREADS_MAX (4)
+#define BENCH_THREAD_STACK_SIZE (2048)
+#define BENCH_PAYLOAD_MAX (1024)
+#define BENCH_TIMEOUT (K_SECONDS(10))
+/* Regression thresholds. Every call sends a command or an event and receives a response or
+ * an acknowledgment, so it allocates two transport buffers.
+ */
+#define BENCH_ALLOCS_PER_CALL_MAX (2)
+#define BENCH_P99_MAX_US (10 * USEC_PER_MSEC)
+
+#if defined(CONFIG_ARCH_POSIX)
+/* Simulated time does not advance while code executes on native_sim,
+ * so the benchmark reads the host clock provided by the native simulator runner.
+ */
+uint64_t host_clock_ns(void);
+
+/* Truncated like the cycle counter, which is fine for intervals shorter than four seconds. */
+static uint32_t bench_now(void)
+{
+	return (uint32_t)host_clock_ns();
+}
+
+static uint64_t bench_to_ns(uint32_t elapsed)
+{
+	return elapsed;
+}
+#else
+static uint32_t bench_now(void)
+{
+	return k_cycle_get_32();
+}
+
+static uint64_t bench_to_ns(uint32_t elapsed)
+{
+	return k_cyc_to_ns_floor64(elapsed);
+}
+#endif /* defined(CONFIG_ARCH_POSIX) */
+
+NRF_RPC_GROUP_DEFINE(bench_group, "bench", &mock_nrf_rpc_loopback_tr, NULL, NULL, NULL);
+
+/* Times in nanoseconds. */
+struct bench_result {
+	uint32_t calls;
+	uint64_t elapsed;
+	uint32_t p50;
+	uint32_t p99;
+	uint32_t allocs;
+	uint32_t bytes;
+	uint32_t alloc_bytes;
+};
+
+struct bench_thread {
+	struct k_thread thread;
+	size_t payload_len;
+	uint32_t *samples;
+	uint32_t calls;
+};
+
+static const size_t bench_sizes[] = {0, 16, 64, 256, BENCH_PAYLOAD_MAX};
+
+static const uint8_t *bench_payload;
+static uint32_t bench_samples[BENCH_THREADS_MAX * BENCH_CALLS_NUM];
+static atomic_t evt_samples_num;
+static atomic_t handler_errors;
+static K_SEM_DEFINE(evt_sem, 0, K_SEM_MAX_LIMIT);
+static K_THREAD_STACK_ARRAY_DEFINE(bench_stacks, BENCH_THREADS_MAX, BENCH_THREAD_STACK_SIZE);
+static struct bench_thread bench_threads[BENCH_THREADS_MAX];
+
+static bool payload_valid(const uint8_t *data, size_t len)
+{
+	if (len > 0 && data == NULL) {
+		return false;
+	}
+
+	for (size_t i = 0; i < len; i++) {
+		if (data[i] != bench_payload[i]) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static void bench_cmd_handler(const struct nrf_rpc_group *group, struct nrf_rpc_cbor_ctx *ctx,
+			      void *handler_data)
+{
+	const uint8_t *data;
+	size_t len;
+	bool valid;
+
+	data = nrf_rpc_decode_buffer_ptr_and_size(ctx, &len);
+	valid = payload_valid(data, len);
+
+	if (!nrf_rpc_decoding_done_and_check(group, ctx) || !valid) {
+		atomic_inc(&handler_errors);
+		len = 0;
+	}
+
+	nrf_rpc_rsp_send_uint(group, len);
+}
+
+NRF_RPC_CBOR_CMD_DECODER(bench_group, bench_cmd, BENCH_CMD, bench_cmd_handler, NULL);
+
+static void bench_evt_handler(const struct nrf_rpc_group *group, struct nrf_rpc_cbor_ctx *ctx,
+			      void *handler_data)
+{
+	uint32_t sent;
+	const uint8_t *data;
+	size_t len;
+	bool valid;
+	atomic_val_t idx;
+
+	sent = nrf_rpc_decode_uint(ctx);
+	data = nrf_rpc_decode_buffer_ptr_and_size(ctx, &len);
+	valid = payload_valid(data, len);
+
+	if (!nrf_rpc_decoding_done_and_check(group, ctx) || !valid) {
+		atomic_inc(&handler_errors);
+	}
+
+	idx = atomic_inc(&evt_samples_num);
+
+	if (idx < ARRAY_SIZE(bench_samples)) {
+		bench_samples[idx] = bench_to_ns(bench_now() - sent);
+	}
+
+	k_sem_give(&evt_sem);
+}
+
+NRF_RPC_CBOR_EVT_DECODER(bench_group, bench_evt, BENCH_EVT, bench_evt_handler, NULL);
+
+static uint32_t bench_cmd_call(size_t payload_len)
+{
+	struct nrf_rpc_cbor_ctx ctx;
+	uint32_t result;
+
+	NRF_RPC_CBOR_ALLOC(&bench_group, ctx, NRF_RPC_CBOR_BUFFER_SIZE(payload_len));
+
+	nrf_rpc_encode_buffer(&ctx, bench_payload, payload_len);
+	nrf_rpc_cbor_cmd_no_err(&bench_group, BENCH_CMD, &ctx, nrf_rpc_rsp_decode_u32, &result);
+
+	return result;
+}
+
+static void bench_evt_send(size_t payload_len)
+{
+	struct nrf_rpc_cbor_ctx ctx;
+
+	NRF_RPC_CBOR_ALLOC(&bench_group, ctx,
+			   NRF_RPC_CBOR_INT_MAX_SIZE(uint32_t) + NRF_RPC_CBOR_BUFFER_SIZE(payload_len));
+
+	nrf_rpc_encode_uint(&ctx, bench_now());
+	nrf_rpc_encode_buffer(&ctx, bench_payload, payload_len);
+	nrf_rpc_cbor_evt_no_err(&bench_group, BENCH_EVT, &ctx);
+}
+
+static void bench_cmd_thread(void *p1, void *p2, void *p3)
+{
+	struct bench_thread *bt = p1;
+	uint32_t start;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (uint32_t i = 0; i < bt->calls; i++) {
+		start = bench_now();
+
+		if (bench_cmd_call(bt->payload_len) != bt->payload_len) {
+			atomic_inc(&handler_errors);
+		}
+
+		bt->samples[i] = bench_to_ns(bench_now() - start);
+	}
+}
+
+static int sample_cmp(const void *a, const void *b)
+{
+	uint32_t lhs = *(const uint32_t *)a;
+	uint32_t rhs = *(const uint32_t *)b;
+
+	return (lhs > rhs) - (lhs < rhs);
+}
+
+static void bench_start(void)
+{
+	mock_nrf_rpc_loopback_stats_reset();
+	atomic_clear(&handler_errors);
+	atomic_clear(&evt_samples_num);
+	k_sem_reset(&evt_sem);
+}
+
+static void bench_finish(struct bench_result *result, uint32_t calls, uint32_t elapsed)
+{
+	struct mock_nrf_rpc_loopback_stats stats;
+
+	mock_nrf_rpc_loopback_stats_get(&stats);
+	qsort(bench_samples, calls, sizeof(bench_samples[0]), sample_cmp);
+
+	result->calls = calls;
+	result->elapsed = bench_to_ns(elapsed);
+	result->p50 = bench_samples[calls / 2];
+	result->p99 = bench_samples[(calls * 99) / 100];
+	result->allocs = stats.allocs;
+	result->bytes = stats.bytes;
+	result->alloc_bytes = stats.alloc_bytes;
+
+	zassert_equal(atomic_get(&handler_errors), 0, "%ld calls failed",
+		      (long)atomic_get(&handler_errors));
+	zassert_true(result->elapsed > 0, "Clock did not advance");
+}
+
+static void bench_check(const struct bench_result *result)
+{
+	zassert_true(result->allocs <= result->calls * BENCH_ALLOCS_PER_CALL_MAX,
+		     "%u allocations in %u calls", result->allocs, result->calls);
+	zassert_true(result->p99 <= BENCH_P99_MAX_US * NSEC_PER_USEC, "p99 %u us over %u us",
+		     result->p99 / NSEC_PER_USEC, BENCH_P99_MAX_US);
+}
+
+static void bench_print(const char *name, size_t payload_len, uint32_t threads,
+			const struct bench_result *result)
+{
+	/* Allocations per call, in hundredths. */
+	uint32_t allocs = (result->allocs * 100) / result->calls;
+
+	TC_PRINT("%s %4u B x%u: %6u calls/s, p50 %5u us, p99 %5u us, %u.%02u allocs/call, "
+		 "%u/%u B/call sent/allocated\n",
+		 name, (uint32_t)payload_len, threads,
+		 (uint32_t)((uint64_t)result->calls * NSEC_PER_SEC / result->elapsed),
+		 result->p50 / NSEC_PER_USEC, result->p99 / NSEC_PER_USEC,
+		 allocs / 100, allocs % 100, result->bytes / result->calls,
+		 result->alloc_bytes / result->calls);
+}
+
+static void bench_cmd_run(size_t payload_len, uint32_t threads_num, struct bench_result *result)
+{
+	uint32_t calls = BENCH_CALLS_NUM;
+	uint32_t start;
+	int ret;
+
+	bench_start();
+	start = bench_now();
+
+	for (uint32_t t = 0; t < threads_num; t++) {
+		struct bench_thread *bt = &bench_threads[t];
+
+		bt->payload_len = payload_len;
+		bt->samples = &bench_samples[t * calls];
+		bt->calls = calls;
+
+		k_thread_create(&bt->thread, bench_stacks[t], K_THREAD_STACK_SIZEOF(bench_stacks[t]),
+				bench_cmd_thread, bt, NULL, NULL, K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+	}
+
+	for (uint32_t t = 0; t < threads_num; t++) {
+		ret = k_thread_join(&bench_threads[t].thread, BENCH_TIMEOUT);
+		zassert_equal(ret, 0, "Calling thread %u did not finish", t);
+	}
+
+	bench_finish(result, calls * threads_num, bench_now() - start);
+}
+
+static void bench_evt_run(size_t payload_len, struct bench_result *result)
+{
+	uint32_t calls = BENCH_CALLS_NUM;
+	uint32_t start;
+	int ret;
+
+	bench_start();
+	start = bench_now();
+
+	for (uint32_t i = 0; i < calls; i++) {
+		bench_evt_send(payload_len);
+	}
+
+	for (uint32_t i = 0; i < calls; i++) {
+		ret = k_sem_take(&evt_sem, BENCH_TIMEOUT);
+		zassert_equal(ret, 0, "Only %u events handled", i);
+	}
+
+	bench_finish(result, calls, bench_now() - start);
+}
+
+static void *bench_setup(void)
+{
+	static uint8_t payload[BENCH_PAYLOAD_MAX];
+
+	for (size_t i = 0; i < sizeof(payload); i++) {
+		payload[i] = (uint8_t)(i * 7);
+	}
+
+	bench_payload = payload;
+
+	return NULL;
+}
+
+static void bench_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+#ifdef CONFIG_NRF_RPC_BUF_POOL
+	nrf_rpc_buf_stats_reset();
+#endif
+}
+
+static void bench_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+#ifdef CONFIG_NRF_RPC_BUF_POOL
+	struct nrf_rpc_buf_stats stats;
+
+	nrf_rpc_buf_stats_get(&stats);
+	TC_PRINT("Buffers: %u from the heap, %u allocation failures\n", stats.heap_allocs,
+		 stats.failures);
+#endif
+}
+
+/* Call a command with a growing payload from a single thread. */
+ZTEST(nrf_rpc_benchmark, test_cmd_payload_sweep)
+{
+	struct bench_result result;
+
+	for (size_t s = 0; s < ARRAY_SIZE(bench_sizes); s++) {
+		bench_cmd_run(bench_sizes[s], 1, &result);
+		bench_print("cmd", bench_sizes[s], 1, &result);
+		bench_check(&result);
+	}
+}
+
+/* Send events with a growing payload back to back, without waiting for the handler. */
+ZTEST(nrf_rpc_benchmark, test_evt_payload_sweep)
+{
+	struct bench_result result;
+
+	for (size_t s = 0; s < ARRAY_SIZE(bench_sizes); s++) {
+		bench_evt_run(bench_sizes[s], &result);
+		bench_print("evt", bench_sizes[s], 1, &result);
+		bench_check(&result);
+	}
+}
+
+/* Call a command from several threads at the same time. */
+ZTEST(nrf_rpc_benchmark, test_cmd_concurrency)
+{
+	struct bench_result result;
+
+	for (uint32_t threads = 1; threads <= BENCH_THREADS_MAX; threads *= 2) {
+		bench_cmd_run(bench_sizes[2], threads, &result);
+		bench_print("cmd", bench_sizes[2], threads, &result);
+		bench_check(&result);
+	}
+}
+
+ZTEST_SUITE(nrf_rpc_benchmark, NULL, bench_setup, bench_before, bench_after, NULL);
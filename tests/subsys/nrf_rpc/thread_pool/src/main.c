@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <mock_nrf_rpc_loopback.h>
+#include <nrf_rpc/nrf_rpc_serialize.h>
+#include <nrf_rpc/nrf_rpc_thread_pool.h>
+
+#include <nrf_rpc_cbor.h>
+
+#include <zephyr/ztest.h>
+
+#define TEST_CMD (0)
+#define CALLERS_NUM (2)
+#define CALLER_STACK_SIZE (2048)
+#define QUEUE_DELAY_MS (50)
+#define TEST_TIMEOUT (K_SECONDS(1))
+
+NRF_RPC_GROUP_DEFINE(slow_group, "slow", &mock_nrf_rpc_loopback_tr, NULL, NULL, NULL);
+NRF_RPC_GROUP_DEFINE(fast_group, "fast", &mock_nrf_rpc_loopback_tr, NULL, NULL, NULL);
+
+NRF_RPC_THREAD_POOL_DEFINE(fast_pool, fast_group, 1, CONFIG_NRF_RPC_THREAD_STACK_SIZE);
+
+static K_SEM_DEFINE(slow_started, 0, K_SEM_MAX_LIMIT);
+static K_SEM_DEFINE(slow_release, 0, K_SEM_MAX_LIMIT);
+static K_THREAD_STACK_ARRAY_DEFINE(caller_stacks, CALLERS_NUM, CALLER_STACK_SIZE);
+static struct k_thread caller_threads[CALLERS_NUM];
+
+static void slow_cmd_handler(const struct nrf_rpc_group *group, struct nrf_rpc_cbor_ctx *ctx,
+			     void *handler_data)
+{
+	nrf_rpc_cbor_decoding_done(group, ctx);
+
+	/* Keep the only thread of the default pool busy. */
+	k_sem_give(&slow_started);
+	k_sem_take(&slow_release, K_FOREVER);
+
+	nrf_rpc_rsp_send_void(group);
+}
+
+NRF_RPC_CBOR_CMD_DECODER(slow_group, slow_cmd, TEST_CMD, slow_cmd_handler, NULL);
+
+static void fast_cmd_handler(const struct nrf_rpc_group *group, struct nrf_rpc_cbor_ctx *ctx,
+			     void *handler_data)
+{
+	nrf_rpc_cbor_decoding_done(group, ctx);
+	nrf_rpc_rsp_send_void(group);
+}
+
+NRF_RPC_CBOR_CMD_DECODER(fast_group, fast_cmd, TEST_CMD, fast_cmd_handler, NULL);
+
+static void caller_thread(void *p1, void *p2, void *p3)
+{
+	const struct nrf_rpc_group *group = p1;
+	struct nrf_rpc_cbor_ctx ctx;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	NRF_RPC_CBOR_ALLOC(group, ctx, 0);
+	nrf_rpc_cbor_cmd_no_err(group, TEST_CMD, &ctx, nrf_rpc_rsp_decode_void, NULL);
+}
+
+static void caller_start(size_t idx, const struct nrf_rpc_group *group)
+{
+	k_thread_create(&caller_threads[idx], caller_stacks[idx],
+			K_THREAD_STACK_SIZEOF(caller_stacks[idx]), caller_thread, (void *)group,
+			NULL, NULL, K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+}
+
+static void caller_join(size_t idx)
+{
+	zassert_equal(k_thread_join(&caller_threads[idx], TEST_TIMEOUT), 0,
+		      "Command %zu did not complete", idx);
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	k_sem_reset(&slow_started);
+	k_sem_reset(&slow_release);
+	nrf_rpc_thread_pool_stats_reset();
+}
+
+/* A command of a group with its own pool completes while the default pool is busy. */
+ZTEST(nrf_rpc_thread_pool, test_group_pool_not_blocked)
+{
+	struct nrf_rpc_thread_pool_stats stats;
+
+	caller_start(0, &slow_group);
+	zassert_equal(k_sem_take(&slow_started, TEST_TIMEOUT), 0);
+
+	caller_start(1, &fast_group);
+	caller_join(1);
+
+	k_sem_give(&slow_release);
+	caller_join(0);
+
+	nrf_rpc_thread_pool_stats_get(&fast_group, &stats);
+	zassert_equal(stats.packets, 1);
+	zassert_equal(stats.busy_max, 1);
+
+	nrf_rpc_thread_pool_stats_get(&slow_group, &stats);
+	zassert_equal(stats.packets, 1);
+	zassert_equal(stats.busy_max, 1);
+}
+
+/* The time a command waits for a pool thread is reported for the pool. */
+ZTEST(nrf_rpc_thread_pool, test_queue_delay)
+{
+	struct nrf_rpc_thread_pool_stats stats;
+
+	caller_start(0, &slow_group);
+	zassert_equal(k_sem_take(&slow_started, TEST_TIMEOUT), 0);
+
+	caller_start(1, &slow_group);
+	k_msleep(QUEUE_DELAY_MS);
+
+	k_sem_give(&slow_release);
+	zassert_equal(k_sem_take(&slow_started, TEST_TIMEOUT), 0);
+	k_sem_give(&slow_release);
+
+	caller_join(0);
+	caller_join(1);
+
+	nrf_rpc_thread_pool_stats_get(NULL, &stats);
+	zassert_equal(stats.packets, 2);
+	zassert_true(stats.delay_max_us >= (QUEUE_DELAY_MS - 1) * USEC_PER_MSEC,
+		     "Delay %u us", stats.delay_max_us);
+	zassert_true(stats.delay_avg_us <= stats.delay_max_us);
+
+	nrf_rpc_thread_pool_stats_get(&fast_group, &stats);
+	zassert_equal(stats.packets, 0);
+}
+
+ZTEST_SUITE(nrf_rpc_thread_pool, NULL, NULL, before, NULL, NULL);
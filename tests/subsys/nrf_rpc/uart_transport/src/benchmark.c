@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+
+#include "test_uart_transport.h"
+
+#define BENCH_PACKETS_NUM (500)
+#define BENCH_ROUND_TRIPS_NUM (100)
+#define BENCH_TIMEOUT (K_SECONDS(10))
+
+static const size_t bench_sizes[] = {16, 64, 256};
+
+static void *bench_setup(void)
+{
+	test_transport_reset();
+
+	return NULL;
+}
+
+/* Send packets back to back and measure how many of them get through per second. */
+ZTEST(nrf_rpc_uart_transport_benchmark, test_benchmark_throughput)
+{
+	uint64_t start;
+	uint64_t elapsed;
+	int ret;
+
+	for (size_t s = 0; s < ARRAY_SIZE(bench_sizes); s++) {
+		memset(&test_rx_stats, 0, sizeof(test_rx_stats));
+		start = host_clock_ns();
+
+		for (uint32_t i = 0; i < BENCH_PACKETS_NUM; i++) {
+			ret = test_packet_send(bench_sizes[s]);
+			zassert_equal(ret, 0, "Send failed: %d", ret);
+		}
+
+		ret = test_packets_wait(BENCH_PACKETS_NUM, BENCH_TIMEOUT);
+		zassert_equal(ret, 0, "Only %u packets received", test_rx_stats.packets);
+
+		elapsed = MAX(host_clock_ns() - start, 1);
+
+		zassert_equal(test_rx_stats.errors, 0, "%u packets out of order or corrupted",
+			      test_rx_stats.errors);
+
+		TC_PRINT("%u B packets: %u packets/s, latency avg %u us, max %u us\n",
+			 (uint32_t)bench_sizes[s],
+			 (uint32_t)((uint64_t)BENCH_PACKETS_NUM * NSEC_PER_SEC / elapsed),
+			 (uint32_t)(test_rx_stats.latency_sum / BENCH_PACKETS_NUM / NSEC_PER_USEC),
+			 (uint32_t)(test_rx_stats.latency_max / NSEC_PER_USEC));
+	}
+}
+
+/* Send one packet at a time and measure the time until it has been received. */
+ZTEST(nrf_rpc_uart_transport_benchmark, test_benchmark_round_trip)
+{
+	int ret;
+
+	memset(&test_rx_stats, 0, sizeof(test_rx_stats));
+
+	for (uint32_t i = 0; i < BENCH_ROUND_TRIPS_NUM; i++) {
+		ret = test_packet_send(bench_sizes[0]);
+		zassert_equal(ret, 0, "Send failed: %d", ret);
+
+		ret = test_packets_wait(1, BENCH_TIMEOUT);
+		zassert_equal(ret, 0, "Packet %u not received", i);
+	}
+
+	zassert_equal(test_rx_stats.errors, 0, "%u packets out of order or corrupted",
+		      test_rx_stats.errors);
+
+	TC_PRINT("Round trip: avg %u us, max %u us\n",
+		 (uint32_t)(test_rx_stats.latency_sum / BENCH_ROUND_TRIPS_NUM / NSEC_PER_USEC),
+		 (uint32_t)(test_rx_stats.latency_max / NSEC_PER_USEC));
+}
+
+ZTEST_SUITE(nrf_rpc_uart_transport_benchmark, NULL, bench_setup, NULL, NULL, NULL);
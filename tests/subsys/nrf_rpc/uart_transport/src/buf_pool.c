@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <nrf_rpc/nrf_rpc_buf.h>
+
+#include <zephyr/ztest.h>
+
+#include "test_uart_transport.h"
+
+#define SMALL_SIZE CONFIG_NRF_RPC_BUF_POOL_SMALL_SIZE
+#define SMALL_COUNT CONFIG_NRF_RPC_BUF_POOL_SMALL_COUNT
+#define LARGE_SIZE CONFIG_NRF_RPC_BUF_POOL_LARGE_SIZE
+#define LARGE_COUNT CONFIG_NRF_RPC_BUF_POOL_LARGE_COUNT
+#define WAIT_TIMEOUT_MS 50
+#define FREE_DELAY_MS 10
+#define DRAIN_TIMEOUT_MS 100
+
+static void *large_bufs[LARGE_COUNT];
+
+static bool buf_pool_drained(const struct nrf_rpc_buf_stats *stats)
+{
+	for (size_t i = 0; i < NRF_RPC_BUF_CLASS_COUNT; i++) {
+		if (stats->classes[i].used != 0) {
+			return false;
+		}
+	}
+
+	return stats->heap_used == 0;
+}
+
+static void large_buf_free_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	nrf_rpc_buf_free(large_bufs[0]);
+	large_bufs[0] = NULL;
+}
+
+static K_WORK_DELAYABLE_DEFINE(large_buf_free_work, large_buf_free_handler);
+
+static void large_bufs_alloc(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(large_bufs); i++) {
+		large_bufs[i] = nrf_rpc_buf_alloc(LARGE_SIZE, K_NO_WAIT);
+		zassert_not_null(large_bufs[i]);
+	}
+}
+
+static void large_bufs_free(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(large_bufs); i++) {
+		nrf_rpc_buf_free(large_bufs[i]);
+		large_bufs[i] = NULL;
+	}
+}
+
+static void buf_pool_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	nrf_rpc_buf_stats_reset();
+}
+
+ZTEST(nrf_rpc_buf_pool, test_size_classes)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_NRF_RPC_BUF_POOL_HEAP_FALLBACK);
+
+	struct nrf_rpc_buf_stats stats;
+	void *small = nrf_rpc_buf_alloc(1, K_NO_WAIT);
+	void *medium = nrf_rpc_buf_alloc(SMALL_SIZE + 1, K_NO_WAIT);
+	void *large = nrf_rpc_buf_alloc(LARGE_SIZE, K_NO_WAIT);
+	void *heap = nrf_rpc_buf_alloc(LARGE_SIZE + 1, K_NO_WAIT);
+
+	zassert_not_null(small);
+	zassert_not_null(medium);
+	zassert_not_null(large);
+	zassert_not_null(heap);
+
+	nrf_rpc_buf_stats_get(&stats);
+
+	for (size_t i = 0; i < NRF_RPC_BUF_CLASS_COUNT; i++) {
+		zassert_equal(stats.classes[i].used, 1, "Class %zu used %u", i,
+			      stats.classes[i].used);
+		zassert_equal(stats.classes[i].allocs, 1);
+	}
+
+	zassert_equal(stats.heap_allocs, 1);
+	zassert_equal(stats.heap_used, 1);
+
+	nrf_rpc_buf_free(small);
+	nrf_rpc_buf_free(medium);
+	nrf_rpc_buf_free(large);
+	nrf_rpc_buf_free(heap);
+
+	nrf_rpc_buf_stats_get(&stats);
+
+	for (size_t i = 0; i < NRF_RPC_BUF_CLASS_COUNT; i++) {
+		zassert_equal(stats.classes[i].used, 0);
+		zassert_equal(stats.classes[i].max_used, 1);
+	}
+
+	zassert_equal(stats.heap_used, 0);
+	zassert_equal(stats.failures, 0);
+}
+
+ZTEST(nrf_rpc_buf_pool, test_next_class_when_exhausted)
+{
+	struct nrf_rpc_buf_stats stats;
+	void *bufs[SMALL_COUNT + 1];
+
+	for (size_t i = 0; i < ARRAY_SIZE(bufs); i++) {
+		bufs[i] = nrf_rpc_buf_alloc(SMALL_SIZE, K_NO_WAIT);
+		zassert_not_null(bufs[i]);
+	}
+
+	nrf_rpc_buf_stats_get(&stats);
+	zassert_equal(stats.classes[0].used, SMALL_COUNT);
+	zassert_equal(stats.classes[1].used, 1, "Medium buffer not used when small ones run out");
+
+	for (size_t i = 0; i < ARRAY_SIZE(bufs); i++) {
+		nrf_rpc_buf_free(bufs[i]);
+	}
+
+	nrf_rpc_buf_stats_get(&stats);
+	zassert_equal(stats.classes[0].used, 0);
+	zassert_equal(stats.classes[1].used, 0);
+}
+
+ZTEST(nrf_rpc_buf_pool, test_exhausted_timeout)
+{
+	Z_TEST_SKIP_IFDEF(CONFIG_NRF_RPC_BUF_POOL_HEAP_FALLBACK);
+
+	struct nrf_rpc_buf_stats stats;
+	int64_t start;
+	void *buf;
+
+	large_bufs_alloc();
+
+	buf = nrf_rpc_buf_alloc(LARGE_SIZE, K_NO_WAIT);
+	zassert_is_null(buf, "Allocated a buffer from an exhausted class");
+
+	start = k_uptime_get();
+	buf = nrf_rpc_buf_alloc(LARGE_SIZE, K_MSEC(WAIT_TIMEOUT_MS));
+	zassert_is_null(buf, "Allocated a buffer from an exhausted class");
+	zassert_true(k_uptime_get() - start >= WAIT_TIMEOUT_MS, "Did not wait for a buffer");
+
+	buf = nrf_rpc_buf_alloc(LARGE_SIZE + 1, K_MSEC(WAIT_TIMEOUT_MS));
+	zassert_is_null(buf, "Allocated a buffer larger than the largest class");
+
+	nrf_rpc_buf_stats_get(&stats);
+	zassert_equal(stats.failures, 3);
+	zassert_equal(stats.classes[2].used, LARGE_COUNT);
+	zassert_equal(stats.heap_allocs, 0);
+
+	large_bufs_free();
+}
+
+ZTEST(nrf_rpc_buf_pool, test_exhausted_wait_for_free)
+{
+	Z_TEST_SKIP_IFDEF(CONFIG_NRF_RPC_BUF_POOL_HEAP_FALLBACK);
+
+	struct nrf_rpc_buf_stats stats;
+	void *buf;
+
+	large_bufs_alloc();
+
+	k_work_schedule(&large_buf_free_work, K_MSEC(FREE_DELAY_MS));
+
+	buf = nrf_rpc_buf_alloc(LARGE_SIZE, K_MSEC(WAIT_TIMEOUT_MS));
+	zassert_not_null(buf, "Buffer freed while waiting was not allocated");
+
+	nrf_rpc_buf_stats_get(&stats);
+	zassert_equal(stats.failures, 0);
+	zassert_equal(stats.classes[2].used, LARGE_COUNT);
+
+	nrf_rpc_buf_free(buf);
+	large_bufs_free();
+}
+
+ZTEST(nrf_rpc_buf_pool, test_transport_buffers_released)
+{
+	struct nrf_rpc_buf_stats stats;
+	int ret;
+
+	test_transport_reset();
+
+	for (int i = 0; i < 20; i++) {
+		ret = test_packet_send(SMALL_SIZE / 2);
+		zassert_equal(ret, 0, "Send failed: %d", ret);
+	}
+
+	ret = test_packets_wait(20, K_SECONDS(2));
+	zassert_equal(ret, 0, "Only %u packets received", test_rx_stats.packets);
+
+	/* The last buffers are freed once their acknowledgments arrive. */
+	for (int i = 0; i < DRAIN_TIMEOUT_MS; i++) {
+		nrf_rpc_buf_stats_get(&stats);
+		if (buf_pool_drained(&stats)) {
+			break;
+		}
+
+		k_msleep(1);
+	}
+
+	zassert_true(stats.classes[0].allocs >= 20, "Transport did not use the pool");
+	zassert_equal(stats.heap_allocs, 0, "Transport fell back to the heap");
+	zassert_equal(stats.heap_used, 0);
+	zassert_equal(stats.failures, 0);
+
+	for (size_t i = 0; i < NRF_RPC_BUF_CLASS_COUNT; i++) {
+		zassert_equal(stats.classes[i].used, 0, "Class %zu leaked %u buffers", i,
+			      stats.classes[i].used);
+	}
+}
+
+ZTEST_SUITE(nrf_rpc_buf_pool, NULL, NULL, buf_pool_before, NULL, NULL);
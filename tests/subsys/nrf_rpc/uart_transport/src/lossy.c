@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+
+#include "test_uart_transport.h"
+
+#define TEST_PACKETS_NUM (100)
+#define TEST_PERIOD (5)
+#define TEST_TIMEOUT (K_SECONDS(10))
+/* Time after which the transport gives up retransmitting a frame. */
+#define GIVE_UP_TIME                                                                               \
+	(K_MSEC(CONFIG_NRF_RPC_UART_ACK_WAITING_TIME * (CONFIG_NRF_RPC_UART_TX_ATTEMPTS + 2)))
+
+static void lossy_before(void *fixture)
+{
+	test_transport_reset();
+}
+
+static void lossy_after(void *fixture)
+{
+	test_loopback_set(TEST_LOOPBACK_LOSSLESS, 0);
+}
+
+static void send_and_check_order(void)
+{
+	int ret;
+
+	for (uint32_t i = 0; i < TEST_PACKETS_NUM; i++) {
+		ret = test_packet_send(sizeof(struct test_packet_header) + i * 3);
+		zassert_equal(ret, 0, "Send failed: %d", ret);
+	}
+
+	ret = test_packets_wait(TEST_PACKETS_NUM, TEST_TIMEOUT);
+	zassert_equal(ret, 0, "Only %u packets received", test_rx_stats.packets);
+	zassert_equal(test_rx_stats.errors, 0, "%u packets out of order or corrupted",
+		      test_rx_stats.errors);
+	zassert_equal(test_packets_wait(1, K_MSEC(CONFIG_NRF_RPC_UART_ACK_WAITING_TIME)),
+		      -EAGAIN, "Packets received more than once");
+}
+
+ZTEST(nrf_rpc_uart_transport_lossy, test_drop)
+{
+	test_loopback_set(TEST_LOOPBACK_DROP, TEST_PERIOD);
+
+	send_and_check_order();
+
+	zassert_true(test_loopback_stats.dropped > 0, "No frames dropped");
+
+	if (IS_ENABLED(CONFIG_NRF_RPC_UART_RELIABLE_WINDOW)) {
+		/* Frames received after a dropped one must not be retransmitted. */
+		zassert_equal(test_loopback_stats.frames,
+			      TEST_PACKETS_NUM + test_loopback_stats.dropped,
+			      "%u frames sent, %u dropped", test_loopback_stats.frames,
+			      test_loopback_stats.dropped);
+	}
+}
+
+ZTEST(nrf_rpc_uart_transport_lossy, test_reorder)
+{
+	test_loopback_set(TEST_LOOPBACK_REORDER, TEST_PERIOD);
+
+	send_and_check_order();
+}
+
+ZTEST(nrf_rpc_uart_transport_lossy, test_give_up)
+{
+	size_t length = sizeof(struct test_packet_header);
+	int ret;
+
+	test_loopback_set(TEST_LOOPBACK_DROP, 1);
+
+	ret = test_packet_send(length);
+
+	if (IS_ENABLED(CONFIG_NRF_RPC_UART_RELIABLE_WINDOW)) {
+		/* The error is returned by the send() call that follows the give-up. */
+		zassert_equal(ret, 0, "Send failed: %d", ret);
+		k_sleep(GIVE_UP_TIME);
+		ret = test_packet_send(length);
+	}
+
+	zassert_equal(ret, -EPROTO, "Unexpected send result: %d", ret);
+	zassert_equal(test_rx_stats.packets, 0, "Dropped packet received");
+
+	/* The transport must recover once frames pass again. */
+	test_transport_reset();
+
+	ret = test_packet_send(length);
+	zassert_equal(ret, 0, "Send failed: %d", ret);
+
+	ret = test_packets_wait(1, TEST_TIMEOUT);
+	zassert_equal(ret, 0, "Packet not received after recovery");
+	zassert_equal(test_rx_stats.errors, 0, "Packet corrupted");
+}
+
+ZTEST(nrf_rpc_uart_transport_lossy, test_peer_restart)
+{
+	Z_TEST_SKIP_IFNDEF(CONFIG_NRF_RPC_UART_RELIABLE_WINDOW);
+
+	size_t length = sizeof(struct test_packet_header) + 8;
+	uint8_t sync_seq;
+	int ret;
+
+	ret = test_packet_send(length);
+	zassert_equal(ret, 0, "Send failed: %d", ret);
+	zassert_equal(test_packets_wait(1, TEST_TIMEOUT), 0, "Packet not received");
+
+	/* A restarted peer may send the same sync frame as the one received last. */
+	sync_seq = test_loopback_last_sync_seq();
+	test_peer_sync_inject(sync_seq);
+	test_peer_packet_inject((sync_seq + 1) & 0x7f, length);
+
+	ret = test_packets_wait(1, TEST_TIMEOUT);
+	zassert_equal(ret, 0, "Packet of a restarted peer dropped");
+
+	/* Restart the receiver window after the last frame sent by the transport. */
+	test_peer_sync_inject(test_loopback_last_seq());
+
+	ret = test_packet_send(length);
+	zassert_equal(ret, 0, "Send failed: %d", ret);
+	zassert_equal(test_packets_wait(1, TEST_TIMEOUT), 0, "Packet not received after restart");
+	zassert_equal(test_rx_stats.errors, 0, "%u packets out of order or corrupted",
+		      test_rx_stats.errors);
+}
+
+ZTEST_SUITE(nrf_rpc_uart_transport_lossy, NULL, NULL, lossy_before, lossy_after, NULL);
@@ -0,0 +1,296 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <nrf_rpc_tr.h>
+#include <nrf_rpc/nrf_rpc_uart.h>
+
+#include <zephyr/drivers/serial/uart_emul.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/crc.h>
+#include <zephyr/ztest.h>
+
+#include "test_uart_transport.h"
+
+#define RPC_UART_NODE DT_NODELABEL(rpc_uart)
+#define TEST_PACKETS_NUM (100)
+#define TEST_TIMEOUT (K_SECONDS(2))
+#define HDLC_DELIMITER (0x7e)
+#define HDLC_ESCAPE (0x7d)
+#define SEQ_SYNC (0x80)
+/* Escaped acknowledgment with delimiters, longer frames carry packets. */
+#define ACK_FRAME_MAX_LEN (6)
+
+static const struct device *const uart_dev = DEVICE_DT_GET(RPC_UART_NODE);
+static const struct nrf_rpc_tr *const transport = &NRF_RPC_UART_TRANSPORT(RPC_UART_NODE);
+
+static K_SEM_DEFINE(rx_sem, 0, K_SEM_MAX_LIMIT);
+static uint32_t tx_seq;
+static uint32_t rx_seq_expected;
+struct test_rx_stats test_rx_stats;
+struct test_loopback_stats test_loopback_stats;
+
+static enum test_loopback_mode loopback_mode;
+static uint32_t loopback_period;
+static uint8_t frame[2 * CONFIG_NRF_RPC_UART_MAX_PACKET_SIZE];
+static size_t frame_len;
+static uint8_t held_frame[sizeof(frame)];
+static size_t held_frame_len;
+static uint8_t last_seq;
+static uint8_t last_sync_seq;
+
+static uint8_t packet_byte(uint32_t seq, size_t i)
+{
+	/* Covers the delimiter and escape octets, which must be escaped in the frame. */
+	return (uint8_t)(seq * 7 + i);
+}
+
+static void receive_handler(const struct nrf_rpc_tr *tr, const uint8_t *packet, size_t len,
+			    void *context)
+{
+	struct test_packet_header header;
+	uint64_t latency;
+
+	if (len < sizeof(header)) {
+		test_rx_stats.errors++;
+		return;
+	}
+
+	memcpy(&header, packet, sizeof(header));
+	latency = host_clock_ns() - header.sent_ns;
+
+	if (header.seq != rx_seq_expected) {
+		test_rx_stats.errors++;
+	}
+
+	for (size_t i = sizeof(header); i < len; i++) {
+		if (packet[i] != packet_byte(header.seq, i)) {
+			test_rx_stats.errors++;
+			break;
+		}
+	}
+
+	rx_seq_expected = header.seq + 1;
+	test_rx_stats.packets++;
+	test_rx_stats.latency_sum += latency;
+	test_rx_stats.latency_max = MAX(test_rx_stats.latency_max, latency);
+
+	k_sem_give(&rx_sem);
+}
+
+/* Pass a complete frame to the RX line, unless it is lost or delayed. */
+static void loopback_frame(const struct device *dev)
+{
+	bool reordered;
+
+	if (frame_len > ACK_FRAME_MAX_LEN) {
+		last_seq = (frame[1] == HDLC_ESCAPE) ? (frame[2] ^ 0x20) : frame[1];
+
+		if (last_seq & SEQ_SYNC) {
+			last_sync_seq = last_seq & ~SEQ_SYNC;
+		}
+	}
+
+	if (loopback_mode == TEST_LOOPBACK_LOSSLESS || frame_len <= ACK_FRAME_MAX_LEN) {
+		uart_emul_put_rx_data(dev, frame, frame_len);
+		return;
+	}
+
+	test_loopback_stats.frames++;
+	reordered = held_frame_len > 0;
+
+	if (test_loopback_stats.frames % loopback_period == 0) {
+		if (loopback_mode == TEST_LOOPBACK_DROP) {
+			test_loopback_stats.dropped++;
+			return;
+		}
+
+		if (!reordered) {
+			memcpy(held_frame, frame, frame_len);
+			held_frame_len = frame_len;
+			return;
+		}
+	}
+
+	uart_emul_put_rx_data(dev, frame, frame_len);
+
+	if (reordered) {
+		uart_emul_put_rx_data(dev, held_frame, held_frame_len);
+		held_frame_len = 0;
+	}
+}
+
+/* Emulate a wire between the TX and RX lines of the UART. */
+static void loopback_cb(const struct device *dev, size_t size, void *user_data)
+{
+	uint8_t buf[64];
+	uint32_t len;
+
+	while ((len = uart_emul_get_tx_data(dev, buf, sizeof(buf))) > 0) {
+		for (uint32_t i = 0; i < len; i++) {
+			if (frame_len == 0 && buf[i] != HDLC_DELIMITER) {
+				continue;
+			}
+
+			if (frame_len < sizeof(frame)) {
+				frame[frame_len++] = buf[i];
+			}
+
+			if (frame_len > 1 && buf[i] == HDLC_DELIMITER) {
+				loopback_frame(dev);
+				frame_len = 0;
+			}
+		}
+	}
+}
+
+void test_loopback_set(enum test_loopback_mode mode, uint32_t period)
+{
+	loopback_mode = mode;
+	loopback_period = period;
+	held_frame_len = 0;
+	memset(&test_loopback_stats, 0, sizeof(test_loopback_stats));
+}
+
+void test_transport_reset(void)
+{
+	int ret;
+
+	zassert_true(device_is_ready(uart_dev), "UART device not ready");
+
+	uart_emul_callback_tx_data_ready_set(uart_dev, loopback_cb, NULL);
+
+	ret = transport->api->init(transport, receive_handler, NULL);
+	zassert_equal(ret, 0, "Transport init failed: %d", ret);
+
+	test_loopback_set(TEST_LOOPBACK_LOSSLESS, 0);
+	k_sem_reset(&rx_sem);
+	memset(&test_rx_stats, 0, sizeof(test_rx_stats));
+	rx_seq_expected = tx_seq;
+}
+
+static void packet_fill(uint8_t *packet, size_t length)
+{
+	struct test_packet_header header = {.seq = tx_seq++};
+
+	for (size_t i = sizeof(header); i < length; i++) {
+		packet[i] = packet_byte(header.seq, i);
+	}
+
+	header.sent_ns = host_clock_ns();
+	memcpy(packet, &header, sizeof(header));
+}
+
+int test_packet_send(size_t length)
+{
+	size_t size = length;
+	uint8_t *packet;
+
+	packet = transport->api->tx_buf_alloc(transport, &size);
+	if (packet == NULL) {
+		return -ENOMEM;
+	}
+
+	packet_fill(packet, length);
+
+	return transport->api->send(transport, packet, length);
+}
+
+static size_t escape(uint8_t *out, const uint8_t *in, size_t length)
+{
+	size_t len = 0;
+
+	for (size_t i = 0; i < length; i++) {
+		if (in[i] == HDLC_DELIMITER || in[i] == HDLC_ESCAPE) {
+			out[len++] = HDLC_ESCAPE;
+			out[len++] = in[i] ^ 0x20;
+		} else {
+			out[len++] = in[i];
+		}
+	}
+
+	return len;
+}
+
+/* Pass a frame with a sequence number header to the RX line, as if sent by another peer. */
+static void peer_frame_inject(uint8_t header, const uint8_t *data, size_t length)
+{
+	static uint8_t peer_frame[sizeof(frame)];
+	uint8_t crc[sizeof(uint16_t)];
+	size_t len = 0;
+
+	sys_put_le16(crc16_ccitt(crc16_ccitt(0xffff, &header, 1), data, length), crc);
+
+	peer_frame[len++] = HDLC_DELIMITER;
+	len += escape(&peer_frame[len], &header, 1);
+	len += escape(&peer_frame[len], data, length);
+	len += escape(&peer_frame[len], crc, sizeof(crc));
+	peer_frame[len++] = HDLC_DELIMITER;
+
+	uart_emul_put_rx_data(uart_dev, peer_frame, len);
+}
+
+void test_peer_sync_inject(uint8_t seq)
+{
+	peer_frame_inject(seq | SEQ_SYNC, NULL, 0);
+}
+
+void test_peer_packet_inject(uint8_t seq, size_t length)
+{
+	static uint8_t packet[CONFIG_NRF_RPC_UART_MAX_PACKET_SIZE];
+
+	packet_fill(packet, length);
+	peer_frame_inject(seq, packet, length);
+}
+
+uint8_t test_loopback_last_seq(void)
+{
+	return last_seq & ~SEQ_SYNC;
+}
+
+uint8_t test_loopback_last_sync_seq(void)
+{
+	return last_sync_seq;
+}
+
+int test_packets_wait(uint32_t count, k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	int ret;
+
+	for (uint32_t i = 0; i < count; i++) {
+		ret = k_sem_take(&rx_sem, sys_timepoint_timeout(end));
+		if (ret) {
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
+static void *test_setup(void)
+{
+	test_transport_reset();
+
+	return NULL;
+}
+
+ZTEST(nrf_rpc_uart_transport, test_loopback_order)
+{
+	int ret;
+
+	for (uint32_t i = 0; i < TEST_PACKETS_NUM; i++) {
+		ret = test_packet_send(sizeof(struct test_packet_header) + i * 3);
+		zassert_equal(ret, 0, "Send failed: %d", ret);
+	}
+
+	ret = test_packets_wait(TEST_PACKETS_NUM, TEST_TIMEOUT);
+	zassert_equal(ret, 0, "Only %u packets received", test_rx_stats.packets);
+	zassert_equal(test_rx_stats.errors, 0, "%u packets out of order or corrupted",
+		      test_rx_stats.errors);
+	zassert_equal(k_sem_count_get(&rx_sem), 0, "Packets received more than once");
+}
+
+ZTEST_SUITE(nrf_rpc_uart_transport, NULL, test_setup, NULL, NULL, NULL);
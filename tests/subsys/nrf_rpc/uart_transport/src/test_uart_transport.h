@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef TEST_UART_TRANSPORT_H_
+#define TEST_UART_TRANSPORT_H_
+
+#include <zephyr/kernel.h>
+
+/* Header of every test packet, followed by the payload pattern. */
+struct test_packet_header {
+	uint64_t sent_ns;
+	uint32_t seq;
+};
+
+/* Latency in nanoseconds of the host clock. */
+struct test_rx_stats {
+	uint32_t packets;
+	uint32_t errors;
+	uint64_t latency_sum;
+	uint64_t latency_max;
+};
+
+/* Frames carrying packets, counted only when the loopback is lossy. */
+struct test_loopback_stats {
+	uint32_t frames;
+	uint32_t dropped;
+};
+
+enum test_loopback_mode {
+	/* Pass all frames. */
+	TEST_LOOPBACK_LOSSLESS,
+	/* Drop every Nth frame that carries a packet. */
+	TEST_LOOPBACK_DROP,
+	/* Delay every Nth frame that carries a packet until after the next one. */
+	TEST_LOOPBACK_REORDER,
+};
+
+extern struct test_rx_stats test_rx_stats;
+
+/* Host clock provided by the native simulator runner. Simulated time does not advance while
+ * code executes on native_sim.
+ */
+uint64_t host_clock_ns(void);
+extern struct test_loopback_stats test_loopback_stats;
+
+/* Initialize the transport on the loopback UART and reset the receiver state. */
+void test_transport_reset(void);
+
+/* Change how the loopback passes frames and reset its statistics. Acknowledgments always pass. */
+void test_loopback_set(enum test_loopback_mode mode, uint32_t period);
+
+/* Send a packet of the given length with the next sequence number and a matching payload. */
+int test_packet_send(size_t length);
+
+/* Inject an empty sync frame of a sliding window peer with the given sequence number. */
+void test_peer_sync_inject(uint8_t seq);
+
+/* Inject a packet frame of a sliding window peer with the next packet sequence number. */
+void test_peer_packet_inject(uint8_t seq, size_t length);
+
+/* Get the sequence number of the last frame carrying a packet sent by the sliding window. */
+uint8_t test_loopback_last_seq(void);
+
+/* Get the sequence number of the last sync frame sent by the sliding window. */
+uint8_t test_loopback_last_sync_seq(void);
+
+/* Wait until the given number of packets have been received since the last reset. */
+int test_packets_wait(uint32_t count, k_timeout_t timeout);
+
+#endif /* TEST_UART_TRANSPORT_H_ */